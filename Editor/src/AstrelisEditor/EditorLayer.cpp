@@ -3,6 +3,7 @@
 #include "Astrelis/Core/Base.hpp"
 
 #include "Astrelis/Core/Application.hpp"
+#include "Astrelis/Core/FrameStats.hpp"
 #include "Astrelis/Core/Time.hpp"
 #include "Astrelis/IO/File.hpp"
 
@@ -37,12 +38,25 @@ namespace AstrelisEditor {
 
         m_Mesh.Indices = {0, 1, 2, 2, 3, 0};
 
-        m_Instances.resize(2);
-        m_Instances[0].Transform = Astrelis::Mat4f(1.0F);
-        m_Instances[0].Color     = Astrelis::Vec3f(1.0F, 0.0F, 0.0F);
-
-        m_Instances[1].Transform = Astrelis::Mat4f(1.0F);
-        m_Instances[1].Color     = Astrelis::Vec3f(0.0F, 0.0F, 1.0F);
+        Astrelis::Entity leftQuad = m_Scene.CreateEntity("Left Quad");
+        leftQuad.GetComponent<Astrelis::Transform2D>().Position = Astrelis::Vec2f(-0.5F, 0.0F);
+        leftQuad.AddComponent<Astrelis::SpriteRenderer>(Astrelis::Vec3f(1.0F, 0.0F, 0.0F));
+        leftQuad.AddComponent<Spinner>(1.0F);
+
+        Astrelis::Entity rightQuad = m_Scene.CreateEntity("Right Quad");
+        rightQuad.GetComponent<Astrelis::Transform2D>().Position = Astrelis::Vec2f(0.5F, 0.0F);
+        rightQuad.AddComponent<Astrelis::SpriteRenderer>(Astrelis::Vec3f(0.0F, 0.0F, 1.0F));
+        rightQuad.AddComponent<Spinner>(-1.0F);
+
+        m_Systems.AddSystem("Spin",
+            Astrelis::SystemAccess().Read<Spinner>().Write<Astrelis::Transform2D>(),
+            [](Astrelis::SystemContext& context) {
+                const auto elapsedTime = static_cast<float>(Astrelis::Time::TimeSinceAppStart());
+                context.ParallelEach<const Spinner, Astrelis::Transform2D>(
+                    [elapsedTime](const Spinner& spinner, Astrelis::Transform2D& transform) {
+                        transform.Rotation = spinner.Speed * elapsedTime;
+                    });
+            });
     }
 
     void EditorLayer::OnDetach() {
@@ -50,19 +64,10 @@ namespace AstrelisEditor {
     }
 
     void EditorLayer::OnUpdate() {
-        m_Renderer2D.BeginFrame();
-        float elapsedTime = static_cast<float>(Astrelis::Time::TimeSinceAppStart());
-
-
-        m_Instances[0].Transform = Astrelis::Mat4f(1.0F);
-        m_Instances[0].Transform.Translated(Astrelis::Vec3f(-0.5F, 0.0F, 0.0F));
-        m_Instances[0].Transform.Rotated(elapsedTime, Astrelis::Vec3f(0.0F, 0.0F, 1.0F));
+        m_Systems.Run(m_Scene, Astrelis::Application::Get().GetJobSystem());
 
-        m_Instances[1].Transform = Astrelis::Mat4f(1.0F);
-        m_Instances[1].Transform.Translated(Astrelis::Vec3f(0.5F, 0.0F, 0.0F));
-        m_Instances[1].Transform.Rotated(-elapsedTime, Astrelis::Vec3f(0.0F, 0.0F, 1.0F));
-
-        m_Renderer2D.SubmitInstanced(m_Mesh, m_Instances);
+        m_Renderer2D.BeginFrame();
+        m_SpriteRenderSystem.Render(m_Scene, m_Renderer2D, m_Mesh);
         m_Renderer2D.EndFrame();
     }
 
@@ -93,6 +98,15 @@ namespace AstrelisEditor {
 
 
         ImGui::Text("FPS: %f", ImGui::GetIO().Framerate);
+        const Astrelis::FrameTimeSummary frameTimes = Astrelis::Time::GetFrameStats().GetSummary();
+        ImGui::Text("Frame time p50: %.2fms p95: %.2fms p99: %.2fms max: %.2fms", frameTimes.P50,
+            frameTimes.P95, frameTimes.P99, frameTimes.Max);
+        if (ImGui::Button("Dump Frame Times")) {
+            auto res = Astrelis::Time::GetFrameStats().WriteCSV("frame_times.csv");
+            if (res.IsErr()) {
+                ASTRELIS_LOG_ERROR("Failed to dump frame times: {0}", res.UnwrapErr());
+            }
+        }
         static bool vsync = Astrelis::Application::Get().GetWindow()->IsVSync();
         if (ImGui::Button("Toggle VSync")) {
             vsync = !vsync;
@@ -118,7 +132,16 @@ namespace AstrelisEditor {
 
         ImGui::Begin("Hierarchy");
 
-        ImGui::Text("Object 1");
+        // Only the visible rows are drawn, scenes can have a lot of entities
+        auto             tags = m_Scene.View<const Astrelis::Tag>();
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(tags.size()));
+        while (clipper.Step()) {
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++) {
+                const auto entity = *(tags.begin() + row);
+                ImGui::Text("%s", tags.get<const Astrelis::Tag>(entity).Name.c_str());
+            }
+        }
 
         ImGui::End();
 
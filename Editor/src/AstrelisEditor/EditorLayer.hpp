@@ -2,6 +2,9 @@
 
 #include "Astrelis/Core/Layer.hpp"
 #include "Astrelis/Renderer/Renderer2D.hpp"
+#include "Astrelis/Scene/Scene.hpp"
+#include "Astrelis/Scene/SpriteRenderSystem.hpp"
+#include "Astrelis/Scene/SystemScheduler.hpp"
 
 #include <future>
 #include <string>
@@ -10,6 +13,11 @@
 #include "Console.hpp"
 
 namespace AstrelisEditor {
+    /// @brief Rotates the entity at a constant speed, in radians per second
+    struct Spinner {
+        float Speed = 1.0F;
+    };
+
     class EditorLayer : public Astrelis::Layer {
     public:
         explicit EditorLayer(std::string rootDirectory);
@@ -28,9 +36,11 @@ namespace AstrelisEditor {
         Console    m_Console;
         AssetPanel m_AssetPanel;
 
-        Astrelis::Renderer2D                m_Renderer2D;
-        Astrelis::Mesh2D                    m_Mesh;
-        std::vector<Astrelis::InstanceData> m_Instances;
+        Astrelis::Renderer2D         m_Renderer2D;
+        Astrelis::Mesh2D             m_Mesh;
+        Astrelis::Scene              m_Scene;
+        Astrelis::SystemScheduler    m_Systems;
+        Astrelis::SpriteRenderSystem m_SpriteRenderSystem;
 
         std::future<Astrelis::InMemoryImage> m_CaptureFuture;
     };
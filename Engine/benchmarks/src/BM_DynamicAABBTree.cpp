@@ -0,0 +1,147 @@
+#include <Astrelis/Scene/DynamicAABBTree.hpp>
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using Astrelis::DynamicAABBTree, Astrelis::Point2Df, Astrelis::Rect2Df;
+
+// Objects are spread so that the density stays the same for every count, with sizes over three orders
+// of magnitude, and queries use a fixed size viewport
+static std::vector<Rect2Df> BM_MakeBounds(std::size_t count) {
+    std::mt19937                          random(1234);
+    const float                           worldSize = std::sqrt(static_cast<float>(count)) * 10.0F;
+    std::uniform_real_distribution<float> coordinate(0.0F, worldSize);
+    std::uniform_real_distribution<float> exponent(-1.0F, 2.0F);
+
+    std::vector<Rect2Df> bounds;
+    bounds.reserve(count);
+    for (std::size_t i = 0; i < count; i++) {
+        bounds.emplace_back(coordinate(random), coordinate(random),
+            std::pow(10.0F, exponent(random)), std::pow(10.0F, exponent(random)));
+    }
+    return bounds;
+}
+
+static std::vector<Rect2Df> BM_MakeViewports(std::size_t count) {
+    std::mt19937                          random(5678);
+    const float                           worldSize = std::sqrt(static_cast<float>(count)) * 10.0F;
+    std::uniform_real_distribution<float> coordinate(0.0F, worldSize - 100.0F);
+
+    std::vector<Rect2Df> viewports;
+    for (int i = 0; i < 64; i++) {
+        viewports.emplace_back(coordinate(random), coordinate(random), 160.0F, 90.0F);
+    }
+    return viewports;
+}
+
+static bool BM_Overlaps(const Rect2Df& lhs, const Rect2Df& rhs) {
+    return lhs.X() <= rhs.X() + rhs.Width() && rhs.X() <= lhs.X() + lhs.Width()
+        && lhs.Y() <= rhs.Y() + rhs.Height() && rhs.Y() <= lhs.Y() + lhs.Height();
+}
+
+static void BM_AABBTreeQueryRect(benchmark::State& state) {
+    const auto count     = static_cast<std::size_t>(state.range(0));
+    const auto bounds    = BM_MakeBounds(count);
+    const auto viewports = BM_MakeViewports(count);
+
+    DynamicAABBTree tree;
+    for (std::size_t i = 0; i < bounds.size(); i++) {
+        tree.CreateProxy(bounds[i], static_cast<std::uint32_t>(i));
+    }
+
+    std::vector<std::uint32_t> results;
+    std::size_t                viewport = 0;
+    for (auto _state : state) {
+        benchmark::DoNotOptimize(tree.QueryRect(viewports[viewport], results).size());
+        viewport = (viewport + 1) % viewports.size();
+    }
+}
+
+static void BM_BruteForceQueryRect(benchmark::State& state) {
+    const auto count     = static_cast<std::size_t>(state.range(0));
+    const auto bounds    = BM_MakeBounds(count);
+    const auto viewports = BM_MakeViewports(count);
+
+    std::vector<std::uint32_t> results;
+    std::size_t                viewport = 0;
+    for (auto _state : state) {
+        results.clear();
+        for (std::size_t i = 0; i < bounds.size(); i++) {
+            if (BM_Overlaps(viewports[viewport], bounds[i])) {
+                results.push_back(static_cast<std::uint32_t>(i));
+            }
+        }
+        benchmark::DoNotOptimize(results.size());
+        viewport = (viewport + 1) % viewports.size();
+    }
+}
+
+static void BM_AABBTreeQueryPoint(benchmark::State& state) {
+    const auto count     = static_cast<std::size_t>(state.range(0));
+    const auto bounds    = BM_MakeBounds(count);
+    const auto viewports = BM_MakeViewports(count);
+
+    DynamicAABBTree tree;
+    for (std::size_t i = 0; i < bounds.size(); i++) {
+        tree.CreateProxy(bounds[i], static_cast<std::uint32_t>(i));
+    }
+
+    std::vector<std::uint32_t> results;
+    std::size_t                viewport = 0;
+    for (auto _state : state) {
+        const Point2Df point = viewports[viewport].Position;
+        benchmark::DoNotOptimize(tree.QueryPoint(point, results).size());
+        viewport = (viewport + 1) % viewports.size();
+    }
+}
+
+static void BM_BruteForceQueryPoint(benchmark::State& state) {
+    const auto count     = static_cast<std::size_t>(state.range(0));
+    const auto bounds    = BM_MakeBounds(count);
+    const auto viewports = BM_MakeViewports(count);
+
+    std::vector<std::uint32_t> results;
+    std::size_t                viewport = 0;
+    for (auto _state : state) {
+        const Rect2Df point(viewports[viewport].Position, Astrelis::Dimension2Df(0.0F, 0.0F));
+        results.clear();
+        for (std::size_t i = 0; i < bounds.size(); i++) {
+            if (BM_Overlaps(point, bounds[i])) {
+                results.push_back(static_cast<std::uint32_t>(i));
+            }
+        }
+        benchmark::DoNotOptimize(results.size());
+        viewport = (viewport + 1) % viewports.size();
+    }
+}
+
+// Moves every object a little each iteration, most stay inside their fat bounds
+static void BM_AABBTreeMove(benchmark::State& state) {
+    const auto count  = static_cast<std::size_t>(state.range(0));
+    auto       bounds = BM_MakeBounds(count);
+
+    DynamicAABBTree            tree;
+    std::vector<std::uint32_t> proxies;
+    proxies.reserve(bounds.size());
+    for (std::size_t i = 0; i < bounds.size(); i++) {
+        proxies.push_back(tree.CreateProxy(bounds[i], static_cast<std::uint32_t>(i)));
+    }
+
+    float direction = 0.05F;
+    for (auto _state : state) {
+        for (std::size_t i = 0; i < bounds.size(); i++) {
+            bounds[i].Position.X += direction;
+            tree.MoveProxy(proxies[i], bounds[i], Astrelis::Vec2f(direction, 0.0F));
+        }
+        direction = -direction;
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+
+BENCHMARK(BM_AABBTreeQueryRect)->Arg(10'000)->Arg(100'000)->Arg(1'000'000);
+BENCHMARK(BM_BruteForceQueryRect)->Arg(10'000)->Arg(100'000)->Arg(1'000'000);
+BENCHMARK(BM_AABBTreeQueryPoint)->Arg(10'000)->Arg(100'000)->Arg(1'000'000);
+BENCHMARK(BM_BruteForceQueryPoint)->Arg(10'000)->Arg(100'000)->Arg(1'000'000);
+BENCHMARK(BM_AABBTreeMove)->Arg(10'000)->Arg(100'000)->Arg(1'000'000);
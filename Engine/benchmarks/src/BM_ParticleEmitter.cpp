@@ -0,0 +1,48 @@
+#include <Astrelis/Scene/ParticleEmitter.hpp>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <vector>
+
+using Astrelis::InstanceData, Astrelis::ParticleEmitter, Astrelis::ParticleEmitterProps;
+
+static constexpr float BM_PARTICLE_STEP = 1.0F / 60.0F;
+
+// The emission rate replaces the particles that die, so the emitter stays close to full and every
+// update removes and emits about 1% of the particles
+static ParticleEmitter BM_MakeEmitter(std::size_t count) {
+    ParticleEmitterProps props;
+    props.MaxParticles = static_cast<std::uint32_t>(count);
+    props.EmissionRate = static_cast<float>(count) / 2.0F;
+    props.MinLifetime  = 1.0F;
+    props.MaxLifetime  = 3.0F;
+    props.Drag         = 0.1F;
+
+    ParticleEmitter emitter(props);
+    emitter.Emit(static_cast<std::uint32_t>(count));
+    for (int step = 0; step < 120; step++) {
+        emitter.Update(BM_PARTICLE_STEP);
+    }
+    return emitter;
+}
+
+static void BM_ParticleUpdate(benchmark::State& state) {
+    ParticleEmitter emitter = BM_MakeEmitter(static_cast<std::size_t>(state.range(0)));
+    for (auto _state : state) {
+        emitter.Update(BM_PARTICLE_STEP);
+        benchmark::DoNotOptimize(emitter.GetParticleCount());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_ParticleWriteInstances(benchmark::State& state) {
+    const ParticleEmitter     emitter = BM_MakeEmitter(static_cast<std::size_t>(state.range(0)));
+    std::vector<InstanceData> instances(emitter.GetParticleCount());
+    for (auto _state : state) {
+        benchmark::DoNotOptimize(emitter.WriteInstances(instances));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_ParticleUpdate)->Arg(50'000)->Arg(500'000);
+BENCHMARK(BM_ParticleWriteInstances)->Arg(50'000)->Arg(500'000);
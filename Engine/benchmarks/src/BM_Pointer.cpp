@@ -90,6 +90,92 @@ static void BM_RefPtrDeref(benchmark::State& state) {
     }
 }
 
+// Wrapping an existing pointer still allocates the count separately
+static void BM_RefPtrWrapCreateDelete(benchmark::State& state) {
+    for (auto _state : state) {
+        auto ptr = Astrelis::RefPtr<int>(new int(5));
+        ptr.Reset();
+        benchmark::DoNotOptimize(ptr);
+    }
+}
+
+namespace {
+    class CountedInt : public Astrelis::RefCounted {
+    public:
+        explicit CountedInt(int value) : Value(value) {
+        }
+
+        int Value;
+    };
+} // namespace
+
+static void BM_RefCountedCreateDelete(benchmark::State& state) {
+    for (auto _state : state) {
+        auto ptr = Astrelis::RefPtr<CountedInt>::Create(5);
+        ptr.Reset();
+        benchmark::DoNotOptimize(ptr);
+    }
+}
+
+static void BM_RefCountedCopy(benchmark::State& state) {
+    auto ptr = Astrelis::RefPtr<CountedInt>::Create(5);
+    for (auto _state : state) {
+        auto copy = ptr;
+        benchmark::DoNotOptimize(copy);
+    }
+}
+
+static void BM_RefCountedDeref(benchmark::State& state) {
+    auto ptr = Astrelis::RefPtr<CountedInt>::Create(5);
+    for (auto _state : state) {
+        auto deref = ptr->Value;
+        benchmark::DoNotOptimize(deref);
+    }
+}
+
+static void BM_AtomicRefPtrCreateDelete(benchmark::State& state) {
+    for (auto _state : state) {
+        auto ptr = Astrelis::AtomicRefPtr<int>::Create(5);
+        ptr.Reset();
+        benchmark::DoNotOptimize(ptr);
+    }
+}
+
+static void BM_AtomicRefPtrCopy(benchmark::State& state) {
+    auto ptr = Astrelis::AtomicRefPtr<int>::Create(5);
+    for (auto _state : state) {
+        auto copy = ptr;
+        benchmark::DoNotOptimize(copy);
+    }
+}
+
+static void BM_WeakPtrLock(benchmark::State& state) {
+    auto               ptr  = std::make_shared<int>(5);
+    std::weak_ptr<int> weak = ptr;
+    for (auto _state : state) {
+        auto locked = weak.lock();
+        benchmark::DoNotOptimize(locked);
+    }
+}
+
+static void BM_WeakRefLock(benchmark::State& state) {
+    auto                   ptr  = Astrelis::RefPtr<int>::Create(5);
+    Astrelis::WeakRef<int> weak = ptr;
+    for (auto _state : state) {
+        auto locked = weak.Lock();
+        benchmark::DoNotOptimize(locked);
+    }
+}
+
+static void BM_AtomicWeakRefLock(benchmark::State& state) {
+    auto ptr = Astrelis::AtomicRefPtr<int>::Create(5);
+    Astrelis::WeakRef<int, Astrelis::RefCountPolicy::Atomic> weak = ptr;
+    for (auto _state : state) {
+        auto locked = weak.Lock();
+        benchmark::DoNotOptimize(locked);
+    }
+}
+
 BENCHMARK(BM_SharedPtrCreateDelete);
 BENCHMARK(BM_SharedPtrCopy);
 BENCHMARK(BM_SharedPtrDeref);
@@ -97,4 +183,15 @@ BENCHMARK(BM_SharedPtrDeref);
 BENCHMARK(BM_RefPtrCreateDelete);
 BENCHMARK(BM_RefPtrCopy);
 BENCHMARK(BM_RefPtrDeref);
+BENCHMARK(BM_RefPtrWrapCreateDelete);
+
+BENCHMARK(BM_AtomicRefPtrCreateDelete);
+BENCHMARK(BM_AtomicRefPtrCopy);
+
+BENCHMARK(BM_WeakPtrLock);
+BENCHMARK(BM_WeakRefLock);
+BENCHMARK(BM_AtomicWeakRefLock);
 
+BENCHMARK(BM_RefCountedCreateDelete);
+BENCHMARK(BM_RefCountedCopy);
+BENCHMARK(BM_RefCountedDeref);
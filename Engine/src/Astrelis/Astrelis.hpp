@@ -4,8 +4,11 @@
 /// @brief Main header file for Astrelis library.
 /// @details This file includes all the necessary headers for the game engine, so that the user can include only this file to use the library.
 
+#include "Astrelis/Core/Allocator.hpp"
 #include "Astrelis/Core/Application.hpp"
+#include "Astrelis/Core/FrameArena.hpp"
 #include "Astrelis/Core/Geometry.hpp"
+#include "Astrelis/Core/Input.hpp"
 #include "Astrelis/Core/Layer.hpp"
 #include "Astrelis/Core/Log.hpp"
 #include "Astrelis/Core/Math.hpp"
@@ -13,6 +16,18 @@
 #include "Astrelis/Core/Time.hpp"
 #include "Astrelis/Core/Window.hpp"
 #include "Astrelis/Events/Event.hpp"
+#include "Astrelis/Events/EventQueue.hpp"
 #include "Astrelis/Events/KeyEvent.hpp"
 #include "Astrelis/Events/MouseEvent.hpp"
 #include "Astrelis/Events/WindowEvent.hpp"
+#include "Astrelis/Physics2D/Collision2D.hpp"
+#include "Astrelis/Physics2D/PhysicsWorld2D.hpp"
+#include "Astrelis/Scene/Components.hpp"
+#include "Astrelis/Scene/DynamicAABBTree.hpp"
+#include "Astrelis/Scene/ParticleEmitter.hpp"
+#include "Astrelis/Scene/Scene.hpp"
+#include "Astrelis/Scene/SpatialHashGrid.hpp"
+#include "Astrelis/Scene/SpriteAnimationSystem.hpp"
+#include "Astrelis/Scene/SpriteRenderSystem.hpp"
+#include "Astrelis/Scene/SystemScheduler.hpp"
+#include "Astrelis/Scene/TransformHierarchy.hpp"
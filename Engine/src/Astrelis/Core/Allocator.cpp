@@ -0,0 +1,174 @@
+#include "Allocator.hpp"
+
+#include "Astrelis/Core/Base.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <new>
+
+namespace Astrelis {
+    namespace {
+        struct TagCounters {
+            std::atomic<std::size_t>   LiveBytes        = 0;
+            std::atomic<std::size_t>   PeakBytes        = 0;
+            std::atomic<std::size_t>   LiveAllocations  = 0;
+            std::atomic<std::uint64_t> TotalAllocations = 0;
+        };
+
+        // Names have to outlive the Tracy session, so they are literals
+        constexpr std::array<const char*, MEMORY_TAG_COUNT> TAG_NAMES = {
+            "General", "Renderer", "IO", "Editor", "Events"};
+        constexpr std::array<const char*, MEMORY_TAG_COUNT> TAG_PLOT_NAMES = {"Memory General",
+            "Memory Renderer", "Memory IO", "Memory Editor", "Memory Events"};
+
+        std::array<TagCounters, MEMORY_TAG_COUNT> s_TagCounters;
+
+        TagCounters& GetCounters(MemoryTag tag) noexcept {
+            return s_TagCounters[static_cast<std::size_t>(tag)];
+        }
+    } // namespace
+
+    const char* GetMemoryTagName(MemoryTag tag) noexcept {
+        const auto index = static_cast<std::size_t>(tag);
+        return index < TAG_NAMES.size() ? TAG_NAMES[index] : "Unknown";
+    }
+
+    void MemoryTracker::RecordAllocation(MemoryTag tag, void* ptr, std::size_t size) noexcept {
+        TagCounters&      counters = GetCounters(tag);
+        const std::size_t live =
+            counters.LiveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+        counters.LiveAllocations.fetch_add(1, std::memory_order_relaxed);
+        counters.TotalAllocations.fetch_add(1, std::memory_order_relaxed);
+
+        std::size_t peak = counters.PeakBytes.load(std::memory_order_relaxed);
+        while (live > peak
+            && !counters.PeakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+        }
+
+        ASTRELIS_PROFILE_ALLOC(ptr, size, GetMemoryTagName(tag));
+        ASTRELIS_UNUSED(ptr);
+    }
+
+    void MemoryTracker::RecordDeallocation(MemoryTag tag, void* ptr, std::size_t size) noexcept {
+        TagCounters& counters = GetCounters(tag);
+        counters.LiveBytes.fetch_sub(size, std::memory_order_relaxed);
+        counters.LiveAllocations.fetch_sub(1, std::memory_order_relaxed);
+
+        ASTRELIS_PROFILE_FREE(ptr, GetMemoryTagName(tag));
+        ASTRELIS_UNUSED(ptr);
+    }
+
+    MemoryStats MemoryTracker::GetStats(MemoryTag tag) noexcept {
+        const TagCounters& counters = GetCounters(tag);
+        MemoryStats        stats;
+        stats.LiveBytes        = counters.LiveBytes.load(std::memory_order_relaxed);
+        stats.PeakBytes        = counters.PeakBytes.load(std::memory_order_relaxed);
+        stats.LiveAllocations  = counters.LiveAllocations.load(std::memory_order_relaxed);
+        stats.TotalAllocations = counters.TotalAllocations.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    void MemoryTracker::PlotStats() noexcept {
+        for (std::size_t i = 0; i < MEMORY_TAG_COUNT; i++) {
+            [[maybe_unused]] const auto live = static_cast<std::int64_t>(
+                s_TagCounters[i].LiveBytes.load(std::memory_order_relaxed));
+            ASTRELIS_PROFILE_PLOT(TAG_PLOT_NAMES[i], live);
+        }
+    }
+
+    Allocator& Allocator::GetDefault() {
+        static DefaultAllocator allocator;
+        return allocator;
+    }
+
+    Allocator& Allocator::GetTagged(MemoryTag tag) {
+        static_assert(MEMORY_TAG_COUNT == 5, "Every memory tag needs a tracking allocator");
+        static std::array<TrackingAllocator, MEMORY_TAG_COUNT> allocators = {
+            TrackingAllocator(MemoryTag::General),
+            TrackingAllocator(MemoryTag::Renderer),
+            TrackingAllocator(MemoryTag::IO),
+            TrackingAllocator(MemoryTag::Editor),
+            TrackingAllocator(MemoryTag::Events),
+        };
+        return allocators[static_cast<std::size_t>(tag)];
+    }
+
+    void* DefaultAllocator::Allocate(std::size_t size, std::size_t alignment) {
+        if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            return ::operator new(size, std::align_val_t(alignment));
+        }
+        return ::operator new(size);
+    }
+
+    void DefaultAllocator::Deallocate(void* ptr, std::size_t size, std::size_t alignment) noexcept {
+        ASTRELIS_UNUSED(size);
+        if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            ::operator delete(ptr, std::align_val_t(alignment));
+            return;
+        }
+        ::operator delete(ptr);
+    }
+
+    PoolAllocator::PoolAllocator(
+        std::size_t blockSize, std::size_t blocksPerChunk, Allocator& upstream)
+        : m_BlockSize(blockSize), m_BlocksPerChunk(blocksPerChunk), m_Upstream(upstream) {
+        ASTRELIS_CORE_ASSERT(blocksPerChunk > 0, "Pool chunks need at least one block");
+        // Every block has to fit the free list link, and stay aligned in the chunk
+        constexpr std::size_t BLOCK_ALIGNMENT = alignof(std::max_align_t);
+        m_BlockSize = std::max(m_BlockSize, sizeof(FreeBlock));
+        m_BlockSize = (m_BlockSize + BLOCK_ALIGNMENT - 1) / BLOCK_ALIGNMENT * BLOCK_ALIGNMENT;
+    }
+
+    PoolAllocator::~PoolAllocator() {
+        for (void* chunk : m_Chunks) {
+            m_Upstream.Deallocate(chunk, m_BlockSize * m_BlocksPerChunk);
+        }
+    }
+
+    void* PoolAllocator::Allocate(std::size_t size, std::size_t alignment) {
+        ASTRELIS_CORE_ASSERT(size <= m_BlockSize && alignment <= alignof(std::max_align_t),
+            "Allocation does not fit into a pool block");
+        ASTRELIS_UNUSED(size);
+        ASTRELIS_UNUSED(alignment);
+        if (m_FreeList == nullptr) {
+            ASTRELIS_PROFILE_SCOPE("PoolAllocator Grow");
+            auto* chunk =
+                static_cast<std::byte*>(m_Upstream.Allocate(m_BlockSize * m_BlocksPerChunk));
+            m_Chunks.push_back(chunk);
+            // Linked in reverse, so the blocks are handed out in address order
+            for (std::size_t i = m_BlocksPerChunk; i > 0; i--) {
+                auto* block = new (chunk + (i - 1) * m_BlockSize) FreeBlock {m_FreeList};
+                m_FreeList  = block;
+            }
+        }
+
+        FreeBlock* block = m_FreeList;
+        m_FreeList       = block->Next;
+        return block;
+    }
+
+    void PoolAllocator::Deallocate(void* ptr, std::size_t size, std::size_t alignment) noexcept {
+        ASTRELIS_UNUSED(size);
+        ASTRELIS_UNUSED(alignment);
+        if (ptr == nullptr) {
+            return;
+        }
+        m_FreeList = new (ptr) FreeBlock {m_FreeList};
+    }
+
+    void* TrackingAllocator::Allocate(std::size_t size, std::size_t alignment) {
+        void* ptr = m_Upstream.Allocate(size, alignment);
+        MemoryTracker::RecordAllocation(m_Tag, ptr, size);
+        return ptr;
+    }
+
+    void TrackingAllocator::Deallocate(
+        void* ptr, std::size_t size, std::size_t alignment) noexcept {
+        if (ptr == nullptr) {
+            return;
+        }
+        MemoryTracker::RecordDeallocation(m_Tag, ptr, size);
+        m_Upstream.Deallocate(ptr, size, alignment);
+    }
+} // namespace Astrelis
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "FrameArena.hpp"
+
+namespace Astrelis {
+    /// @brief The subsystem that owns an allocation, memory usage is accounted per tag, @see MemoryTracker
+    enum class MemoryTag : std::uint8_t {
+        General,
+        Renderer,
+        IO,
+        Editor,
+        Events
+    };
+
+    inline constexpr std::size_t MEMORY_TAG_COUNT = static_cast<std::size_t>(MemoryTag::Events) + 1;
+
+    [[nodiscard]] const char* GetMemoryTagName(MemoryTag tag) noexcept;
+
+    struct MemoryStats {
+        std::size_t   LiveBytes        = 0;
+        std::size_t   PeakBytes        = 0;
+        std::size_t   LiveAllocations  = 0;
+        std::uint64_t TotalAllocations = 0;
+    };
+
+    /// @brief Counts the memory allocated through tracking allocators, @see TrackingAllocator
+    /// With ASTRELIS_PROFILE_MEMORY, allocations are also reported to Tracy as a memory pool per tag, and the
+    /// live bytes of every tag are plotted once per frame.
+    class MemoryTracker {
+    public:
+        static void RecordAllocation(MemoryTag tag, void* ptr, std::size_t size) noexcept;
+        static void RecordDeallocation(MemoryTag tag, void* ptr, std::size_t size) noexcept;
+
+        [[nodiscard]] static MemoryStats GetStats(MemoryTag tag) noexcept;
+        static void                      PlotStats() noexcept;
+    };
+
+    /**
+    * @brief The allocator interface used by engine containers, @see StlAllocator
+    * Deallocate has to be called with the same size and alignment the memory was allocated with.
+    */
+    class Allocator {
+    public:
+        Allocator()                            = default;
+        virtual ~Allocator()                   = default;
+        Allocator(const Allocator&)            = delete;
+        Allocator& operator=(const Allocator&) = delete;
+        Allocator(Allocator&&)                 = delete;
+        Allocator& operator=(Allocator&&)      = delete;
+
+        /// @param alignment Must be a power of two
+        [[nodiscard]] virtual void* Allocate(
+            std::size_t size, std::size_t alignment = alignof(std::max_align_t)) = 0;
+        virtual void Deallocate(void* ptr, std::size_t size,
+            std::size_t alignment = alignof(std::max_align_t)) noexcept          = 0;
+
+        /// @brief The global heap, @see DefaultAllocator
+        [[nodiscard]] static Allocator& GetDefault();
+        /// @brief A tracking allocator over the global heap, shared by the whole subsystem
+        [[nodiscard]] static Allocator& GetTagged(MemoryTag tag);
+    };
+
+    /// @brief Allocates from the global heap, using the aligned operator new for over aligned memory
+    class DefaultAllocator final : public Allocator {
+    public:
+        [[nodiscard]] void* Allocate(std::size_t size, std::size_t alignment) override;
+        void Deallocate(void* ptr, std::size_t size, std::size_t alignment) noexcept override;
+    };
+
+    /**
+    * @brief Hands out blocks of a fixed size from chunks, which are kept until the pool is destroyed
+    * Allocating and freeing is a free list push or pop, which suits node based containers and objects that are
+    * created and destroyed often. It is not thread safe.
+    */
+    class PoolAllocator final : public Allocator {
+    public:
+        explicit PoolAllocator(std::size_t blockSize, std::size_t blocksPerChunk = 256,
+            Allocator& upstream = GetDefault());
+        ~PoolAllocator() override;
+        PoolAllocator(const PoolAllocator&)            = delete;
+        PoolAllocator& operator=(const PoolAllocator&) = delete;
+        PoolAllocator(PoolAllocator&&)                 = delete;
+        PoolAllocator& operator=(PoolAllocator&&)      = delete;
+
+        /// @note The size and alignment can not be larger than the block
+        [[nodiscard]] void* Allocate(std::size_t size, std::size_t alignment) override;
+        void Deallocate(void* ptr, std::size_t size, std::size_t alignment) noexcept override;
+
+        [[nodiscard]] std::size_t GetBlockSize() const noexcept {
+            return m_BlockSize;
+        }
+
+        [[nodiscard]] std::size_t GetChunkCount() const noexcept {
+            return m_Chunks.size();
+        }
+    private:
+        struct FreeBlock {
+            FreeBlock* Next;
+        };
+
+        std::size_t        m_BlockSize;
+        std::size_t        m_BlocksPerChunk;
+        Allocator&         m_Upstream;
+        FreeBlock*         m_FreeList = nullptr;
+        std::vector<void*> m_Chunks;
+    };
+
+    /// @brief Allocates from a linear arena, deallocating does nothing, the memory is freed when the arena is reset
+    class LinearAllocator final : public Allocator {
+    public:
+        explicit LinearAllocator(LinearArena& arena) noexcept : m_Arena(arena) {
+        }
+
+        [[nodiscard]] void* Allocate(std::size_t size, std::size_t alignment) override {
+            return m_Arena.Allocate(size, alignment);
+        }
+
+        void Deallocate(void* ptr, std::size_t size, std::size_t alignment) noexcept override {
+            (void)ptr;
+            (void)size;
+            (void)alignment;
+        }
+    private:
+        LinearArena& m_Arena;
+    };
+
+    /// @brief Forwards to another allocator, and accounts the memory to a tag, @see MemoryTracker
+    class TrackingAllocator final : public Allocator {
+    public:
+        explicit TrackingAllocator(MemoryTag tag, Allocator& upstream = GetDefault()) noexcept
+            : m_Tag(tag), m_Upstream(upstream) {
+        }
+
+        [[nodiscard]] void* Allocate(std::size_t size, std::size_t alignment) override;
+        void Deallocate(void* ptr, std::size_t size, std::size_t alignment) noexcept override;
+
+        [[nodiscard]] MemoryTag GetTag() const noexcept {
+            return m_Tag;
+        }
+    private:
+        MemoryTag  m_Tag;
+        Allocator& m_Upstream;
+    };
+
+    /// @brief Adapts an Allocator to the standard allocator interface, so containers can use it
+    template<typename T> class StlAllocator {
+    public:
+        using value_type = T;
+
+        explicit StlAllocator(Allocator& allocator) noexcept : m_Allocator(&allocator) {
+        }
+
+        /// @brief Allocates from the shared tracking allocator of the tag
+        explicit StlAllocator(MemoryTag tag) : m_Allocator(&Allocator::GetTagged(tag)) {
+        }
+
+        template<typename U>
+        // NOLINTNEXTLINE(google-explicit-constructor) Containers rebind allocators implicitly
+        StlAllocator(const StlAllocator<U>& other) noexcept : m_Allocator(&other.GetAllocator()) {
+        }
+
+        [[nodiscard]] T* allocate(std::size_t count) {
+            return static_cast<T*>(m_Allocator->Allocate(count * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T* pointer, std::size_t count) noexcept {
+            m_Allocator->Deallocate(pointer, count * sizeof(T), alignof(T));
+        }
+
+        [[nodiscard]] Allocator& GetAllocator() const noexcept {
+            return *m_Allocator;
+        }
+
+        template<typename U> bool operator==(const StlAllocator<U>& other) const noexcept {
+            return m_Allocator == &other.GetAllocator();
+        }
+    private:
+        Allocator* m_Allocator;
+    };
+} // namespace Astrelis
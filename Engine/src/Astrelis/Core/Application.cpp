@@ -2,14 +2,19 @@
 
 #include "Astrelis/Core/Base.hpp"
 
+#include "Astrelis/Core/Allocator.hpp"
 #include "Astrelis/Core/GlobalConfig.hpp"
 #include "Astrelis/Events/WindowEvent.hpp"
 #include "Astrelis/IO/File.hpp"
+#include "Astrelis/Renderer/RendererAPI.hpp"
 #include "Astrelis/UI/ImGui/ImGuiBackend.hpp"
 #include "Astrelis/UI/ImGui/ImGuiLayer.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <csignal>
 #include <filesystem>
+#include <span>
 #include <utility>
 
 #include "Time.hpp"
@@ -48,6 +53,31 @@ namespace Astrelis {
             "Failed to register signal handler for SIGBREAK");
 #endif
 
+        ASTRELIS_CORE_ASSERT(
+            m_Specification.FixedUpdateRate > 0.0, "Fixed update rate must be positive");
+        ASTRELIS_CORE_ASSERT(m_Specification.MaxFixedUpdatesPerFrame > 0,
+            "At least one fixed update per frame is needed, or fixed updates never run");
+        // Release builds do not assert, they run with the smallest cap that still steps
+        m_Specification.MaxFixedUpdatesPerFrame =
+            std::max(m_Specification.MaxFixedUpdatesPerFrame, 1U);
+        Time::s_FixedDeltaTime =
+            Seconds(std::chrono::duration<double>(1.0 / m_Specification.FixedUpdateRate));
+        Time::s_FrameStats = &m_FrameStats;
+        Time::s_Timers     = &m_Timers;
+        Input::s_State     = &m_Input;
+        // One frame more than the render thread can lag behind, so data used by a packet outlives it
+        m_FrameArena.Init(RendererAPI::GetBufferingCount() + 1);
+        FrameAllocator::s_Arena = &m_FrameArena;
+
+        if (m_Specification.HitchThreshold > 0.0) {
+            m_FrameStats.SetHitchThreshold(Milliseconds(
+                std::chrono::duration<double, std::milli>(m_Specification.HitchThreshold)));
+            m_FrameStats.SetHitchCallback([](const FrameSample& sample) {
+                ASTRELIS_CORE_LOG_WARN(
+                    "Frame {0} took {1:.2f}ms", sample.FrameIndex, sample.FrameTimeMs);
+            });
+        }
+
         // First we chdir into the working directory
         if (!m_Specification.WorkingDirectory.empty()) {
             File workingDir(m_Specification.WorkingDirectory);
@@ -61,10 +91,37 @@ namespace Astrelis {
             }
         }
 
+        if (!m_Specification.ReplayEventLog.empty()) {
+            ASTRELIS_CORE_ASSERT(m_Specification.RecordEventLog.empty(),
+                "Can not record and replay an event log at the same time");
+            auto res = EventLog::Load(m_Specification.ReplayEventLog);
+            if (res.IsErr()) {
+                ASTRELIS_LOG_ERROR("Failed to load event log: {0}", res.UnwrapErr());
+                status = CreationStatus::EVENT_LOG_LOAD_FAILED;
+                return;
+            }
+            m_EventLog = std::move(res.Unwrap());
+        }
+
+        {
+            ASTRELIS_PROFILE_SCOPE("Setup JobSystem");
+            StartupTrace::Scope phase(m_StartupTrace, "JobSystem");
+            if (!m_JobSystem.Init(m_Specification.JobWorkerCount)) {
+                ASTRELIS_LOG_ERROR("Failed to start JobSystem worker threads");
+                status = CreationStatus::JOB_SYSTEM_CREATION_FAILED;
+                return;
+            }
+            ASTRELIS_CORE_LOG_DEBUG(
+                "JobSystem started with {0} workers", m_JobSystem.GetWorkerCount());
+        }
+
         {
             ASTRELIS_PROFILE_SCOPE("Setup Window");
+            StartupTrace::Scope phase(m_StartupTrace, "Window");
             ASTRELIS_CORE_ASSERT(!m_Specification.Name.empty(), "Application name cannot be empty");
-            auto res = Window::Create(WindowProps(m_Specification.Name));
+            WindowProps props(m_Specification.Name);
+            props.Headless = m_Specification.Headless;
+            auto res       = Window::Create(props);
             if (res.IsErr()) {
                 ASTRELIS_LOG_ERROR("Failed to create window: {0}", res.UnwrapErr());
                 status = CreationStatus::WINDOW_CREATION_FAILED;
@@ -73,21 +130,43 @@ namespace Astrelis {
 
             m_Window = std::move(res.Unwrap());
             ASTRELIS_CORE_ASSERT(m_Window != nullptr, "Window is nullptr, but no error was thrown");
-            m_Window->SetEventCallback(ASTRELIS_BIND_EVENT_FN(Application::OnEvent));
+            m_Window->SetEventQueue(m_EventQueue);
         }
+
+        if (m_Specification.Headless) {
+            // No render system, ImGui or render thread, layers only get updates and events
+            ASTRELIS_CORE_LOG_INFO("Application running headless");
+            status = CreationStatus::SUCCESS;
+            return;
+        }
+
+        // The ImGui context and font atlas do not depend on the graphics context
+        JobCounter imguiContext;
+        m_JobSystem.Schedule(
+            [this]() {
+                StartupTrace::Scope phase(m_StartupTrace, "ImGui Context");
+                ImGuiLayer::CreateContext();
+            },
+            &imguiContext);
+
         {
             ASTRELIS_PROFILE_SCOPE("Setup RenderSystem");
+            StartupTrace::Scope phase(m_StartupTrace, "RenderSystem");
             m_RenderSystem = RenderSystem::Create(m_Window);
             auto res       = m_RenderSystem->Init();
             if (res.IsErr()) {
                 ASTRELIS_LOG_ERROR("Failed to initialize RenderSystem: {0}", res.UnwrapErr());
                 status = CreationStatus::RENDER_SYSTEM_CREATION_FAILED;
+                m_JobSystem.Wait(imguiContext);
+                ImGui::DestroyContext();
                 return;
             }
         }
 
         {
             ASTRELIS_PROFILE_SCOPE("Setup ImGuiLayer");
+            m_JobSystem.Wait(imguiContext);
+            StartupTrace::Scope phase(m_StartupTrace, "ImGuiLayer");
             // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
             OwnedPtr<ImGuiLayer*> imguiLayer(new ImGuiLayer(ImGuiBackend::Create(m_Window)));
             m_ImGuiLayer = imguiLayer.Raw();
@@ -96,6 +175,23 @@ namespace Astrelis {
             status = CreationStatus::SUCCESS;
         }
 
+        if (m_Specification.PipelinedRendering) {
+            ASTRELIS_PROFILE_SCOPE("Setup RenderThread");
+            StartupTrace::Scope phase(m_StartupTrace, "RenderThread");
+            if (RendererAPI::GetBufferingCount() < 2) {
+                ASTRELIS_CORE_LOG_WARN(
+                    "Pipelined rendering requires double buffering, rendering on the main thread");
+            }
+            else if ((ImGui::GetIO().ConfigFlags & ImGuiConfigFlags_ViewportsEnable) != 0) {
+                // Platform windows are rendered from the main thread
+                ASTRELIS_CORE_LOG_WARN(
+                    "Pipelined rendering does not support ImGui viewports, rendering on the main thread");
+            }
+            else {
+                m_RenderThread.Init(RendererAPI::GetBufferingCount());
+            }
+        }
+
         ASTRELIS_CORE_LOG_INFO("Application created successfully");
         ASTRELIS_CORE_LOG_DEBUG("Using Astrelis version: {0}", ASTRELIS_VERSION_STRING);
     }
@@ -111,10 +207,18 @@ namespace Astrelis {
             "Failed to disable signal handler for SIGBREAK");
 #endif
 
-        m_RenderSystem->Shutdown();
+        m_RenderThread.Shutdown();
+        if (m_RenderSystem != nullptr) {
+            m_RenderSystem->Shutdown();
+        }
         for (auto& layer : m_LayerStack) {
             layer->OnDetach();
         }
+        m_JobSystem.Shutdown();
+        Time::s_FrameStats      = nullptr;
+        Time::s_Timers          = nullptr;
+        Input::s_State          = nullptr;
+        FrameAllocator::s_Arena = nullptr;
         // Deinit logger, restarting the app is undefined behaviour
         Log::SetInitialized(false);
     }
@@ -122,7 +226,8 @@ namespace Astrelis {
     void Application::Run() {
         ASTRELIS_CORE_VERIFY(m_Running, "Application is not running");
         ASTRELIS_CORE_VERIFY(m_Window != nullptr, "Window is nullptr");
-        ASTRELIS_CORE_VERIFY(m_RenderSystem != nullptr, "RenderSystem is nullptr");
+        ASTRELIS_CORE_VERIFY(
+            m_Specification.Headless || m_RenderSystem != nullptr, "RenderSystem is nullptr");
 
         if (GlobalConfig::IsDebugMode()) {
             if (m_LayerStack.Size() == 0) {
@@ -131,27 +236,117 @@ namespace Astrelis {
             }
         }
 
+        const bool replaying = !m_Specification.ReplayEventLog.empty();
+        const bool recording = !m_Specification.RecordEventLog.empty();
+        Seconds    replayTime;
+
+        m_StartupTrace.Finish();
+        m_StartupTrace.Log();
+        if (!m_Specification.StartupTracePath.empty()) {
+            auto res = m_StartupTrace.WriteCSV(m_Specification.StartupTracePath);
+            if (res.IsErr()) {
+                ASTRELIS_LOG_ERROR("Failed to write startup trace: {0}", res.UnwrapErr());
+            }
+        }
+
         TimePoint appStartTime  = Time::Now();
         TimePoint lastFrameTime = appStartTime;
         while (m_Running) {
             ASTRELIS_PROFILE_SCOPE("Run Frame");
+            m_FrameArena.BeginFrame();
             Time::s_DeltaTime = Time::ElapsedTime<Milliseconds>(lastFrameTime, Time::Now());
             lastFrameTime     = Time::Now();
             Time::s_TimeSinceAppStart =
                 Time::ElapsedTime<Milliseconds>(appStartTime, lastFrameTime);
 
-            m_Window->BeginFrame();
+            if (replaying) {
+                if (m_ReplayFrame >= m_EventLog.GetFrameCount()) {
+                    ASTRELIS_CORE_LOG_INFO("Replayed {0} frames", m_ReplayFrame);
+                    break;
+                }
+
+                // Layers see the recorded time, not the time the replay takes
+                Time::s_DeltaTime = m_Specification.ReplayFrameTime > 0.0
+                    ? Milliseconds(std::chrono::duration<double, std::milli>(
+                        m_Specification.ReplayFrameTime))
+                    : m_EventLog.GetDeltaTime(m_ReplayFrame);
+                replayTime                = replayTime + Time::s_DeltaTime;
+                Time::s_TimeSinceAppStart = replayTime;
+            }
+            else if (recording) {
+                m_EventLog.BeginFrame(Time::s_DeltaTime);
+            }
 
-            m_RenderSystem->StartGraphicsRenderPass();
             {
-                ASTRELIS_PROFILE_SCOPE("Update Layers");
-                for (auto& layer : m_LayerStack) {
-                    layer->OnUpdate();
-                }
+                ASTRELIS_PROFILE_SCOPE("Update Timers");
+                m_Timers.Advance(Time::s_DeltaTime);
+            }
+
+            if (m_Specification.UseFixedTimestep) {
+                RunFixedUpdates();
+            }
+
+            if (m_Specification.Headless) {
+                RunHeadlessFrame();
+            }
+            else {
+                RunFrame();
             }
+
+            m_FrameStats.EndFrame(Time::ElapsedTime<Milliseconds>(lastFrameTime, Time::Now()));
+            MemoryTracker::PlotStats();
+            ASTRELIS_PROFILE_END_FRAME();
+        }
+
+        m_RenderThread.WaitIdle();
+
+        if (recording) {
+            auto res = m_EventLog.Save(m_Specification.RecordEventLog);
+            if (res.IsErr()) {
+                ASTRELIS_LOG_ERROR("Failed to save event log: {0}", res.UnwrapErr());
+            }
+            else {
+                ASTRELIS_CORE_LOG_INFO("Recorded {0} frames and {1} events to {2}",
+                    m_EventLog.GetFrameCount(), m_EventLog.GetEventCount(),
+                    m_Specification.RecordEventLog);
+            }
+        }
+    }
+
+    void Application::RunFrame() {
+        // GLFW can only be used on the main thread, so the framebuffer is queried here, and the
+        // render thread only recreates the swapchain with the size it is given
+        const Rect2Di viewport = m_Window->GetViewportBounds();
+        if (viewport.Width() <= 0 || viewport.Height() <= 0) {
+            // Minimized, nothing can be presented until the window is restored
+            m_Window->WaitForEvents();
+            PollEvents();
+            return;
+        }
+
+        const Dimension2Du framebufferSize(static_cast<std::uint32_t>(viewport.Width()),
+            static_cast<std::uint32_t>(viewport.Height()));
+        // Without a render thread, the submitted commands are executed immediately
+        RenderThread::Submit([this, framebufferSize]() {
+            {
+                FramePhaseScope phase(m_FrameStats, FramePhase::FenceWait);
+                m_Window->GetGraphicsContext()->SetFramebufferSize(framebufferSize);
+                m_Window->BeginFrame();
+            }
+            FramePhaseScope phase(m_FrameStats, FramePhase::Record);
+            m_RenderSystem->StartGraphicsRenderPass();
+        });
+        UpdateLayers();
+        RenderThread::Submit([this]() {
+            FramePhaseScope phase(m_FrameStats, FramePhase::Record);
             m_RenderSystem->EndGraphicsRenderPass();
             m_RenderSystem->BlitSwapchain();
+        });
 
+        // ImGui draw data is not double buffered, the previous packet has to be consumed first
+        m_RenderThread.WaitIdle();
+        {
+            FramePhaseScope phase(m_FrameStats, FramePhase::UI);
             m_ImGuiLayer->Begin();
 
             {
@@ -162,30 +357,123 @@ namespace Astrelis {
             }
 
             m_ImGuiLayer->End();
+        }
 
-            m_RenderSystem->EndFrame();
-
+        RenderThread::Submit([this]() {
+            {
+                FramePhaseScope phase(m_FrameStats, FramePhase::Record);
+                m_RenderSystem->EndFrame();
+            }
+            FramePhaseScope phase(m_FrameStats, FramePhase::Present);
             m_Window->EndFrame();
-            m_Window->OnUpdate();
+        });
+        if (m_RenderThread.IsRunning()) {
+            m_RenderThread.Kick();
+        }
 
-            ASTRELIS_PROFILE_END_FRAME();
+        PollEvents();
+    }
+
+    void Application::RunHeadlessFrame() {
+        UpdateLayers();
+        PollEvents();
+    }
+
+    void Application::PollEvents() {
+        m_Window->OnUpdate();
+
+        ASTRELIS_PROFILE_SCOPE("Dispatch Events");
+        const EventCallback dispatch = [this](Event& event) { DispatchEvent(event); };
+        // Motion and scrolling only update the input state, they are dispatched once per frame
+        auto process = [this, &dispatch](const EventRecord& record) {
+            if (m_Input.Consume(record)) {
+                record.Dispatch(dispatch);
+            }
+        };
+
+        m_EventQueue.Drain([this, &process](const EventRecord& record) {
+            if (OnEvent(record)) {
+                process(record);
+            }
+        });
+        const std::uint64_t droppedEvents = m_EventQueue.GetDroppedCount();
+        if (droppedEvents != m_ReportedDroppedEvents) {
+            ASTRELIS_CORE_LOG_WARN("EventQueue was full, dropped {0} events",
+                droppedEvents - m_ReportedDroppedEvents);
+            m_ReportedDroppedEvents = droppedEvents;
+        }
+
+        if (!m_Specification.ReplayEventLog.empty()) {
+            for (const EventRecord& record : m_EventLog.GetEvents(m_ReplayFrame++)) {
+                // Window events come from the live window, the swapchain has to match its surface
+                if (record.IsInCategory(EventCategory::Input)) {
+                    process(record);
+                }
+            }
         }
+
+        m_Input.DispatchCoalesced(dispatch);
+        m_Input.EndFrame();
+    }
+
+    void Application::UpdateLayers() {
+        ASTRELIS_PROFILE_SCOPE("Update Layers");
+        FramePhaseScope phase(m_FrameStats, FramePhase::Update);
+        std::span<OwnedPtr<Layer*>> layers(m_LayerStack.begin(), m_LayerStack.end());
+        const std::size_t           layerCount = m_LayerStack.GetLayerCount();
+
+        // Overlays are never updated in parallel with the layers below them
+        m_LayerScheduler.Build(layers.first(layerCount));
+        m_LayerScheduler.Update(m_JobSystem);
+        m_LayerScheduler.Build(layers.subspan(layerCount));
+        m_LayerScheduler.Update(m_JobSystem);
+    }
+
+    void Application::RunFixedUpdates() {
+        ASTRELIS_PROFILE_SCOPE("Fixed Update Layers");
+        FramePhaseScope phase(m_FrameStats, FramePhase::Update);
+        const double fixedDeltaTime = Time::FixedDeltaTime();
+        m_FixedTimeAccumulator += Time::DeltaTime();
+
+        std::uint32_t updates = 0;
+        while (m_FixedTimeAccumulator >= fixedDeltaTime
+            && updates < m_Specification.MaxFixedUpdatesPerFrame) {
+            for (auto& layer : m_LayerStack) {
+                layer->OnFixedUpdate();
+            }
+            m_FixedTimeAccumulator -= fixedDeltaTime;
+            updates++;
+        }
+
+        if (m_FixedTimeAccumulator >= fixedDeltaTime) {
+            // We can't catch up, drop the whole steps but keep the phase of the remainder
+            ASTRELIS_CORE_LOG_TRACE("Dropped {0} fixed updates",
+                static_cast<std::uint64_t>(m_FixedTimeAccumulator / fixedDeltaTime));
+            m_FixedTimeAccumulator = std::fmod(m_FixedTimeAccumulator, fixedDeltaTime);
+        }
+
+        Time::s_InterpolationAlpha = m_FixedTimeAccumulator / fixedDeltaTime;
+    }
+
+    bool Application::OnEvent(const EventRecord& record) {
+        if (!m_Specification.ReplayEventLog.empty()) {
+            // The replay is the only source of input, window events stay live
+            return !record.IsInCategory(EventCategory::Input);
+        }
+
+        if (!m_Specification.RecordEventLog.empty()) {
+            m_EventLog.Record(record);
+        }
+        return true;
     }
 
-    void Application::OnEvent(Event& event) {
+    void Application::DispatchEvent(Event& event) {
         EventDispatcher dispatcher(event);
         dispatcher.Dispatch<WindowCloseEvent>(ASTRELIS_BIND_EVENT_FN(Application::OnWindowClose));
         dispatcher.Dispatch<ViewportResizedEvent>(
             ASTRELIS_BIND_EVENT_FN(Application::OnViewportResize));
 
-        for (auto it = m_LayerStack.end(); it != m_LayerStack.begin();) {
-            if (event.Handled) {
-                break;
-            }
-
-            ASTRELIS_CORE_ASSERT(*it != nullptr, "Layer is nullptr");
-            (*--it)->OnEvent(event);
-        }
+        m_EventSubscribers.Dispatch(event);
     }
 
     bool Application::OnWindowClose(WindowCloseEvent& event) {
@@ -195,31 +483,57 @@ namespace Astrelis {
     }
 
     bool Application::OnViewportResize(ViewportResizedEvent& event) {
-        ASTRELIS_UNUSED(this, event);
+        ASTRELIS_UNUSED(event);
+        // Resizing recreates swapchain resources, which the render thread could be using
+        m_RenderThread.WaitIdle();
         return false;
     }
 
     void Application::PushLayer(OwnedPtr<Layer*> layer) {
         ASTRELIS_PROFILE_FUNCTION();
-        layer->OnAttach();
+        AttachLayer(*layer);
         m_LayerStack.PushLayer(std::move(layer));
+        RebuildEventSubscribers();
     }
 
     void Application::PushOverlay(OwnedPtr<Layer*> overlay) {
         ASTRELIS_PROFILE_FUNCTION();
-        overlay->OnAttach();
+        AttachLayer(*overlay);
         m_LayerStack.PushOverlay(std::move(overlay));
+        RebuildEventSubscribers();
+    }
+
+    void Application::AttachLayer(Layer& layer) {
+        // Layers create their renderer resources on attach, which needs an idle render thread
+        m_RenderThread.WaitIdle();
+        if (m_StartupTrace.IsFinished()) {
+            layer.OnAttach();
+            return;
+        }
+
+        StartupTrace::Scope phase(m_StartupTrace, "Attach " + layer.GetName());
+        layer.OnAttach();
     }
 
     OwnedPtr<Layer*> Application::PopLayer(RawRef<Layer*> layer) {
         ASTRELIS_PROFILE_FUNCTION();
+        m_RenderThread.WaitIdle();
         layer->OnDetach();
-        return m_LayerStack.PopLayer(std::move(layer));
+        OwnedPtr<Layer*> popped = m_LayerStack.PopLayer(std::move(layer));
+        RebuildEventSubscribers();
+        return popped;
     }
 
     OwnedPtr<Layer*> Application::PopOverlay(RawRef<Layer*> overlay) {
         ASTRELIS_PROFILE_FUNCTION();
         overlay->OnDetach();
-        return m_LayerStack.PopOverlay(std::move(overlay));
+        OwnedPtr<Layer*> popped = m_LayerStack.PopOverlay(std::move(overlay));
+        RebuildEventSubscribers();
+        return popped;
+    }
+
+    void Application::RebuildEventSubscribers() {
+        m_EventSubscribers.Build(
+            std::span<OwnedPtr<Layer*>>(m_LayerStack.begin(), m_LayerStack.end()));
     }
 } // namespace Astrelis
@@ -1,15 +1,26 @@
 #pragma once
 
+#include "Astrelis/Events/EventLog.hpp"
+#include "Astrelis/Events/EventQueue.hpp"
 #include "Astrelis/Events/WindowEvent.hpp"
 #include "Astrelis/Renderer/RenderSystem.hpp"
+#include "Astrelis/Renderer/RenderThread.hpp"
 #include "Astrelis/UI/ImGui/ImGuiLayer.hpp"
 
 #include <atomic>
 #include <string>
 #include <vector>
 
+#include "EventSubscriberTable.hpp"
+#include "FrameArena.hpp"
+#include "FrameStats.hpp"
+#include "Input.hpp"
+#include "Jobs/JobSystem.hpp"
+#include "LayerScheduler.hpp"
 #include "LayerStack.hpp"
 #include "Pointer.hpp"
+#include "StartupTrace.hpp"
+#include "TimerWheel.hpp"
 #include "Window.hpp"
 
 int AstrelisMain(int argc, char** argv);
@@ -57,12 +68,68 @@ namespace Astrelis {
         */
         std::string          WorkingDirectory;
         CommandLineArguments Arguments;
+        /**
+         * @brief The number of job system workers (including the main thread), 0 uses one worker per hardware thread
+        */
+        std::uint32_t JobWorkerCount = 0;
+        /**
+         * @brief Runs Layer::OnFixedUpdate at FixedUpdateRate, independent of the frame rate
+         * Rendering can use Time::InterpolationAlpha to blend between the last two fixed updates.
+        */
+        bool UseFixedTimestep = false;
+        /**
+         * @brief The number of fixed updates per second
+        */
+        double FixedUpdateRate = 60.0;
+        /**
+         * @brief The maximum number of fixed updates in a single frame, any remaining time is dropped
+         * This stops a long frame from causing even longer frames (spiral of death).
+         * Must be at least 1.
+        */
+        std::uint32_t MaxFixedUpdatesPerFrame = 5;
+        /**
+         * @brief Records and submits rendering on a render thread, while the next frame is simulated
+         * The frames in flight are bounded by RendererAPI::GetBufferingMode, and this falls back to
+         * rendering on the main thread with single buffering. Render work must go through RenderThread::Submit.
+        */
+        bool PipelinedRendering = false;
+        /**
+         * @brief Runs without a native window, render system or ImGui, for machines without a display or GPU
+         * Layers are updated as fast as possible, OnUIRender is never called and GetRenderSystem returns nullptr.
+        */
+        bool Headless = false;
+        /**
+         * @brief Frames that take longer than this many milliseconds are logged as hitches, 0 disables the warning
+         * Use FrameStats::SetHitchCallback for custom handling, @see Time::GetFrameStats
+        */
+        double HitchThreshold = 0.0;
+        /**
+         * @brief Records the frame times and all dispatched events into this file, @see EventLog
+        */
+        std::string RecordEventLog;
+        /**
+         * @brief Replays an event log instead of live input, and closes the application when the log ends
+         * Only the recorded input is replayed, window events like resizes still come from the live window.
+         * Together with Headless this gives repeatable runs for frame time benchmarks.
+        */
+        std::string ReplayEventLog;
+        /**
+         * @brief The frame time in milliseconds reported while replaying, 0 uses the recorded frame times
+         * A fixed frame time runs the replay as a throughput benchmark.
+        */
+        double ReplayFrameTime = 0.0;
+        /**
+         * @brief Writes the startup trace to this file as CSV when the main loop starts, @see StartupTrace
+        */
+        std::string StartupTracePath;
     };
 
     enum class CreationStatus : std::uint16_t {
         SUCCESS                       = 0,
         WINDOW_CREATION_FAILED        = 1,
-        RENDER_SYSTEM_CREATION_FAILED = 2
+        RENDER_SYSTEM_CREATION_FAILED = 2,
+        JOB_SYSTEM_CREATION_FAILED    = 3,
+        EVENT_LOG_LOAD_FAILED         = 4
     };
 
     /// @brief The main application of Astrelis, including the core logic of the engine, and window lifetimes
@@ -70,7 +137,15 @@ namespace Astrelis {
     /// - m_IsRunning - Whether the application is running
     /// - m_Specification - The application specification
     /// - m_LayerStack - The layer stack of the application, @see LayerStack
+    /// - m_EventSubscribers - The layers subscribed to each event type, rebuilt when the layer stack changes, @see EventSubscriberTable
     /// - m_ImGuiLayer - The ImGui layer, which is always on top of the layer stack, @see ImGuiLayer
+    /// - m_JobSystem - The job system shared by layers, renderers and asset loading, @see JobSystem
+    /// - m_StartupTrace - The duration of every startup phase, until the main loop starts, @see StartupTrace
+    /// - m_FrameStats - Rolling frame time statistics, @see Time::GetFrameStats
+    /// - m_FrameArena - Per thread scratch memory for transient per frame data, @see FrameAllocator
+    /// - m_Timers - Scheduled callbacks, advanced every frame before the layers update, @see Time::GetTimers
+    /// - m_EventQueue - Events posted by the window and other threads, dispatched once per frame, @see EventQueue
+    /// - m_Input - The keyboard and mouse snapshot built from the dispatched events, @see Input
     /// And also per window state information:
     /// - m_Window - The window of the application, see @see Window
     ///  @note You can create your own windows in your own layers, but the application is designed to have a main window, with a render system, @see RenderSystem
@@ -109,10 +184,33 @@ namespace Astrelis {
             return m_RenderSystem;
         }
 
+        JobSystem& GetJobSystem() {
+            return m_JobSystem;
+        }
+
+        /// @brief Events can be posted into the queue from any thread, they are dispatched at the end of the frame
+        EventQueue& GetEventQueue() {
+            return m_EventQueue;
+        }
+
+        /// @brief Records the startup phases of engine systems, and of layers that are attached before Run
+        StartupTrace& GetStartupTrace() {
+            return m_StartupTrace;
+        }
+
         const ApplicationSpecification& GetSpecification() const {
             return m_Specification;
         }
 
+        bool IsHeadless() const {
+            return m_Specification.Headless;
+        }
+
+        /// @brief Stops the application at the end of the current frame
+        void Close() {
+            m_Running = false;
+        }
+
         /// Gets the application instance, which should be a singleton. The program will crash and throw an error if more than 1 application is created and not destroyed.
         static Application& Get() {
             return *s_Instance;
@@ -135,7 +233,12 @@ namespace Astrelis {
         /// The owner is transfered back to the owner, which means that the user will need to handle the destruction. @see OwnedPtr
         [[nodiscard]] OwnedPtr<Layer*> PopOverlay(RawRef<Layer*> overlay);
 
-        void OnEvent(Event& event);
+        /// Records a queued event, or drops it if it is an input event during a replay
+        /// @return Whether the event should be dispatched
+        bool OnEvent(const EventRecord& record);
+        void DispatchEvent(Event& event);
+        void AttachLayer(Layer& layer);
+        void RebuildEventSubscribers();
         bool OnWindowClose(WindowCloseEvent& event);
         bool OnViewportResize(ViewportResizedEvent& event);
 
@@ -143,19 +246,49 @@ namespace Astrelis {
         /// The gameloop outlines these steps:
         ///  - Check if the window is closed / application is closed.
         ///  - Begin the frame using the graphics context, this can initialize per farme components, acquire frames, or clear the screen.
+        ///  - Fire the timers that expired, @see TimerWheel
+        ///  - Run the fixed updates of all layers, if the fixed timestep is enabled
         ///  - Update all of the layers
         ///  - Update all of the overlays (after all the layers)
         ///  - End the frame (submit render commands, etc..)
-        ///  - Query user input
+        ///  - Poll user input, and dispatch the queued events
+        /// With pipelined rendering, the render commands of a frame are recorded into a RenderPacket, which is
+        /// executed on the render thread while the next frame is updated.
+        /// Headless applications only run the (fixed) updates of the layers, as fast as possible.
         void Run();
+        /// Runs as many fixed updates as have accumulated since the last frame, capped by MaxFixedUpdatesPerFrame
+        void RunFixedUpdates();
+        /// Runs a frame of a windowed application, timing each FramePhase
+        void RunFrame();
+        /// Updates the layers of a headless application, there is no frame to begin, render or present
+        void RunHeadlessFrame();
+        /// Polls the window events, and dispatches the queued events and the events of the replayed frame
+        /// The events also update the input snapshot, which is published for the next frame
+        void PollEvents();
+        /// Updates the layers and then the overlays, layers that declare their data access are updated in parallel
+        void UpdateLayers();
 
         static Application*      s_Instance;
         ApplicationSpecification m_Specification;
         std::atomic_bool         m_Running = true;
+        StartupTrace             m_StartupTrace;
+        JobSystem                m_JobSystem;
+        FrameStats               m_FrameStats;
+        TimerWheel               m_Timers;
+        FrameArena               m_FrameArena;
         RefPtr<Window>           m_Window;
         RefPtr<RenderSystem>     m_RenderSystem;
+        RenderThread             m_RenderThread;
         LayerStack               m_LayerStack;
+        LayerScheduler           m_LayerScheduler;
+        EventSubscriberTable     m_EventSubscribers;
         RawRef<ImGuiLayer*>      m_ImGuiLayer;
+        double                   m_FixedTimeAccumulator = 0.0;
+        EventQueue               m_EventQueue;
+        std::uint64_t            m_ReportedDroppedEvents = 0;
+        InputState               m_Input;
+        EventLog                 m_EventLog;
+        std::size_t              m_ReplayFrame = 0;
     };
 
     /// @brief Define this function in your application to create an instance of your Application class, extending the base class
@@ -0,0 +1,33 @@
+#include "EventSubscriberTable.hpp"
+
+#include "Astrelis/Core/Base.hpp"
+
+namespace Astrelis {
+    void EventSubscriberTable::Build(std::span<OwnedPtr<Layer*>> layers) {
+        ASTRELIS_PROFILE_FUNCTION();
+        for (auto& subscribers : m_Subscribers) {
+            subscribers.clear();
+        }
+
+        // Events are dispatched from the top of the stack down
+        for (auto it = layers.rbegin(); it != layers.rend(); ++it) {
+            ASTRELIS_CORE_ASSERT(*it != nullptr, "Layer is nullptr");
+            Layer* layer = it->Get();
+            for (std::size_t type = 0; type < m_Subscribers.size(); type++) {
+                if (layer->IsSubscribedTo(static_cast<EventType>(type))) {
+                    m_Subscribers[type].push_back(layer);
+                }
+            }
+        }
+    }
+
+    void EventSubscriberTable::Dispatch(Event& event) const {
+        for (Layer* layer : GetSubscribers(event.GetEventType())) {
+            if (event.Handled) {
+                break;
+            }
+
+            layer->OnEvent(event);
+        }
+    }
+} // namespace Astrelis
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Astrelis/Core/Pointer.hpp"
+#include "Astrelis/Events/Event.hpp"
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "Layer.hpp"
+
+namespace Astrelis {
+    /// @brief Per event type lists of the layers that subscribed to it, @see Layer::SubscribeEvents
+    /// Dispatching an event only visits the layers that are interested in its type, instead of the whole layer
+    /// stack. The lists keep the dispatch order of the layer stack, the top layer receives the event first.
+    class EventSubscriberTable {
+    public:
+        EventSubscriberTable()                                       = default;
+        ~EventSubscriberTable()                                      = default;
+        EventSubscriberTable(const EventSubscriberTable&)            = delete;
+        EventSubscriberTable& operator=(const EventSubscriberTable&) = delete;
+        EventSubscriberTable(EventSubscriberTable&&)                 = delete;
+        EventSubscriberTable& operator=(EventSubscriberTable&&)      = delete;
+
+        /// @brief Rebuilds the lists from the subscriptions of the layers, ordered from the bottom of the stack
+        /// This is done whenever a layer is pushed or popped, so the layers must stay alive until the next build.
+        void Build(std::span<OwnedPtr<Layer*>> layers);
+        /// @brief Passes the event to the subscribers of its type, until one of them handles it
+        void Dispatch(Event& event) const;
+
+        [[nodiscard]] std::span<Layer* const> GetSubscribers(EventType type) const {
+            const auto index = static_cast<std::size_t>(type);
+            if (index >= m_Subscribers.size()) {
+                return {};
+            }
+            return m_Subscribers[index];
+        }
+    private:
+        std::array<std::vector<Layer*>, EVENT_TYPE_COUNT> m_Subscribers;
+    };
+} // namespace Astrelis
@@ -0,0 +1,97 @@
+#include "FrameArena.hpp"
+
+#include "Astrelis/Core/Base.hpp"
+
+#include <algorithm>
+
+namespace Astrelis {
+    FrameArena* FrameAllocator::s_Arena = nullptr;
+
+    namespace {
+        std::atomic<std::uint64_t> s_NextArenaId = 1;
+    } // namespace
+
+    void* LinearArena::Allocate(std::size_t size, std::size_t alignment) {
+        ASTRELIS_CORE_ASSERT(alignment != 0 && (alignment & (alignment - 1)) == 0,
+            "Alignment must be a power of two");
+        while (m_CurrentBlock < m_Blocks.size()) {
+            Block&            block = m_Blocks[m_CurrentBlock];
+            const std::size_t address =
+                reinterpret_cast<std::uintptr_t>(block.Memory.get()) + m_Offset;
+            const std::size_t padding = (alignment - (address & (alignment - 1))) & (alignment - 1);
+            if (padding + size <= block.Size - m_Offset) {
+                void* memory = block.Memory.get() + m_Offset + padding;
+                m_Offset += padding + size;
+                m_UsedBytes += padding + size;
+                return memory;
+            }
+
+            // The rest of the block is wasted until the next reset
+            m_CurrentBlock++;
+            m_Offset = 0;
+        }
+
+        // Only happens until the arena has grown to the peak usage
+        ASTRELIS_PROFILE_SCOPE("LinearArena Grow");
+        const std::size_t blockSize = std::max(m_BlockSize, size + alignment);
+        m_Blocks.push_back(
+            Block {std::make_unique_for_overwrite<std::byte[]>(blockSize), blockSize});
+        m_CurrentBlock = m_Blocks.size() - 1;
+        m_Offset       = 0;
+        return Allocate(size, alignment);
+    }
+
+    FrameArena::FrameArena() noexcept : m_Id(s_NextArenaId.fetch_add(1)) {
+    }
+
+    void FrameArena::Init(std::uint32_t frameCount, std::size_t blockSize) {
+        ASTRELIS_CORE_ASSERT(frameCount > 0, "Frame arena needs at least one frame");
+        std::lock_guard lock(m_Mutex);
+        ASTRELIS_CORE_ASSERT(m_Threads.empty(), "Frame arena is already in use");
+        m_FrameCount = frameCount;
+        m_BlockSize  = blockSize;
+    }
+
+    LinearArena& FrameArena::GetThreadArena() {
+        ASTRELIS_CORE_ASSERT(m_FrameCount > 0, "Frame arena is not initialized");
+        thread_local std::uint64_t t_ArenaId = 0;
+        thread_local ThreadArenas* t_Arenas  = nullptr;
+        if (t_ArenaId != m_Id) {
+            t_Arenas  = &FindThread();
+            t_ArenaId = m_Id;
+        }
+
+        const std::uint64_t frame = GetFrame();
+        LinearArena&        arena = t_Arenas->Frames[frame % m_FrameCount];
+        if (t_Arenas->Frame != frame) {
+            // What this thread allocated in the slot is at least GetFrameCount frames old
+            t_Arenas->Frame = frame;
+            arena.Reset();
+        }
+        return arena;
+    }
+
+    std::size_t FrameArena::GetThreadCount() const {
+        std::lock_guard lock(m_Mutex);
+        return m_Threads.size();
+    }
+
+    FrameArena::ThreadArenas& FrameArena::FindThread() {
+        std::lock_guard lock(m_Mutex);
+        auto& arenas = m_Threads[std::this_thread::get_id()];
+        if (arenas == nullptr) {
+            arenas        = std::make_unique<ThreadArenas>();
+            arenas->Frame = GetFrame();
+            for (std::uint32_t i = 0; i < m_FrameCount; i++) {
+                arenas->Frames.emplace_back(m_BlockSize);
+            }
+        }
+        return *arenas;
+    }
+
+    FrameArena& FrameAllocator::GetArena() {
+        ASTRELIS_CORE_ASSERT(
+            s_Arena != nullptr, "Frame allocator is only available while an application runs");
+        return *s_Arena;
+    }
+} // namespace Astrelis
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Astrelis {
+    /// @brief A bump allocator over a chain of blocks, the memory is only freed all at once by Reset
+    /// Blocks are kept when the arena is reset, so once it has grown to the peak usage it no longer allocates.
+    /// Destructors are never run, only trivially destructible data or containers using ArenaAllocator belong here.
+    class LinearArena {
+    public:
+        static constexpr std::size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+        explicit LinearArena(std::size_t blockSize = DEFAULT_BLOCK_SIZE) noexcept
+            : m_BlockSize(blockSize) {
+        }
+
+        ~LinearArena()                             = default;
+        LinearArena(const LinearArena&)            = delete;
+        LinearArena& operator=(const LinearArena&) = delete;
+        LinearArena(LinearArena&&)                 = default;
+        LinearArena& operator=(LinearArena&&)      = default;
+
+        /// @param alignment Must be a power of two
+        [[nodiscard]] void* Allocate(
+            std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+        /// @brief Uninitialized storage for count objects of type T
+        template<typename T> [[nodiscard]] T* Allocate(std::size_t count = 1) {
+            return static_cast<T*>(Allocate(count * sizeof(T), alignof(T)));
+        }
+
+        /// @brief Makes all the memory available again, invalidating every allocation
+        void Reset() noexcept {
+            m_CurrentBlock = 0;
+            m_Offset       = 0;
+            m_UsedBytes    = 0;
+        }
+
+        /// @brief The bytes allocated since the last reset, including alignment padding
+        [[nodiscard]] std::size_t GetUsedBytes() const noexcept {
+            return m_UsedBytes;
+        }
+
+        [[nodiscard]] std::size_t GetBlockCount() const noexcept {
+            return m_Blocks.size();
+        }
+    private:
+        struct Block {
+            std::unique_ptr<std::byte[]> Memory;
+            std::size_t                  Size;
+        };
+
+        std::vector<Block> m_Blocks;
+        std::size_t        m_BlockSize;
+        std::size_t        m_CurrentBlock = 0;
+        std::size_t        m_Offset       = 0;
+        std::size_t        m_UsedBytes    = 0;
+    };
+
+    /// @brief Adapts a LinearArena to the standard allocator interface, deallocation does nothing
+    template<typename T> class ArenaAllocator {
+    public:
+        using value_type = T;
+
+        explicit ArenaAllocator(LinearArena& arena) noexcept : m_Arena(&arena) {
+        }
+
+        template<typename U>
+        // NOLINTNEXTLINE(google-explicit-constructor) Containers rebind allocators implicitly
+        ArenaAllocator(const ArenaAllocator<U>& other) noexcept : m_Arena(other.GetArena()) {
+        }
+
+        [[nodiscard]] T* allocate(std::size_t count) {
+            return m_Arena->Allocate<T>(count);
+        }
+
+        void deallocate(T* pointer, std::size_t count) noexcept {
+            // Memory is reclaimed when the arena is reset
+            (void)pointer;
+            (void)count;
+        }
+
+        [[nodiscard]] LinearArena* GetArena() const noexcept {
+            return m_Arena;
+        }
+
+        template<typename U> bool operator==(const ArenaAllocator<U>& other) const noexcept {
+            return m_Arena == other.GetArena();
+        }
+    private:
+        LinearArena* m_Arena;
+    };
+
+    template<typename T> using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+    /// @brief Scratch memory for transient per frame data, which never touches the heap once warmed up
+    /// Every thread gets its own ring of linear arenas, one per buffered frame, so allocating needs no locking.
+    /// A thread resets its arena for the frame on its first allocation in that frame, which keeps the memory
+    /// valid for GetFrameCount frames. The application uses one frame more than the render packets in flight, so
+    /// the render thread can read the memory while executing a packet. The GPU never reads arena memory directly,
+    /// anything it needs is copied into a buffer of the renderer first.
+    class FrameArena {
+    public:
+        FrameArena() noexcept;
+        ~FrameArena()                            = default;
+        FrameArena(const FrameArena&)            = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+        FrameArena(FrameArena&&)                 = delete;
+        FrameArena& operator=(FrameArena&&)      = delete;
+
+        /// @brief Must be called before any thread allocates
+        /// @param frameCount The number of frames an allocation stays valid, including the frame it was made in
+        void Init(
+            std::uint32_t frameCount, std::size_t blockSize = LinearArena::DEFAULT_BLOCK_SIZE);
+
+        /// @brief Moves every thread to the arena of the next frame, the application does this once per frame
+        void BeginFrame() noexcept {
+            m_Frame.fetch_add(1, std::memory_order_release);
+        }
+
+        /// @brief The arena of the calling thread for the current frame, the first call on a thread allocates it
+        [[nodiscard]] LinearArena& GetThreadArena();
+
+        template<typename T> [[nodiscard]] ArenaAllocator<T> GetAllocator() {
+            return ArenaAllocator<T>(GetThreadArena());
+        }
+
+        [[nodiscard]] std::uint64_t GetFrame() const noexcept {
+            return m_Frame.load(std::memory_order_acquire);
+        }
+
+        [[nodiscard]] std::uint32_t GetFrameCount() const noexcept {
+            return m_FrameCount;
+        }
+
+        /// @brief The number of threads that have allocated from the arena
+        [[nodiscard]] std::size_t GetThreadCount() const;
+    private:
+        struct ThreadArenas {
+            std::vector<LinearArena> Frames;
+            std::uint64_t            Frame = 0;
+        };
+
+        /// @brief The arenas of the calling thread, created on its first allocation
+        ThreadArenas& FindThread();
+
+        // Identifies the arena in the thread local cache, addresses can be reused
+        std::uint64_t              m_Id;
+        std::atomic<std::uint64_t> m_Frame      = 0;
+        std::uint32_t              m_FrameCount = 0;
+        std::size_t                m_BlockSize  = LinearArena::DEFAULT_BLOCK_SIZE;
+        mutable std::mutex         m_Mutex;
+        // The thread local cache only remembers the last arena, a thread switching between arenas
+        // finds its arenas here again instead of registering another set
+        std::unordered_map<std::thread::id, std::unique_ptr<ThreadArenas>> m_Threads;
+    };
+
+    /// @brief Allocates from the frame arena of the running application, @see FrameArena
+    /// The memory stays valid for RendererAPI::GetBufferingCount + 1 frames, it must not be freed or kept any longer.
+    class FrameAllocator {
+    public:
+        friend class Application;
+
+        [[nodiscard]] static void* Allocate(
+            std::size_t size, std::size_t alignment = alignof(std::max_align_t)) {
+            return GetArena().GetThreadArena().Allocate(size, alignment);
+        }
+
+        template<typename T> [[nodiscard]] static ArenaAllocator<T> Get() {
+            return GetArena().GetAllocator<T>();
+        }
+
+        static FrameArena& GetArena();
+    private:
+        static FrameArena* s_Arena;
+    };
+} // namespace Astrelis
@@ -0,0 +1,136 @@
+#include "FrameStats.hpp"
+
+#include "Astrelis/Core/Base.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <numeric>
+
+namespace Astrelis {
+    std::string_view FramePhaseToString(FramePhase phase) {
+        switch (phase) {
+        case FramePhase::Update:
+            return "Update";
+        case FramePhase::UI:
+            return "UI";
+        case FramePhase::Record:
+            return "Record";
+        case FramePhase::FenceWait:
+            return "FenceWait";
+        case FramePhase::Present:
+            return "Present";
+        }
+        return "Unknown";
+    }
+
+    void FrameStats::AddPhaseTime(FramePhase phase, Milliseconds time) noexcept {
+        auto nanoseconds = static_cast<std::uint64_t>(static_cast<double>(time) * 1'000'000.0);
+        m_PhaseTimes[static_cast<std::size_t>(phase)].fetch_add(
+            nanoseconds, std::memory_order_relaxed);
+    }
+
+    void FrameStats::EndFrame(Milliseconds frameTime) {
+        ASTRELIS_PROFILE_FUNCTION();
+        FrameSample& sample = m_History[m_FrameCount % HISTORY_SIZE];
+        if (m_FrameCount >= HISTORY_SIZE) {
+            // Evict the oldest sample from the histogram
+            m_Histogram[GetBucket(sample.FrameTimeMs)]--;
+        }
+
+        sample.FrameIndex  = m_FrameCount;
+        sample.FrameTimeMs = static_cast<float>(frameTime);
+        for (std::size_t phase = 0; phase < FRAME_PHASE_COUNT; phase++) {
+            auto nanoseconds = m_PhaseTimes[phase].exchange(0, std::memory_order_relaxed);
+            sample.PhaseTimesMs[phase] =
+                static_cast<float>(static_cast<double>(nanoseconds) / 1'000'000.0);
+        }
+        m_Histogram[GetBucket(sample.FrameTimeMs)]++;
+        m_FrameCount++;
+
+        if (m_HitchThreshold > 0.0F && sample.FrameTimeMs > m_HitchThreshold && m_HitchCallback) {
+            m_HitchCallback(sample);
+        }
+    }
+
+    FrameTimeSummary FrameStats::GetSummary() const {
+        return Summarize([](const FrameSample& sample) { return sample.FrameTimeMs; });
+    }
+
+    FrameTimeSummary FrameStats::GetPhaseSummary(FramePhase phase) const {
+        return Summarize([phase](const FrameSample& sample) {
+            return sample.PhaseTimesMs[static_cast<std::size_t>(phase)];
+        });
+    }
+
+    std::vector<FrameSample> FrameStats::GetSamples() const {
+        std::size_t              count = std::min<std::uint64_t>(m_FrameCount, HISTORY_SIZE);
+        std::vector<FrameSample> samples;
+        samples.reserve(count);
+        for (std::uint64_t frame = m_FrameCount - count; frame < m_FrameCount; frame++) {
+            samples.push_back(m_History[frame % HISTORY_SIZE]);
+        }
+        return samples;
+    }
+
+    Result<EmptyType, std::string> FrameStats::WriteCSV(const std::filesystem::path& path) const {
+        ASTRELIS_PROFILE_FUNCTION();
+        std::ofstream file(path);
+        if (!file.is_open()) {
+            return "Failed to open file for writing";
+        }
+
+        file << "Frame,FrameTimeMs";
+        for (std::size_t phase = 0; phase < FRAME_PHASE_COUNT; phase++) {
+            file << ',' << FramePhaseToString(static_cast<FramePhase>(phase)) << "Ms";
+        }
+        file << '\n';
+
+        for (const FrameSample& sample : GetSamples()) {
+            file << sample.FrameIndex << ',' << sample.FrameTimeMs;
+            for (float phaseTime : sample.PhaseTimesMs) {
+                file << ',' << phaseTime;
+            }
+            file << '\n';
+        }
+
+        if (!file.good()) {
+            return "Failed to write frame stats";
+        }
+        return Result<EmptyType, std::string>::Ok();
+    }
+
+    std::size_t FrameStats::GetBucket(float frameTimeMs) {
+        auto bucket = static_cast<std::size_t>(std::max(frameTimeMs, 0.0F) / HISTOGRAM_BUCKET_MS);
+        return std::min(bucket, HISTOGRAM_BUCKET_COUNT - 1);
+    }
+
+    FrameTimeSummary FrameStats::Summarize(
+        const std::function<float(const FrameSample&)>& value) const {
+        std::size_t count = std::min<std::uint64_t>(m_FrameCount, HISTORY_SIZE);
+        if (count == 0) {
+            return {};
+        }
+
+        // Sorting a copy of the history is fast enough for a query, and keeps EndFrame cheap
+        std::vector<float> values(count);
+        std::transform(m_History.begin(), m_History.begin() + static_cast<std::ptrdiff_t>(count),
+            values.begin(), value);
+        std::sort(values.begin(), values.end());
+
+        auto percentile = [&values](double fraction) {
+            auto index =
+                static_cast<std::size_t>(fraction * static_cast<double>(values.size() - 1));
+            return values[index];
+        };
+
+        FrameTimeSummary summary;
+        summary.P50         = percentile(0.50);
+        summary.P95         = percentile(0.95);
+        summary.P99         = percentile(0.99);
+        summary.Max         = values.back();
+        summary.Average     = std::accumulate(values.begin(), values.end(), 0.0F)
+            / static_cast<float>(values.size());
+        summary.SampleCount = count;
+        return summary;
+    }
+} // namespace Astrelis
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "Astrelis/Core/Result.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "Time.hpp"
+
+namespace Astrelis {
+    /// @brief The phases of a frame in Application::Run that are timed separately
+    enum class FramePhase : std::uint8_t {
+        Update,    // Fixed updates and layer updates
+        UI,        // ImGui frame and OnUIRender
+        Record,    // Recording the render pass and command buffers
+        FenceWait, // Waiting for the frame in flight, and acquiring the swapchain image
+        Present,   // Submitting and presenting the frame
+    };
+
+    inline constexpr std::size_t FRAME_PHASE_COUNT = 5;
+
+    std::string_view FramePhaseToString(FramePhase phase);
+
+    struct FrameSample {
+        std::uint64_t                        FrameIndex  = 0;
+        float                                FrameTimeMs = 0.0F;
+        std::array<float, FRAME_PHASE_COUNT> PhaseTimesMs {};
+    };
+
+    struct FrameTimeSummary {
+        float       P50         = 0.0F;
+        float       P95         = 0.0F;
+        float       P99         = 0.0F;
+        float       Max         = 0.0F;
+        float       Average     = 0.0F;
+        std::size_t SampleCount = 0;
+    };
+
+    /**
+    * @brief Rolling frame time statistics of the last HISTORY_SIZE frames
+    * The application ends a frame sample every frame, with the phase times that were added during that frame.
+    * Phase times can be added from any thread, as the render thread times the phases it executes, in which case
+    * they are accounted to the frame that was being updated when the render thread finished them.
+    */
+    class FrameStats {
+    public:
+        static constexpr std::size_t HISTORY_SIZE = 1024;
+        /// @brief The width of a histogram bucket, the last bucket holds all longer frames
+        static constexpr float       HISTOGRAM_BUCKET_MS    = 1.0F;
+        static constexpr std::size_t HISTOGRAM_BUCKET_COUNT = 100;
+
+        using HitchCallback = std::function<void(const FrameSample&)>;
+
+        FrameStats()                             = default;
+        ~FrameStats()                            = default;
+        FrameStats(const FrameStats&)            = delete;
+        FrameStats& operator=(const FrameStats&) = delete;
+        FrameStats(FrameStats&&)                 = delete;
+        FrameStats& operator=(FrameStats&&)      = delete;
+
+        /// @brief Adds time spent in a phase to the current frame, can be called from any thread
+        void AddPhaseTime(FramePhase phase, Milliseconds time) noexcept;
+        /// @brief Records the current frame, and calls the hitch callback if it took longer than the threshold
+        void EndFrame(Milliseconds frameTime);
+
+        /// @brief The hitch callback is called on the main thread when a frame exceeds the threshold, 0 disables it
+        void SetHitchThreshold(Milliseconds threshold) {
+            m_HitchThreshold = static_cast<float>(threshold);
+        }
+
+        void SetHitchCallback(HitchCallback callback) {
+            m_HitchCallback = std::move(callback);
+        }
+
+        [[nodiscard]] FrameTimeSummary GetSummary() const;
+        [[nodiscard]] FrameTimeSummary GetPhaseSummary(FramePhase phase) const;
+
+        /// @brief The number of frames in the history per bucket of HISTOGRAM_BUCKET_MS
+        [[nodiscard]] const std::array<std::uint32_t, HISTOGRAM_BUCKET_COUNT>&
+            GetHistogram() const {
+            return m_Histogram;
+        }
+
+        /// @brief The samples in the history, from oldest to newest
+        [[nodiscard]] std::vector<FrameSample> GetSamples() const;
+
+        [[nodiscard]] std::uint64_t GetFrameCount() const noexcept {
+            return m_FrameCount;
+        }
+
+        /// @brief Writes the samples in the history as CSV, one frame per row
+        Result<EmptyType, std::string> WriteCSV(const std::filesystem::path& path) const;
+    private:
+        static std::size_t GetBucket(float frameTimeMs);
+        FrameTimeSummary   Summarize(const std::function<float(const FrameSample&)>& value) const;
+
+        std::array<FrameSample, HISTORY_SIZE>             m_History {};
+        std::array<std::uint32_t, HISTOGRAM_BUCKET_COUNT> m_Histogram {};
+        std::uint64_t                                     m_FrameCount = 0;
+        // Phase times of the current frame in nanoseconds, integers so they can be added atomically
+        std::array<std::atomic<std::uint64_t>, FRAME_PHASE_COUNT> m_PhaseTimes {};
+
+        float         m_HitchThreshold = 0.0F;
+        HitchCallback m_HitchCallback;
+    };
+
+    /// @brief Adds the lifetime of the scope to a phase of the current frame
+    class FramePhaseScope {
+    public:
+        FramePhaseScope(FrameStats& stats, FramePhase phase) : m_Stats(stats), m_Phase(phase) {
+        }
+
+        ~FramePhaseScope() {
+            m_Stats.AddPhaseTime(m_Phase, Time::ElapsedTime<Milliseconds>(m_Start, Time::Now()));
+        }
+
+        FramePhaseScope(const FramePhaseScope&)            = delete;
+        FramePhaseScope& operator=(const FramePhaseScope&) = delete;
+        FramePhaseScope(FramePhaseScope&&)                 = delete;
+        FramePhaseScope& operator=(FramePhaseScope&&)      = delete;
+    private:
+        FrameStats& m_Stats;
+        FramePhase  m_Phase;
+        TimePoint   m_Start;
+    };
+} // namespace Astrelis
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace Astrelis {
+    /**
+    * @brief A reference to an object owned by a SlotMap, the index of its slot and the generation of the slot
+    * The generation changes every time the slot is freed, so a handle to a destroyed object is detected instead of
+    * referring to whatever reuses the slot. The type parameter only keeps handles of different types apart.
+    * @see SlotMap
+    */
+    template<typename T> struct Handle {
+        std::uint32_t Index      = 0;
+        std::uint32_t Generation = 0;
+
+        /// @brief Whether the handle was ever assigned, it can still be stale
+        [[nodiscard]] bool IsValid() const noexcept {
+            return Generation != 0;
+        }
+
+        bool operator==(const Handle& other) const noexcept = default;
+    };
+} // namespace Astrelis
+
+template<typename T> struct std::hash<Astrelis::Handle<T>> {
+    std::size_t operator()(const Astrelis::Handle<T>& handle) const noexcept {
+        return std::hash<std::uint64_t> {}(
+            (static_cast<std::uint64_t>(handle.Generation) << 32U) | handle.Index);
+    }
+};
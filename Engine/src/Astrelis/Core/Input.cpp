@@ -0,0 +1,102 @@
+#include "Input.hpp"
+
+#include "Astrelis/Core/Base.hpp"
+
+namespace Astrelis {
+    InputState* Input::s_State = nullptr;
+
+    namespace {
+        template<std::size_t N>
+        void SetButton(
+            std::bitset<N>& down, std::bitset<N>& edge, std::uint32_t index, bool value) {
+            if (index >= N) {
+                // Keys that GLFW does not know are reported as -1
+                return;
+            }
+
+            down.set(index, value);
+            edge.set(index);
+        }
+    } // namespace
+
+    bool InputState::Consume(const EventRecord& record) {
+        InputSnapshot& snapshot = GetWriteSnapshot();
+        switch (record.Type) {
+        case EventType::KeyPressed:
+            // Repeats do not change the state
+            if (record.Data1 == 0) {
+                SetButton(snapshot.KeysDown, snapshot.KeysPressed, record.Data0, true);
+            }
+            return true;
+        case EventType::KeyReleased:
+            SetButton(snapshot.KeysDown, snapshot.KeysReleased, record.Data0, false);
+            return true;
+        case EventType::MouseButtonPressed:
+            SetButton(snapshot.ButtonsDown, snapshot.ButtonsPressed, record.Data0, true);
+            return true;
+        case EventType::MouseButtonReleased:
+            SetButton(snapshot.ButtonsDown, snapshot.ButtonsReleased, record.Data0, false);
+            return true;
+        case EventType::MouseMoved: {
+            const Vec2f position(record.GetFloat0(), record.GetFloat1());
+            if (m_HasMousePosition) {
+                snapshot.MouseDelta += position - snapshot.MousePosition;
+            }
+            snapshot.MousePosition = position;
+            m_HasMousePosition     = true;
+            m_MouseMoved           = true;
+            return false;
+        }
+        case EventType::MouseScrolled:
+            snapshot.ScrollDelta += Vec2f(record.GetFloat0(), record.GetFloat1());
+            m_Scrolled = true;
+            return false;
+        case EventType::WindowLostFocus:
+            // Releases while the window is not focused are never reported
+            snapshot.KeysReleased |= snapshot.KeysDown;
+            snapshot.ButtonsReleased |= snapshot.ButtonsDown;
+            snapshot.KeysDown.reset();
+            snapshot.ButtonsDown.reset();
+            return true;
+        default:
+            return true;
+        }
+    }
+
+    void InputState::DispatchCoalesced(const EventCallback& callback) const {
+        const InputSnapshot& snapshot = GetWriteSnapshot();
+        if (m_MouseMoved) {
+            EventRecord::CreateFloat(
+                EventType::MouseMoved, snapshot.MousePosition[0], snapshot.MousePosition[1])
+                .Dispatch(callback);
+        }
+
+        if (m_Scrolled) {
+            EventRecord::CreateFloat(
+                EventType::MouseScrolled, snapshot.ScrollDelta[0], snapshot.ScrollDelta[1])
+                .Dispatch(callback);
+        }
+    }
+
+    void InputState::EndFrame() {
+        m_ReadIndex = 1 - m_ReadIndex;
+
+        // The held keys and the position carry over, the edges and deltas are per frame
+        InputSnapshot& next = GetWriteSnapshot();
+        next                = GetSnapshot();
+        next.KeysPressed.reset();
+        next.KeysReleased.reset();
+        next.ButtonsPressed.reset();
+        next.ButtonsReleased.reset();
+        next.MouseDelta  = Vec2f(0.0F);
+        next.ScrollDelta = Vec2f(0.0F);
+        m_MouseMoved     = false;
+        m_Scrolled       = false;
+    }
+
+    const InputSnapshot& Input::GetSnapshot() {
+        ASTRELIS_CORE_ASSERT(
+            s_State != nullptr, "Input is only available while an application runs");
+        return s_State->GetSnapshot();
+    }
+} // namespace Astrelis
@@ -0,0 +1,143 @@
+#pragma once
+
+#include "Astrelis/Events/EventRecord.hpp"
+#include "Astrelis/Events/KeyEvent.hpp"
+#include "Astrelis/Events/MouseEvent.hpp"
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+
+#include "Math.hpp"
+
+namespace Astrelis {
+    inline constexpr std::size_t KEY_CODE_COUNT = static_cast<std::size_t>(KeyCode::Menu) + 1;
+    inline constexpr std::size_t MOUSE_CODE_COUNT =
+        static_cast<std::size_t>(MouseCode::ButtonLast) + 1;
+
+    /// @brief The keyboard and mouse state at the end of a frame
+    struct InputSnapshot {
+        std::bitset<KEY_CODE_COUNT> KeysDown;
+        // Keys that went down or up during the frame, a key can be in both if it was tapped quickly
+        std::bitset<KEY_CODE_COUNT>   KeysPressed;
+        std::bitset<KEY_CODE_COUNT>   KeysReleased;
+        std::bitset<MOUSE_CODE_COUNT> ButtonsDown;
+        std::bitset<MOUSE_CODE_COUNT> ButtonsPressed;
+        std::bitset<MOUSE_CODE_COUNT> ButtonsReleased;
+        Vec2f                         MousePosition;
+        // The motion and scrolling summed over the frame
+        Vec2f MouseDelta;
+        Vec2f ScrollDelta;
+
+        [[nodiscard]] bool IsKeyDown(KeyCode key) const {
+            return Test(KeysDown, static_cast<std::size_t>(key));
+        }
+
+        [[nodiscard]] bool IsKeyPressed(KeyCode key) const {
+            return Test(KeysPressed, static_cast<std::size_t>(key));
+        }
+
+        [[nodiscard]] bool IsKeyReleased(KeyCode key) const {
+            return Test(KeysReleased, static_cast<std::size_t>(key));
+        }
+
+        [[nodiscard]] bool IsMouseButtonDown(MouseCode button) const {
+            return Test(ButtonsDown, static_cast<std::size_t>(button));
+        }
+
+        [[nodiscard]] bool IsMouseButtonPressed(MouseCode button) const {
+            return Test(ButtonsPressed, static_cast<std::size_t>(button));
+        }
+
+        [[nodiscard]] bool IsMouseButtonReleased(MouseCode button) const {
+            return Test(ButtonsReleased, static_cast<std::size_t>(button));
+        }
+    private:
+        template<std::size_t N> static bool Test(const std::bitset<N>& bits, std::size_t index) {
+            return index < N && bits.test(index);
+        }
+    };
+
+    /// @brief Builds the input snapshot of a frame from the queued events
+    /// Mouse motion and scrolling are coalesced, they only update the snapshot while the events are drained, and
+    /// are dispatched once per frame with the final position and the summed offset. Key and mouse button events are
+    /// still dispatched as they arrive. The snapshot is double buffered, layers read the snapshot of the last
+    /// frame while the next one is built.
+    class InputState {
+    public:
+        /// @brief Updates the snapshot that is being built with the event
+        /// @return false if the event was coalesced and should not be dispatched on its own
+        bool Consume(const EventRecord& record);
+        /// @brief Dispatches a single MouseMoved and MouseScrolled event, if there was any motion or scrolling
+        void DispatchCoalesced(const EventCallback& callback) const;
+        /// @brief Publishes the snapshot that was built, and starts building the next one
+        void EndFrame();
+
+        /// @brief The snapshot of the last frame
+        [[nodiscard]] const InputSnapshot& GetSnapshot() const noexcept {
+            return m_Snapshots[m_ReadIndex];
+        }
+    private:
+        InputSnapshot& GetWriteSnapshot() noexcept {
+            return m_Snapshots[1 - m_ReadIndex];
+        }
+
+        const InputSnapshot& GetWriteSnapshot() const noexcept {
+            return m_Snapshots[1 - m_ReadIndex];
+        }
+
+        std::array<InputSnapshot, 2> m_Snapshots;
+        std::size_t                  m_ReadIndex        = 0;
+        bool                         m_MouseMoved       = false;
+        bool                         m_Scrolled         = false;
+        bool                         m_HasMousePosition = false;
+    };
+
+    /// @brief Polls the keyboard and mouse state of the running application, @see InputSnapshot
+    /// The state is updated once per frame after the events are dispatched, so it is safe to read from layers
+    /// that update in parallel.
+    class Input {
+    public:
+        friend class Application;
+
+        static bool IsKeyDown(KeyCode key) {
+            return GetSnapshot().IsKeyDown(key);
+        }
+
+        static bool IsKeyPressed(KeyCode key) {
+            return GetSnapshot().IsKeyPressed(key);
+        }
+
+        static bool IsKeyReleased(KeyCode key) {
+            return GetSnapshot().IsKeyReleased(key);
+        }
+
+        static bool IsMouseButtonDown(MouseCode button) {
+            return GetSnapshot().IsMouseButtonDown(button);
+        }
+
+        static bool IsMouseButtonPressed(MouseCode button) {
+            return GetSnapshot().IsMouseButtonPressed(button);
+        }
+
+        static bool IsMouseButtonReleased(MouseCode button) {
+            return GetSnapshot().IsMouseButtonReleased(button);
+        }
+
+        static Vec2f GetMousePosition() {
+            return GetSnapshot().MousePosition;
+        }
+
+        static Vec2f GetMouseDelta() {
+            return GetSnapshot().MouseDelta;
+        }
+
+        static Vec2f GetScrollDelta() {
+            return GetSnapshot().ScrollDelta;
+        }
+
+        static const InputSnapshot& GetSnapshot();
+    private:
+        static InputState* s_State;
+    };
+} // namespace Astrelis
@@ -0,0 +1,241 @@
+#include "JobSystem.hpp"
+
+#include "Astrelis/Core/Base.hpp"
+
+#include <string>
+
+namespace Astrelis {
+    namespace {
+        // Identifies the worker that the current thread belongs to
+        thread_local const JobSystem* t_JobSystem   = nullptr;
+        thread_local std::uint32_t    t_WorkerIndex = JobSystem::INVALID_WORKER;
+    } // namespace
+
+    JobSystem::~JobSystem() {
+        Shutdown();
+    }
+
+    bool JobSystem::Init(std::uint32_t workerCount) {
+        ASTRELIS_PROFILE_FUNCTION();
+        if (IsInitialized()) {
+            return true;
+        }
+
+        if (workerCount == 0) {
+            workerCount = std::max(1U, std::thread::hardware_concurrency());
+        }
+
+        m_Workers.reserve(workerCount);
+        for (std::uint32_t i = 0; i < workerCount; i++) {
+            m_Workers.emplace_back(ScopedPtr<Worker>::Create());
+        }
+
+        t_JobSystem   = this;
+        t_WorkerIndex = 0;
+        m_Running     = true;
+
+        try {
+            for (std::uint32_t i = 1; i < workerCount; i++) {
+                m_Workers[i]->Thread = std::thread([this, i]() { WorkerLoop(i); });
+            }
+        }
+        catch (const std::system_error& error) {
+            ASTRELIS_UNUSED(error);
+            Shutdown();
+            return false;
+        }
+        return true;
+    }
+
+    void JobSystem::Shutdown() {
+        ASTRELIS_PROFILE_FUNCTION();
+        if (!IsInitialized()) {
+            return;
+        }
+
+        // Finish whatever is still queued, jobs may reference state that is about to be destroyed
+        while (m_PendingJobs.load(std::memory_order_acquire) > 0) {
+            if (!TryExecuteJob(0)) {
+                std::this_thread::yield();
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_SleepMutex);
+            m_Running = false;
+        }
+        m_SleepCondition.notify_all();
+
+        for (auto& worker : m_Workers) {
+            if (worker->Thread.joinable()) {
+                worker->Thread.join();
+            }
+        }
+        m_Workers.clear();
+
+        if (t_JobSystem == this) {
+            t_JobSystem   = nullptr;
+            t_WorkerIndex = INVALID_WORKER;
+        }
+    }
+
+    void JobSystem::Schedule(JobFunction function, JobCounter* counter) {
+        ASTRELIS_CORE_ASSERT(IsInitialized(), "JobSystem is not initialized");
+        std::uint32_t workerIndex = GetCurrentWorkerIndex();
+        ASTRELIS_CORE_ASSERT(workerIndex != INVALID_WORKER,
+            "Jobs can only be scheduled from the main thread or other jobs");
+
+        Job* job = AllocateJob(workerIndex);
+        if (job == nullptr) {
+            // Every slot is still queued or running, run the job inline rather than overwriting one
+            function();
+            return;
+        }
+
+        job->Function   = std::move(function);
+        job->Counter    = counter;
+        job->Dependency = nullptr;
+        Submit(workerIndex, job);
+    }
+
+    void JobSystem::ScheduleAfter(
+        const JobCounter& dependency, JobFunction function, JobCounter* counter) {
+        ASTRELIS_CORE_ASSERT(IsInitialized(), "JobSystem is not initialized");
+        std::uint32_t workerIndex = GetCurrentWorkerIndex();
+        ASTRELIS_CORE_ASSERT(workerIndex != INVALID_WORKER,
+            "Jobs can only be scheduled from the main thread or other jobs");
+
+        Job* job = AllocateJob(workerIndex);
+        if (job == nullptr) {
+            Wait(dependency);
+            function();
+            return;
+        }
+
+        job->Function   = std::move(function);
+        job->Counter    = counter;
+        job->Dependency = &dependency;
+        Submit(workerIndex, job);
+    }
+
+    void JobSystem::Wait(const JobCounter& counter) {
+        ASTRELIS_PROFILE_FUNCTION();
+        std::uint32_t workerIndex = GetCurrentWorkerIndex();
+        while (!counter.IsDone()) {
+            if (workerIndex == INVALID_WORKER || !TryExecuteJob(workerIndex)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    std::uint32_t JobSystem::GetCurrentWorkerIndex() const noexcept {
+        return t_JobSystem == this ? t_WorkerIndex : INVALID_WORKER;
+    }
+
+    Job* JobSystem::AllocateJob(std::uint32_t workerIndex) {
+        // Only the owning thread allocates from its pool, so a free slot stays free until it is marked.
+        // Jobs mostly finish in the order they were scheduled, so the next slot of the ring is usually free.
+        Worker& worker = *m_Workers[workerIndex];
+        for (std::size_t i = 0; i < MAX_JOBS_PER_WORKER; i++) {
+            Job* job       = &worker.JobPool[worker.NextJob];
+            worker.NextJob = (worker.NextJob + 1) % MAX_JOBS_PER_WORKER;
+            if (!job->InUse.load(std::memory_order_acquire)) {
+                job->InUse.store(true, std::memory_order_relaxed);
+                return job;
+            }
+        }
+        return nullptr;
+    }
+
+    void JobSystem::Submit(std::uint32_t workerIndex, Job* job) {
+        if (job->Counter != nullptr) {
+            job->Counter->m_Count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        if (!m_Workers[workerIndex]->Queue.Push(job)) {
+            // Queue is full, run the job inline rather than dropping it
+            if (job->Dependency != nullptr) {
+                Wait(*job->Dependency);
+            }
+            m_PendingJobs.fetch_add(1, std::memory_order_seq_cst);
+            Execute(job);
+            return;
+        }
+
+        m_PendingJobs.fetch_add(1, std::memory_order_seq_cst);
+        m_SubmittedJobs.fetch_add(1, std::memory_order_seq_cst);
+        if (m_SleepingWorkers.load(std::memory_order_seq_cst) > 0) {
+            // Taking the lock guarantees the sleeper is either waiting, or will see the new job
+            std::lock_guard<std::mutex> lock(m_SleepMutex);
+            m_SleepCondition.notify_one();
+        }
+    }
+
+    Job* JobSystem::FindJob(std::uint32_t workerIndex) {
+        if (auto job = m_Workers[workerIndex]->Queue.Pop()) {
+            return *job;
+        }
+
+        auto workerCount = static_cast<std::uint32_t>(m_Workers.size());
+        for (std::uint32_t offset = 1; offset < workerCount; offset++) {
+            std::uint32_t victim = (workerIndex + offset) % workerCount;
+            if (auto job = m_Workers[victim]->Queue.Steal()) {
+                return *job;
+            }
+        }
+        return nullptr;
+    }
+
+    bool JobSystem::TryExecuteJob(std::uint32_t workerIndex) {
+        Job* job = FindJob(workerIndex);
+        if (job == nullptr) {
+            return false;
+        }
+
+        if (job->Dependency != nullptr && !job->Dependency->IsDone()) {
+            // Not ready yet, help executing other jobs (most likely the dependency) until it is
+            Wait(*job->Dependency);
+        }
+
+        Execute(job);
+        return true;
+    }
+
+    void JobSystem::Execute(Job* job) {
+        ASTRELIS_PROFILE_SCOPE("Execute Job");
+        job->Function();
+        job->Function = nullptr;
+
+        JobCounter* counter = job->Counter;
+        // The slot can be reused by its owner as soon as this is cleared
+        job->InUse.store(false, std::memory_order_release);
+        if (counter != nullptr) {
+            counter->m_Count.fetch_sub(1, std::memory_order_acq_rel);
+        }
+        m_PendingJobs.fetch_sub(1, std::memory_order_release);
+    }
+
+    void JobSystem::WorkerLoop(std::uint32_t workerIndex) {
+        t_JobSystem   = this;
+        t_WorkerIndex = workerIndex;
+        std::string threadName = "Job Worker " + std::to_string(workerIndex);
+        ASTRELIS_PROFILE_THREAD(threadName.c_str());
+
+        while (m_Running.load(std::memory_order_acquire)) {
+            const std::uint32_t submitted = m_SubmittedJobs.load(std::memory_order_seq_cst);
+            if (TryExecuteJob(workerIndex)) {
+                continue;
+            }
+
+            // Pending jobs that could not be found are already running on other workers, so only a newly
+            // submitted job gives this worker something to do
+            std::unique_lock<std::mutex> lock(m_SleepMutex);
+            m_SleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+            m_SleepCondition.wait(lock, [this, submitted]() {
+                return !m_Running.load(std::memory_order_relaxed)
+                    || m_SubmittedJobs.load(std::memory_order_seq_cst) != submitted;
+            });
+            m_SleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+} // namespace Astrelis
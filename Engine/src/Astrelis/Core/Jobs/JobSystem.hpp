@@ -0,0 +1,149 @@
+#pragma once
+
+#include "Astrelis/Core/Pointer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "WorkStealingQueue.hpp"
+
+namespace Astrelis {
+    /// @brief A counter that tracks the number of unfinished jobs associated with it
+    /// Jobs can be waited on through the counter (@see JobSystem::Wait), or be used as a dependency of other jobs.
+    /// @note The counter must outlive all of the jobs that reference it
+    class JobCounter {
+    public:
+        JobCounter()                             = default;
+        ~JobCounter()                            = default;
+        JobCounter(const JobCounter&)            = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+        JobCounter(JobCounter&&)                 = delete;
+        JobCounter& operator=(JobCounter&&)      = delete;
+
+        [[nodiscard]] bool IsDone() const noexcept {
+            return m_Count.load(std::memory_order_acquire) == 0;
+        }
+
+        [[nodiscard]] std::uint32_t GetValue() const noexcept {
+            return m_Count.load(std::memory_order_acquire);
+        }
+    private:
+        friend class JobSystem;
+
+        std::atomic<std::uint32_t> m_Count = 0;
+    };
+
+    using JobFunction = std::function<void()>;
+
+    struct Job {
+        JobFunction       Function;
+        JobCounter*       Counter    = nullptr;
+        const JobCounter* Dependency = nullptr;
+        /// @brief Set while the job is queued or running, the pool slot is only reused once it is cleared
+        std::atomic_bool InUse = false;
+    };
+
+    /// @brief A work stealing job system, with one worker per hardware thread
+    /// The thread that calls Init (the main thread) is worker 0, and takes part in executing jobs while waiting.
+    /// Each worker owns a work stealing deque, idle workers steal from the other workers before going to sleep.
+    /// @note Jobs can only be scheduled from the main thread, or from inside other jobs
+    class JobSystem {
+    public:
+        /// @brief The maximum number of jobs in flight per worker, jobs are allocated from a pool of this size
+        /// When a worker has this many unfinished jobs, further jobs it schedules run inline on the scheduling thread.
+        static constexpr std::size_t   MAX_JOBS_PER_WORKER = 4096;
+        static constexpr std::uint32_t INVALID_WORKER      = UINT32_MAX;
+
+        JobSystem() = default;
+        ~JobSystem();
+        JobSystem(const JobSystem&)            = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+        JobSystem(JobSystem&&)                 = delete;
+        JobSystem& operator=(JobSystem&&)      = delete;
+
+        /// @brief Starts the worker threads, the calling thread becomes worker 0
+        /// @param workerCount The total number of workers including the calling thread, 0 uses the hardware concurrency
+        bool Init(std::uint32_t workerCount = 0);
+        /// @brief Finishes all of the pending jobs, and joins the worker threads
+        void Shutdown();
+
+        /// @brief Schedules a job to be executed by any worker
+        /// @param counter An optional counter, which is incremented now and decremented when the job finishes
+        void Schedule(JobFunction function, JobCounter* counter = nullptr);
+        /// @brief Schedules a job that will only start once the dependency counter reaches zero
+        void ScheduleAfter(
+            const JobCounter& dependency, JobFunction function, JobCounter* counter = nullptr);
+
+        /// @brief Blocks until the counter reaches zero, executing other jobs while waiting
+        void Wait(const JobCounter& counter);
+
+        /// @brief Splits [0, count) into batches, and calls function(begin, end) for each batch in parallel
+        /// This blocks until all batches have been executed.
+        /// @param batchSize The number of elements per job, 0 picks a batch size based on the worker count
+        template<typename Fn>
+        void ParallelFor(std::size_t count, std::size_t batchSize, Fn&& function) {
+            if (count == 0) {
+                return;
+            }
+
+            if (batchSize == 0) {
+                // A few batches per worker, so that stealing can even out the load
+                batchSize = std::max<std::size_t>(1, count / (GetWorkerCount() * 4));
+            }
+
+            if (count <= batchSize || !IsInitialized()) {
+                function(std::size_t {0}, count);
+                return;
+            }
+
+            JobCounter counter;
+            for (std::size_t begin = 0; begin < count; begin += batchSize) {
+                std::size_t end = std::min(begin + batchSize, count);
+                Schedule([&function, begin, end]() { function(begin, end); }, &counter);
+            }
+            Wait(counter);
+        }
+
+        /// @brief The number of workers, including the main thread
+        [[nodiscard]] std::uint32_t GetWorkerCount() const noexcept {
+            return static_cast<std::uint32_t>(m_Workers.size());
+        }
+
+        [[nodiscard]] bool IsInitialized() const noexcept {
+            return !m_Workers.empty();
+        }
+
+        /// @brief The index of the worker running on the calling thread, or INVALID_WORKER if it is not a worker of this system
+        [[nodiscard]] std::uint32_t GetCurrentWorkerIndex() const noexcept;
+    private:
+        struct Worker {
+            WorkStealingQueue<Job*, MAX_JOBS_PER_WORKER> Queue;
+            std::array<Job, MAX_JOBS_PER_WORKER>         JobPool;
+            std::size_t                                  NextJob = 0;
+            std::thread                                  Thread;
+        };
+
+        /// @return nullptr if all of the jobs in the pool of the worker are still in use
+        Job* AllocateJob(std::uint32_t workerIndex);
+        void Submit(std::uint32_t workerIndex, Job* job);
+        Job* FindJob(std::uint32_t workerIndex);
+        bool TryExecuteJob(std::uint32_t workerIndex);
+        void Execute(Job* job);
+        void WorkerLoop(std::uint32_t workerIndex);
+
+        std::vector<ScopedPtr<Worker>> m_Workers;
+        std::atomic_bool               m_Running         = false;
+        std::atomic<std::uint32_t>     m_PendingJobs     = 0;
+        std::atomic<std::uint32_t>     m_SubmittedJobs   = 0;
+        std::atomic<std::uint32_t>     m_SleepingWorkers = 0;
+        std::mutex                     m_SleepMutex;
+        std::condition_variable        m_SleepCondition;
+    };
+} // namespace Astrelis
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+namespace Astrelis {
+    /// @brief A fixed capacity Chase-Lev work stealing deque
+    /// The owning thread pushes and pops from the bottom (LIFO, cache friendly), while any other
+    /// thread can steal from the top (FIFO). Only trivially copyable items (pointers) are supported.
+    /// @tparam T The item type, usually a pointer to a job
+    /// @tparam Capacity The capacity of the queue, must be a power of two
+    template<typename T, std::size_t Capacity> class WorkStealingQueue {
+        static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+        static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+    public:
+        WorkStealingQueue()                                    = default;
+        ~WorkStealingQueue()                                   = default;
+        WorkStealingQueue(const WorkStealingQueue&)            = delete;
+        WorkStealingQueue& operator=(const WorkStealingQueue&) = delete;
+        WorkStealingQueue(WorkStealingQueue&&)                 = delete;
+        WorkStealingQueue& operator=(WorkStealingQueue&&)      = delete;
+
+        /// @brief Pushes an item to the bottom of the queue, only the owning thread may call this
+        /// @return false if the queue is full
+        bool Push(T item) noexcept {
+            std::int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+            std::int64_t top    = m_Top.load(std::memory_order_acquire);
+            if (bottom - top >= static_cast<std::int64_t>(Capacity)) {
+                return false;
+            }
+
+            m_Items[static_cast<std::size_t>(bottom) & MASK].store(item, std::memory_order_relaxed);
+            m_Bottom.store(bottom + 1, std::memory_order_release);
+            return true;
+        }
+
+        /// @brief Pops an item from the bottom of the queue, only the owning thread may call this
+        std::optional<T> Pop() noexcept {
+            std::int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+            m_Bottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t top = m_Top.load(std::memory_order_relaxed);
+
+            if (top > bottom) {
+                // Queue was empty
+                m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+                return std::nullopt;
+            }
+
+            T item =
+                m_Items[static_cast<std::size_t>(bottom) & MASK].load(std::memory_order_relaxed);
+            if (top == bottom) {
+                // Last item, race against thieves
+                bool won = m_Top.compare_exchange_strong(
+                    top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+                m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+                if (!won) {
+                    return std::nullopt;
+                }
+            }
+            return item;
+        }
+
+        /// @brief Steals an item from the top of the queue, can be called from any thread
+        /// @note This can fail spuriously if another thread is stealing at the same time
+        std::optional<T> Steal() noexcept {
+            std::int64_t top = m_Top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+
+            if (top >= bottom) {
+                return std::nullopt;
+            }
+
+            T item = m_Items[static_cast<std::size_t>(top) & MASK].load(std::memory_order_relaxed);
+            if (!m_Top.compare_exchange_strong(
+                    top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                return std::nullopt;
+            }
+            return item;
+        }
+
+        /// @brief An approximation of the number of items, only exact when called from the owner
+        std::size_t Size() const noexcept {
+            std::int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+            std::int64_t top    = m_Top.load(std::memory_order_relaxed);
+            return bottom > top ? static_cast<std::size_t>(bottom - top) : 0;
+        }
+
+        bool IsEmpty() const noexcept {
+            return Size() == 0;
+        }
+    private:
+        static constexpr std::size_t MASK = Capacity - 1;
+
+        // Top and bottom are on separate cache lines, as they are written by different threads
+        alignas(64) std::atomic<std::int64_t> m_Top    = 0;
+        alignas(64) std::atomic<std::int64_t> m_Bottom = 0;
+        alignas(64) std::array<std::atomic<T>, Capacity> m_Items {};
+    };
+} // namespace Astrelis
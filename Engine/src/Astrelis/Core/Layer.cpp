@@ -1,8 +1,55 @@
 #include "Layer.hpp"
 
 #include "Astrelis/Core/Base.hpp"
+#include "Astrelis/Events/EventRecord.hpp"
+
+#include <algorithm>
+#include <functional>
 
 namespace Astrelis {
+    namespace {
+        bool Intersects(const std::vector<std::size_t>& lhs, const std::vector<std::size_t>& rhs) {
+            // Access sets are tiny, so a linear search is faster than sorting or hashing
+            return std::any_of(lhs.begin(), lhs.end(), [&rhs](std::size_t resource) {
+                return std::find(rhs.begin(), rhs.end(), resource) != rhs.end();
+            });
+        }
+    } // namespace
+
+    bool LayerAccess::ConflictsWith(const LayerAccess& other) const noexcept {
+        if (!IsDeclared() || !other.IsDeclared()) {
+            return true;
+        }
+
+        if (ParallelSafe || other.ParallelSafe) {
+            return false;
+        }
+
+        // Concurrent reads are fine, any write has to be ordered
+        return Intersects(Writes, other.Writes) || Intersects(Writes, other.Reads)
+            || Intersects(Reads, other.Writes);
+    }
+
+    std::size_t LayerAccess::GetResourceId(std::string_view name) noexcept {
+        return std::hash<std::string_view> {}(name);
+    }
+
+    void Layer::SubscribeEvents(std::uint32_t categories) {
+        UnsubscribeDefault();
+        for (std::size_t i = 0; i < EVENT_TYPE_COUNT; i++) {
+            if ((GetEventCategoryFlags(static_cast<EventType>(i)) & categories) != 0U) {
+                m_EventMask.set(i);
+            }
+        }
+    }
+
+    void Layer::SubscribeEvent(EventType type) {
+        UnsubscribeDefault();
+        const auto index = static_cast<std::size_t>(type);
+        ASTRELIS_CORE_ASSERT(index < EVENT_TYPE_COUNT, "Unknown event type");
+        m_EventMask.set(index);
+    }
+
     void Layer::OnEvent(Event& event) {
         ASTRELIS_UNUSED(event);
     }
@@ -2,9 +2,34 @@
 
 #include "Astrelis/Events/Event.hpp"
 
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace Astrelis {
+    /**
+    * @brief The shared data that a layer reads and writes in OnUpdate
+    * Resources are identified by name, and only used to find layers that can be updated in parallel, @see LayerScheduler.
+    * A layer that does not declare anything is assumed to access everything, and is always updated on its own.
+    */
+    struct LayerAccess {
+        std::vector<std::size_t> Reads;
+        std::vector<std::size_t> Writes;
+        bool                     ParallelSafe = false;
+
+        [[nodiscard]] bool IsDeclared() const noexcept {
+            return ParallelSafe || !Reads.empty() || !Writes.empty();
+        }
+
+        /// @brief Whether the two layers have to be updated one after the other
+        [[nodiscard]] bool ConflictsWith(const LayerAccess& other) const noexcept;
+
+        static std::size_t GetResourceId(std::string_view name) noexcept;
+    };
+
     class Layer {
     public:
         explicit Layer(std::string debugName = "Layer") : m_DebugName(std::move(debugName)) {
@@ -19,6 +44,13 @@ namespace Astrelis {
         virtual void OnUpdate() {
         }
 
+        /**
+        * @brief Called at a fixed rate when ApplicationSpecification::UseFixedTimestep is enabled.
+        * This can be called zero or multiple times per frame, use Time::FixedDeltaTime as the step.
+        */
+        virtual void OnFixedUpdate() {
+        }
+
         virtual void OnAttach() {
         }
 
@@ -37,7 +69,64 @@ namespace Astrelis {
         [[nodiscard]] const std::string& GetName() const {
             return m_DebugName;
         }
+
+        [[nodiscard]] const LayerAccess& GetAccess() const {
+            return m_Access;
+        }
+
+        [[nodiscard]] bool IsSubscribedTo(EventType type) const {
+            const auto index = static_cast<std::size_t>(type);
+            return index < m_EventMask.size() && m_EventMask.test(index);
+        }
+    protected:
+        /**
+        * @brief Declares that OnUpdate reads the named resource
+        * Layers that declare their access can be updated in parallel with layers they do not conflict with,
+        * in which case OnUpdate runs on a worker thread and must not submit render commands.
+        */
+        void ReadsResource(std::string_view name) {
+            m_Access.Reads.push_back(LayerAccess::GetResourceId(name));
+        }
+
+        /// @brief Declares that OnUpdate writes the named resource, @see ReadsResource
+        void WritesResource(std::string_view name) {
+            m_Access.Writes.push_back(LayerAccess::GetResourceId(name));
+        }
+
+        /// @brief Declares that OnUpdate does not touch any data shared with other layers, @see ReadsResource
+        void SetParallelSafe() {
+            m_Access.ParallelSafe = true;
+        }
+
+        /**
+        * @brief Subscribes to every event type in the categories, a combination of EventCategory flags
+        * Layers receive every event until they subscribe to something, the first subscription replaces that default.
+        * Subscriptions are read when the layer is pushed, so they have to be made in the constructor or OnAttach.
+        */
+        void SubscribeEvents(std::uint32_t categories);
+
+        void SubscribeEvents(EventCategory category) {
+            SubscribeEvents(static_cast<std::uint32_t>(category));
+        }
+
+        /// @brief Subscribes to a single event type, @see SubscribeEvents
+        void SubscribeEvent(EventType type);
+
+        /// @brief Stops receiving any events, @see SubscribeEvents
+        void UnsubscribeEvents() {
+            m_EventMask.reset();
+            m_DefaultSubscription = false;
+        }
     private:
-        std::string m_DebugName;
+        void UnsubscribeDefault() {
+            if (m_DefaultSubscription) {
+                UnsubscribeEvents();
+            }
+        }
+
+        std::string                   m_DebugName;
+        LayerAccess                   m_Access;
+        std::bitset<EVENT_TYPE_COUNT> m_EventMask           = std::bitset<EVENT_TYPE_COUNT>().set();
+        bool                          m_DefaultSubscription = true;
     };
 } // namespace Astrelis
@@ -0,0 +1,61 @@
+#include "LayerScheduler.hpp"
+
+#include "Astrelis/Core/Base.hpp"
+
+#include <algorithm>
+
+namespace Astrelis {
+    void LayerScheduler::Build(std::span<OwnedPtr<Layer*>> layers) {
+        ASTRELIS_PROFILE_FUNCTION();
+        m_Layers.clear();
+        m_StageOffsets.clear();
+        m_LayerStages.assign(layers.size(), 0);
+
+        // Layer stacks are small, so comparing every pair is cheaper than anything smarter
+        std::uint32_t stageCount = 0;
+        for (std::size_t i = 0; i < layers.size(); i++) {
+            const LayerAccess& access = layers[i]->GetAccess();
+            for (std::size_t j = 0; j < i; j++) {
+                if (m_LayerStages[j] >= m_LayerStages[i]
+                    && access.ConflictsWith(layers[j]->GetAccess())) {
+                    m_LayerStages[i] = m_LayerStages[j] + 1;
+                }
+            }
+            stageCount = std::max(stageCount, m_LayerStages[i] + 1);
+        }
+
+        // Counting sort by stage, which keeps the layer stack order within a stage
+        m_StageOffsets.assign(stageCount + 1, 0);
+        for (std::uint32_t stage : m_LayerStages) {
+            m_StageOffsets[stage + 1]++;
+        }
+        for (std::size_t stage = 1; stage < m_StageOffsets.size(); stage++) {
+            m_StageOffsets[stage] += m_StageOffsets[stage - 1];
+        }
+
+        m_Layers.resize(layers.size());
+        m_StageCursors.assign(m_StageOffsets.begin(), m_StageOffsets.end() - 1);
+        for (std::size_t i = 0; i < layers.size(); i++) {
+            m_Layers[m_StageCursors[m_LayerStages[i]]++] = layers[i].Get();
+        }
+    }
+
+    void LayerScheduler::Update(JobSystem& jobSystem) {
+        ASTRELIS_PROFILE_FUNCTION();
+        for (std::size_t stage = 0; stage < GetStageCount(); stage++) {
+            std::span<Layer* const> layers = GetStage(stage);
+            if (layers.size() == 1) {
+                // Layers that conflict with everything stay on the main thread
+                layers[0]->OnUpdate();
+                continue;
+            }
+
+            jobSystem.ParallelFor(layers.size(), 1, [layers](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; i++) {
+                    ASTRELIS_PROFILE_SCOPE("Parallel Layer Update");
+                    layers[i]->OnUpdate();
+                }
+            });
+        }
+    }
+} // namespace Astrelis
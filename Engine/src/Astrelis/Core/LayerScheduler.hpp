@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Astrelis/Core/Pointer.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Jobs/JobSystem.hpp"
+#include "Layer.hpp"
+
+namespace Astrelis {
+    /// @brief Updates layers in parallel, based on the data they declare to access, @see LayerAccess
+    /// Layers are grouped into stages, a layer is placed in a later stage than every earlier layer it conflicts with.
+    /// The layers of a stage are updated in parallel, and stages are updated in order, so conflicting layers are
+    /// still updated in layer stack order. Layers that do not declare their access conflict with every layer.
+    class LayerScheduler {
+    public:
+        LayerScheduler()                                 = default;
+        ~LayerScheduler()                                = default;
+        LayerScheduler(const LayerScheduler&)            = delete;
+        LayerScheduler& operator=(const LayerScheduler&) = delete;
+        LayerScheduler(LayerScheduler&&)                 = delete;
+        LayerScheduler& operator=(LayerScheduler&&)      = delete;
+
+        /// @brief Builds the stages for the layers, this is cheap and done every frame as access can change
+        void Build(std::span<OwnedPtr<Layer*>> layers);
+        /// @brief Calls OnUpdate on the layers of the last build, stage by stage
+        void Update(JobSystem& jobSystem);
+
+        [[nodiscard]] std::size_t GetStageCount() const noexcept {
+            return m_StageOffsets.empty() ? 0 : m_StageOffsets.size() - 1;
+        }
+
+        [[nodiscard]] std::span<Layer* const> GetStage(std::size_t index) const {
+            return std::span<Layer* const>(m_Layers).subspan(
+                m_StageOffsets[index], m_StageOffsets[index + 1] - m_StageOffsets[index]);
+        }
+    private:
+        // Layers sorted by stage, keeping the layer stack order within a stage
+        std::vector<Layer*>        m_Layers;
+        std::vector<std::size_t>   m_StageOffsets;
+        // Scratch buffers, kept to avoid allocating every frame
+        std::vector<std::uint32_t> m_LayerStages;
+        std::vector<std::size_t>   m_StageCursors;
+    };
+} // namespace Astrelis
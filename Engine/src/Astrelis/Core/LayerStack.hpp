@@ -31,6 +31,11 @@ namespace Astrelis {
         std::size_t Size() const {
             return m_Layers.size();
         }
+
+        /// @brief The number of layers, the overlays come after them
+        std::size_t GetLayerCount() const {
+            return static_cast<std::size_t>(m_LayerInsertIndex);
+        }
     private:
         std::int64_t                  m_LayerInsertIndex = 0;
         std::vector<OwnedPtr<Layer*>> m_Layers;
@@ -76,6 +76,10 @@ namespace Astrelis {
             return m_Vector[index];
         }
 
+        const T& operator[](std::size_t index) const {
+            return m_Vector[index];
+        }
+
         // Overloaded arithmetic operators for clean syntax and chaining
         friend Vector operator+(Vector lhs, const Vector& rhs) {
             lhs += rhs;
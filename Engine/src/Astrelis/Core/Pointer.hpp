@@ -1,13 +1,23 @@
 #pragma once
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
 namespace Astrelis {
+    /// @brief Whether the references of a RefPtr can be copied and released from multiple threads at once
+    enum class RefCountPolicy : std::uint8_t {
+        NonAtomic,
+        Atomic
+    };
+
     // Forward declarations
     template<typename T> class ScopedPtr;
-    template<typename T> class RefPtr;
+    template<typename T, RefCountPolicy Policy = RefCountPolicy::NonAtomic> class RefPtr;
+    template<typename T, RefCountPolicy Policy = RefCountPolicy::NonAtomic> class WeakRef;
     template<typename T> class OwnedPtr;
     template<typename T> class RawRef;
 
@@ -90,33 +100,330 @@ namespace Astrelis {
 
     using RefCountType = std::size_t;
 
+    namespace Detail {
+        template<RefCountPolicy Policy> class RefCounter;
+
+        template<> class RefCounter<RefCountPolicy::NonAtomic> {
+        public:
+            void Increment() noexcept {
+                ++m_Count;
+            }
+
+            /// @return The count after decrementing
+            RefCountType Decrement() noexcept {
+                return --m_Count;
+            }
+
+            /// @brief Increments the count, unless it already dropped to zero
+            bool TryIncrement() noexcept {
+                if (m_Count == 0) {
+                    return false;
+                }
+                ++m_Count;
+                return true;
+            }
+
+            [[nodiscard]] RefCountType Get() const noexcept {
+                return m_Count;
+            }
+        private:
+            RefCountType m_Count = 0;
+        };
+
+        template<> class RefCounter<RefCountPolicy::Atomic> {
+        public:
+            void Increment() noexcept {
+                // A new reference can only be made from an existing one, so nothing has to be ordered
+                m_Count.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            RefCountType Decrement() noexcept {
+                // Every use of the object happens before the release that destroys it
+                return m_Count.fetch_sub(1, std::memory_order_acq_rel) - 1;
+            }
+
+            bool TryIncrement() noexcept {
+                RefCountType count = m_Count.load(std::memory_order_relaxed);
+                while (count != 0) {
+                    if (m_Count.compare_exchange_weak(count, count + 1, std::memory_order_acquire,
+                            std::memory_order_relaxed)) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            [[nodiscard]] RefCountType Get() const noexcept {
+                return m_Count.load(std::memory_order_relaxed);
+            }
+        private:
+            std::atomic<RefCountType> m_Count = 0;
+        };
+
+        template<RefCountPolicy Policy> class WeakRefBlock;
+    } // namespace Detail
+
+    /**
+    * @brief An intrusive reference count, engine objects that are shared through RefPtr can derive from it
+    * RefPtr uses the count inside the object instead of allocating one next to it, so the object and its count
+    * share a cache line, and a RefPtr can be recreated from a raw pointer to the object, e.g. from this.
+    * The object is deleted when the last RefPtr to it is released, so it must be created with new.
+    * The policy has to match the one of the RefPtr, @see RefCounted and AtomicRefCounted.
+    */
+    template<RefCountPolicy Policy> class BasicRefCounted {
+    public:
+        virtual ~BasicRefCounted() = default;
+
+        // Copies and moves are separate objects, with their own references
+        BasicRefCounted(const BasicRefCounted& /*other*/) noexcept {
+        }
+
+        BasicRefCounted& operator=(const BasicRefCounted& /*other*/) noexcept {
+            return *this;
+        }
+
+        BasicRefCounted(BasicRefCounted&& /*other*/) noexcept {
+        }
+
+        BasicRefCounted& operator=(BasicRefCounted&& /*other*/) noexcept {
+            return *this;
+        }
+
+        void AddRef() noexcept {
+            m_RefCount.Increment();
+        }
+
+        /// @brief Adds a reference, unless the object is already being destroyed
+        [[nodiscard]] bool TryAddRef() noexcept {
+            return m_RefCount.TryIncrement();
+        }
+
+        /// @brief Deletes the object when the last reference is released, expiring its weak references
+        void Release() noexcept;
+
+        [[nodiscard]] RefCountType GetRefCount() const noexcept {
+            return m_RefCount.Get();
+        }
+
+        /// @brief The block shared with the weak references to the object, created by the first one
+        /// The caller must hold a reference, so the object cannot be destroyed meanwhile.
+        Detail::WeakRefBlock<Policy>& GetWeakRefBlock();
+    protected:
+        BasicRefCounted() noexcept = default;
+    private:
+        using WeakRefBlockPtr = std::conditional_t<Policy == RefCountPolicy::Atomic,
+            std::atomic<Detail::WeakRefBlock<Policy>*>, Detail::WeakRefBlock<Policy>*>;
+
+        Detail::RefCounter<Policy> m_RefCount;
+        WeakRefBlockPtr            m_WeakRefBlock = nullptr;
+    };
+
+    using RefCounted       = BasicRefCounted<RefCountPolicy::NonAtomic>;
+    using AtomicRefCounted = BasicRefCounted<RefCountPolicy::Atomic>;
+
+    namespace Detail {
+        /**
+        * @brief Outlives the object for its weak references, and tells them whether the object is still alive
+        * The object owns a reference to the block, which it gives up when it is destroyed. With the atomic policy,
+        * a spin lock keeps the object from being deleted while a weak reference tries to lock it.
+        */
+        template<RefCountPolicy Policy> class WeakRefBlock {
+        public:
+            explicit WeakRefBlock(BasicRefCounted<Policy>* object) noexcept : m_Object(object) {
+                m_RefCount.Increment();
+            }
+
+            ~WeakRefBlock()                              = default;
+            WeakRefBlock(const WeakRefBlock&)            = delete;
+            WeakRefBlock& operator=(const WeakRefBlock&) = delete;
+            WeakRefBlock(WeakRefBlock&&)                 = delete;
+            WeakRefBlock& operator=(WeakRefBlock&&)      = delete;
+
+            void AddRef() noexcept {
+                m_RefCount.Increment();
+            }
+
+            void Release() noexcept {
+                if (m_RefCount.Decrement() == 0) {
+                    delete this;
+                }
+            }
+
+            /// @return The object with a new reference, or nullptr if it expired
+            BasicRefCounted<Policy>* TryLock() noexcept {
+                Lock();
+                BasicRefCounted<Policy>* object = m_Object;
+                if (object != nullptr && !object->TryAddRef()) {
+                    object = nullptr;
+                }
+                Unlock();
+                return object;
+            }
+
+            [[nodiscard]] bool IsExpired() const noexcept {
+                if constexpr (Policy == RefCountPolicy::Atomic) {
+                    return m_Expired.load(std::memory_order_acquire);
+                }
+                else {
+                    return m_Object == nullptr;
+                }
+            }
+
+            /// @brief Called by the object before it is deleted, releasing its reference to the block
+            void Expire() noexcept {
+                Lock();
+                m_Object = nullptr;
+                if constexpr (Policy == RefCountPolicy::Atomic) {
+                    m_Expired.store(true, std::memory_order_release);
+                }
+                Unlock();
+                Release();
+            }
+        private:
+            void Lock() noexcept {
+                if constexpr (Policy == RefCountPolicy::Atomic) {
+                    while (m_Lock.test_and_set(std::memory_order_acquire)) {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+
+            void Unlock() noexcept {
+                if constexpr (Policy == RefCountPolicy::Atomic) {
+                    m_Lock.clear(std::memory_order_release);
+                }
+            }
+
+            RefCounter<Policy>       m_RefCount;
+            BasicRefCounted<Policy>* m_Object;
+            std::atomic_flag         m_Lock;
+            std::atomic_bool         m_Expired = false;
+        };
+
+        /// @brief The count of an object that is not RefCounted, allocated separately from the object
+        template<typename T, RefCountPolicy Policy>
+        class PointerRefCount final : public BasicRefCounted<Policy> {
+        public:
+            explicit PointerRefCount(T* ptr) noexcept : m_Ptr(ptr) {
+            }
+
+            ~PointerRefCount() override {
+                delete m_Ptr;
+            }
+
+            PointerRefCount(const PointerRefCount&)            = delete;
+            PointerRefCount& operator=(const PointerRefCount&) = delete;
+            PointerRefCount(PointerRefCount&&)                 = delete;
+            PointerRefCount& operator=(PointerRefCount&&)      = delete;
+        private:
+            T* m_Ptr;
+        };
+
+        /// @brief The count and the object in a single allocation, like std::make_shared
+        template<typename T, RefCountPolicy Policy>
+        class InlineRefCount final : public BasicRefCounted<Policy> {
+        public:
+            template<typename... Args>
+            explicit InlineRefCount(Args&&... args) : m_Value(std::forward<Args>(args)...) {
+            }
+
+            ~InlineRefCount() override                       = default;
+            InlineRefCount(const InlineRefCount&)            = delete;
+            InlineRefCount& operator=(const InlineRefCount&) = delete;
+            InlineRefCount(InlineRefCount&&)                 = delete;
+            InlineRefCount& operator=(InlineRefCount&&)      = delete;
+
+            T* Get() noexcept {
+                return &m_Value;
+            }
+        private:
+            T m_Value;
+        };
+    } // namespace Detail
+
+    template<RefCountPolicy Policy> void BasicRefCounted<Policy>::Release() noexcept {
+        if (m_RefCount.Decrement() != 0) {
+            return;
+        }
+
+        Detail::WeakRefBlock<Policy>* block = nullptr;
+        if constexpr (Policy == RefCountPolicy::Atomic) {
+            block = m_WeakRefBlock.load(std::memory_order_acquire);
+        }
+        else {
+            block = m_WeakRefBlock;
+        }
+        if (block != nullptr) {
+            block->Expire();
+        }
+        delete this;
+    }
+
+    template<RefCountPolicy Policy>
+    Detail::WeakRefBlock<Policy>& BasicRefCounted<Policy>::GetWeakRefBlock() {
+        if constexpr (Policy == RefCountPolicy::Atomic) {
+            Detail::WeakRefBlock<Policy>* block = m_WeakRefBlock.load(std::memory_order_acquire);
+            if (block != nullptr) {
+                return *block;
+            }
+
+            // Another thread can create the block at the same time, only one of them is kept
+            auto* created = new Detail::WeakRefBlock<Policy>(this);
+            if (m_WeakRefBlock.compare_exchange_strong(
+                    block, created, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                return *created;
+            }
+            delete created;
+            return *block;
+        }
+        else {
+            if (m_WeakRefBlock == nullptr) {
+                m_WeakRefBlock = new Detail::WeakRefBlock<Policy>(this);
+            }
+            return *m_WeakRefBlock;
+        }
+    }
+
     /**
     * @brief A reference counted smart pointer
+    * Objects deriving from RefCounted keep their own count, other objects get a count allocated next to them by
+    * Create, or separately when an existing pointer is wrapped.
+    * The policy is part of the type, non atomic references are cheaper, but may only be used by one thread at a
+    * time, atomic references can be shared with the job system and the render thread, @see AtomicRefPtr.
     */
-    template<typename T> class RefPtr {
+    template<typename T, RefCountPolicy Policy> class RefPtr {
     public:
         static_assert(!std::is_array_v<T>, "RefPtr does not support arrays!");
         static_assert(!std::is_reference_v<T>, "RefPtr does not support references!");
-        template<typename U> friend class RefPtr;
+        template<typename U, RefCountPolicy> friend class RefPtr;
+        template<typename U, RefCountPolicy> friend class WeakRef;
+
+        using RefCountBase = BasicRefCounted<Policy>;
 
         // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
         RefPtr(std::nullptr_t = nullptr) : m_Ptr(nullptr), m_RefCount(nullptr) {
         }
 
-        explicit RefPtr(T* ptr) : m_Ptr(ptr), m_RefCount(new RefCountType(1)) {
+        explicit RefPtr(T* ptr) : m_Ptr(ptr), m_RefCount(nullptr) {
+            if (ptr == nullptr) {
+                return;
+            }
+
+            if constexpr (std::is_base_of_v<RefCountBase, T>) {
+                m_RefCount = ptr;
+            }
+            else {
+                CheckPolicy();
+                m_RefCount = new Detail::PointerRefCount<T, Policy>(ptr);
+            }
+            m_RefCount->AddRef();
         }
 
         ~RefPtr() {
-            if (m_RefCount != nullptr && --(*m_RefCount) == 0) {
-                delete m_Ptr;
-                delete m_RefCount;
-            }
+            Release();
         }
 
-        RefPtr(const RefPtr& other) : m_Ptr(other.m_Ptr), m_RefCount(other.m_RefCount) {
-            if (m_RefCount != nullptr) {
-                ++(*m_RefCount);
-            }
+        RefPtr(const RefPtr& other) : m_Ptr(other.m_Ptr), m_RefCount(AddRef(other.m_RefCount)) {
         }
 
         RawRef<T*> Raw() const {
@@ -125,15 +432,12 @@ namespace Astrelis {
 
         RefPtr& operator=(const RefPtr& other) {
             if (this != &other) {
-                if (m_RefCount != nullptr && --(*m_RefCount) == 0) {
-                    delete m_Ptr;
-                    delete m_RefCount;
-                }
-                m_Ptr      = other.m_Ptr;
-                m_RefCount = other.m_RefCount;
-                if (m_RefCount != nullptr) {
-                    ++(*m_RefCount);
-                }
+                // Releasing can destroy other, if it is owned by the current object
+                T*            ptr      = other.m_Ptr;
+                RefCountBase* refCount = AddRef(other.m_RefCount);
+                Release();
+                m_Ptr      = ptr;
+                m_RefCount = refCount;
             }
             return *this;
         }
@@ -145,14 +449,13 @@ namespace Astrelis {
 
         RefPtr& operator=(RefPtr&& other) noexcept {
             if (this != &other) {
-                if (m_RefCount != nullptr && --(*m_RefCount) == 0) {
-                    delete m_Ptr;
-                    delete m_RefCount;
-                }
-                m_Ptr            = other.m_Ptr;
-                m_RefCount       = other.m_RefCount;
-                other.m_Ptr      = nullptr;
-                other.m_RefCount = nullptr;
+                T*            ptr      = other.m_Ptr;
+                RefCountBase* refCount = other.m_RefCount;
+                other.m_Ptr            = nullptr;
+                other.m_RefCount       = nullptr;
+                Release();
+                m_Ptr      = ptr;
+                m_RefCount = refCount;
             }
             return *this;
         }
@@ -169,6 +472,10 @@ namespace Astrelis {
             return m_Ptr;
         }
 
+        [[nodiscard]] RefCountType GetRefCount() const noexcept {
+            return m_RefCount != nullptr ? m_RefCount->GetRefCount() : 0;
+        }
+
         bool operator==(const RefPtr& other) const noexcept {
             return m_Ptr == other.m_Ptr;
         }
@@ -178,10 +485,7 @@ namespace Astrelis {
         }
 
         void Reset() {
-            if (m_RefCount != nullptr && --(*m_RefCount) == 0) {
-                delete m_Ptr;
-                delete m_RefCount;
-            }
+            Release();
             m_Ptr      = nullptr;
             m_RefCount = nullptr;
         }
@@ -193,25 +497,16 @@ namespace Astrelis {
 
         template<typename U>
             requires std::is_base_of_v<U, T>
-        explicit operator RefPtr<U>() const {
-            if (m_RefCount != nullptr) {
-                ++(*m_RefCount);
-            }
-            return RefPtr<U>(static_cast<U*>(m_Ptr), m_RefCount);
+        explicit operator RefPtr<U, Policy>() const {
+            return RefPtr<U, Policy>(static_cast<U*>(m_Ptr), AddRef(m_RefCount));
         }
 
-        template<typename U> RefPtr<U> DynamicCast() {
-            if (m_RefCount != nullptr) {
-                ++(*m_RefCount);
-            }
-            return RefPtr<U>(dynamic_cast<U*>(m_Ptr), m_RefCount);
+        template<typename U> RefPtr<U, Policy> DynamicCast() {
+            return RefPtr<U, Policy>(dynamic_cast<U*>(m_Ptr), AddRef(m_RefCount));
         }
 
-        template<typename U> RefPtr<U> As() const {
-            if (m_RefCount != nullptr) {
-                ++(*m_RefCount);
-            }
-            return RefPtr<U>(reinterpret_cast<U*>(m_Ptr), m_RefCount);
+        template<typename U> RefPtr<U, Policy> As() const {
+            return RefPtr<U, Policy>(reinterpret_cast<U*>(m_Ptr), AddRef(m_RefCount));
         }
 
         static void Swap(RefPtr& ptrA, RefPtr& ptrB) {
@@ -219,15 +514,129 @@ namespace Astrelis {
             std::swap(ptrA.m_RefCount, ptrB.m_RefCount);
         }
 
-        template<typename... Args> static RefPtr<T> Create(Args&&... args) {
-            return RefPtr<T>(new T(std::forward<Args>(args)...));
+        /// @brief Creates the object with a single allocation, for both RefCounted and other objects
+        template<typename... Args> static RefPtr Create(Args&&... args) {
+            if constexpr (std::is_base_of_v<RefCountBase, T>) {
+                return RefPtr(new T(std::forward<Args>(args)...));
+            }
+            else {
+                CheckPolicy();
+                auto* refCount = new Detail::InlineRefCount<T, Policy>(std::forward<Args>(args)...);
+                return RefPtr(refCount->Get(), AddRef(refCount));
+            }
         }
     private:
-        RefPtr(T* ptr, RefCountType* type) : m_Ptr(ptr), m_RefCount(type) {
+        // Takes over a reference that was already added
+        RefPtr(T* ptr, RefCountBase* refCount) : m_Ptr(ptr), m_RefCount(refCount) {
+        }
+
+        static constexpr void CheckPolicy() {
+            static_assert(
+                !std::is_base_of_v<RefCounted, T> && !std::is_base_of_v<AtomicRefCounted, T>,
+                "The policy of the RefPtr does not match the one of the object");
+        }
+
+        static RefCountBase* AddRef(RefCountBase* refCount) noexcept {
+            if (refCount != nullptr) {
+                refCount->AddRef();
+            }
+            return refCount;
+        }
+
+        void Release() noexcept {
+            if (m_RefCount != nullptr) {
+                m_RefCount->Release();
+            }
         }
 
         T*            m_Ptr;
-        RefCountType* m_RefCount;
+        RefCountBase* m_RefCount;
+    };
+
+    template<typename T> using AtomicRefPtr = RefPtr<T, RefCountPolicy::Atomic>;
+
+    /**
+    * @brief A reference to an object owned by RefPtrs, which does not keep it alive
+    * Lock returns a RefPtr while the object is alive, and nullptr once the last RefPtr released it. Caches can
+    * hold objects this way, without being the reason they stay loaded.
+    */
+    template<typename T, RefCountPolicy Policy> class WeakRef {
+    public:
+        // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+        WeakRef(std::nullptr_t = nullptr) : m_Ptr(nullptr), m_Block(nullptr) {
+        }
+
+        // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+        WeakRef(const RefPtr<T, Policy>& ptr) : m_Ptr(ptr.m_Ptr), m_Block(nullptr) {
+            if (ptr.m_RefCount != nullptr) {
+                m_Block = &ptr.m_RefCount->GetWeakRefBlock();
+                m_Block->AddRef();
+            }
+        }
+
+        ~WeakRef() {
+            Reset();
+        }
+
+        WeakRef(const WeakRef& other) : m_Ptr(other.m_Ptr), m_Block(other.m_Block) {
+            if (m_Block != nullptr) {
+                m_Block->AddRef();
+            }
+        }
+
+        WeakRef& operator=(const WeakRef& other) {
+            if (this != &other) {
+                if (other.m_Block != nullptr) {
+                    other.m_Block->AddRef();
+                }
+                Reset();
+                m_Ptr   = other.m_Ptr;
+                m_Block = other.m_Block;
+            }
+            return *this;
+        }
+
+        WeakRef(WeakRef&& other) noexcept : m_Ptr(other.m_Ptr), m_Block(other.m_Block) {
+            other.m_Ptr   = nullptr;
+            other.m_Block = nullptr;
+        }
+
+        WeakRef& operator=(WeakRef&& other) noexcept {
+            if (this != &other) {
+                Reset();
+                m_Ptr         = other.m_Ptr;
+                m_Block       = other.m_Block;
+                other.m_Ptr   = nullptr;
+                other.m_Block = nullptr;
+            }
+            return *this;
+        }
+
+        /// @return A reference to the object, or nullptr if it was destroyed
+        [[nodiscard]] RefPtr<T, Policy> Lock() const {
+            if (m_Block == nullptr) {
+                return nullptr;
+            }
+
+            BasicRefCounted<Policy>* refCount = m_Block->TryLock();
+            return refCount != nullptr ? RefPtr<T, Policy>(m_Ptr, refCount) : nullptr;
+        }
+
+        /// @brief Whether the object was destroyed, with the atomic policy it can expire right after this returns
+        [[nodiscard]] bool IsExpired() const noexcept {
+            return m_Block == nullptr || m_Block->IsExpired();
+        }
+
+        void Reset() noexcept {
+            if (m_Block != nullptr) {
+                m_Block->Release();
+            }
+            m_Ptr   = nullptr;
+            m_Block = nullptr;
+        }
+    private:
+        T*                            m_Ptr;
+        Detail::WeakRefBlock<Policy>* m_Block;
     };
 
     template<typename T> class RawRef {
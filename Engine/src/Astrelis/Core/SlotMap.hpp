@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "Handle.hpp"
+
+namespace Astrelis {
+    /**
+    * @brief Owns objects in a dense array, and hands out generational handles to them
+    * Looking up a handle is two array reads, and iterating visits the objects contiguously. Removing an object moves
+    * the last one into its place, so pointers and iterators are only valid until the next insertion or removal, and
+    * objects should be kept by handle instead. Handles can be typed by an interface, so the backend can store the
+    * concrete type without exposing it.
+    * @note Not thread safe
+    */
+    template<typename T, typename HandleTag = T> class SlotMap {
+    public:
+        using HandleType = Handle<HandleTag>;
+
+        template<typename... Args> HandleType Emplace(Args&&... args) {
+            std::uint32_t slotIndex = 0;
+            if (m_FreeHead != INVALID_INDEX) {
+                slotIndex  = m_FreeHead;
+                m_FreeHead = m_Slots[slotIndex].Index;
+            }
+            else {
+                slotIndex = static_cast<std::uint32_t>(m_Slots.size());
+                m_Slots.push_back(Slot {0, 1});
+            }
+
+            Slot& slot = m_Slots[slotIndex];
+            slot.Index = static_cast<std::uint32_t>(m_Dense.size());
+            m_Dense.emplace_back(std::forward<Args>(args)...);
+            m_DenseToSlot.push_back(slotIndex);
+            return HandleType {slotIndex, slot.Generation};
+        }
+
+        HandleType Insert(T value) {
+            return Emplace(std::move(value));
+        }
+
+        /// @return false if the handle is stale
+        bool Remove(HandleType handle) {
+            if (!Contains(handle)) {
+                return false;
+            }
+
+            Slot&               slot       = m_Slots[handle.Index];
+            const std::uint32_t denseIndex = slot.Index;
+            const std::uint32_t lastIndex  = static_cast<std::uint32_t>(m_Dense.size()) - 1;
+            if (denseIndex != lastIndex) {
+                m_Dense[denseIndex]                      = std::move(m_Dense[lastIndex]);
+                m_DenseToSlot[denseIndex]                = m_DenseToSlot[lastIndex];
+                m_Slots[m_DenseToSlot[denseIndex]].Index = denseIndex;
+            }
+            m_Dense.pop_back();
+            m_DenseToSlot.pop_back();
+
+            // Generation 0 is reserved for handles that were never assigned
+            slot.Generation = slot.Generation == std::numeric_limits<std::uint32_t>::max()
+                                ? 1
+                                : slot.Generation + 1;
+            slot.Index      = m_FreeHead;
+            m_FreeHead      = handle.Index;
+            return true;
+        }
+
+        [[nodiscard]] bool Contains(HandleType handle) const noexcept {
+            return handle.Index < m_Slots.size() && handle.Generation != 0
+                && m_Slots[handle.Index].Generation == handle.Generation;
+        }
+
+        /// @return nullptr if the handle is stale
+        [[nodiscard]] T* Get(HandleType handle) noexcept {
+            return Contains(handle) ? &m_Dense[m_Slots[handle.Index].Index] : nullptr;
+        }
+
+        [[nodiscard]] const T* Get(HandleType handle) const noexcept {
+            return Contains(handle) ? &m_Dense[m_Slots[handle.Index].Index] : nullptr;
+        }
+
+        /// @brief The handle of the object at a position in the dense array, for use while iterating
+        [[nodiscard]] HandleType GetHandle(std::size_t denseIndex) const noexcept {
+            const std::uint32_t slotIndex = m_DenseToSlot[denseIndex];
+            return HandleType {slotIndex, m_Slots[slotIndex].Generation};
+        }
+
+        /// @brief Removes every object, all handles become stale
+        void Clear() {
+            while (!m_Dense.empty()) {
+                Remove(GetHandle(m_Dense.size() - 1));
+            }
+        }
+
+        [[nodiscard]] std::size_t GetSize() const noexcept {
+            return m_Dense.size();
+        }
+
+        [[nodiscard]] bool IsEmpty() const noexcept {
+            return m_Dense.empty();
+        }
+
+        auto begin() noexcept {
+            return m_Dense.begin();
+        }
+
+        auto end() noexcept {
+            return m_Dense.end();
+        }
+
+        auto begin() const noexcept {
+            return m_Dense.begin();
+        }
+
+        auto end() const noexcept {
+            return m_Dense.end();
+        }
+    private:
+        static constexpr std::uint32_t INVALID_INDEX = std::numeric_limits<std::uint32_t>::max();
+
+        // Index is the position in the dense array while the slot is used, and the next free slot otherwise
+        struct Slot {
+            std::uint32_t Index;
+            std::uint32_t Generation;
+        };
+
+        std::vector<T>             m_Dense;
+        std::vector<std::uint32_t> m_DenseToSlot;
+        std::vector<Slot>          m_Slots;
+        std::uint32_t              m_FreeHead = INVALID_INDEX;
+    };
+} // namespace Astrelis
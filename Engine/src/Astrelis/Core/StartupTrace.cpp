@@ -0,0 +1,82 @@
+#include "StartupTrace.hpp"
+
+#include "Astrelis/Core/Base.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+
+namespace Astrelis {
+    void StartupTrace::AddPhase(std::string name, const TimePoint& start, const TimePoint& end) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_Finished) {
+            return;
+        }
+
+        m_Phases.push_back(Phase {std::move(name), std::this_thread::get_id(),
+            Time::ElapsedTime<Milliseconds>(m_Start, start),
+            Time::ElapsedTime<Milliseconds>(start, end)});
+    }
+
+    void StartupTrace::Finish() {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (!m_Finished) {
+            m_TotalTime = Time::ElapsedTime<Milliseconds>(m_Start, Time::Now());
+            m_Finished  = true;
+        }
+    }
+
+    bool StartupTrace::IsFinished() const {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_Finished;
+    }
+
+    Milliseconds StartupTrace::GetTotalTime() const {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_Finished ? m_TotalTime : Time::ElapsedTime<Milliseconds>(m_Start, Time::Now());
+    }
+
+    std::vector<StartupTrace::Phase> StartupTrace::GetPhases() const {
+        std::vector<Phase> phases;
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            phases = m_Phases;
+        }
+
+        std::stable_sort(phases.begin(), phases.end(), [](const Phase& lhs, const Phase& rhs) {
+            return static_cast<double>(lhs.Start) < static_cast<double>(rhs.Start);
+        });
+        return phases;
+    }
+
+    void StartupTrace::Log() const {
+        // The debug log is compiled out with higher log levels
+        for ([[maybe_unused]] const Phase& phase : GetPhases()) {
+            ASTRELIS_CORE_LOG_DEBUG("Startup: {0:<32} {1:>8.2f}ms (at {2:.2f}ms{3})", phase.Name,
+                static_cast<double>(phase.Duration), static_cast<double>(phase.Start),
+                phase.Thread == std::this_thread::get_id() ? "" : ", worker thread");
+        }
+        ASTRELIS_CORE_LOG_INFO("Startup took {0:.2f}ms", static_cast<double>(GetTotalTime()));
+    }
+
+    Result<EmptyType, std::string> StartupTrace::WriteCSV(const std::filesystem::path& path) const {
+        ASTRELIS_PROFILE_FUNCTION();
+        std::ofstream file(path);
+        if (!file.is_open()) {
+            return "Failed to open file for writing";
+        }
+
+        file << "Phase,StartMs,DurationMs,Thread\n";
+        for (const Phase& phase : GetPhases()) {
+            file << phase.Name << ',' << static_cast<double>(phase.Start) << ','
+                 << static_cast<double>(phase.Duration) << ','
+                 << std::hash<std::thread::id> {}(phase.Thread) << '\n';
+        }
+        file << "Total,0," << static_cast<double>(GetTotalTime()) << ",\n";
+
+        if (!file.good()) {
+            return "Failed to write startup trace";
+        }
+        return Result<EmptyType, std::string>::Ok();
+    }
+} // namespace Astrelis
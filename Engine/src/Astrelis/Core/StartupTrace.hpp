@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Astrelis/Core/Result.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Time.hpp"
+
+namespace Astrelis {
+    /// @brief Records how long each phase of the engine startup takes, and on which thread it ran
+    /// Phases can be recorded from any thread, so work that runs in parallel shows up as overlapping phases.
+    /// The application reports the trace when the main loop starts, @see ApplicationSpecification::StartupTracePath
+    class StartupTrace {
+    public:
+        struct Phase {
+            std::string     Name;
+            std::thread::id Thread;
+            // Relative to the start of the trace
+            Milliseconds Start;
+            Milliseconds Duration;
+        };
+
+        /// @brief Records the lifetime of the scope as a phase
+        class Scope {
+        public:
+            Scope(StartupTrace& trace, std::string name)
+                : m_Trace(trace), m_Name(std::move(name)) {
+            }
+
+            ~Scope() {
+                m_Trace.AddPhase(std::move(m_Name), m_Start, Time::Now());
+            }
+
+            Scope(const Scope&)            = delete;
+            Scope& operator=(const Scope&) = delete;
+            Scope(Scope&&)                 = delete;
+            Scope& operator=(Scope&&)      = delete;
+        private:
+            StartupTrace& m_Trace; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+            std::string   m_Name;
+            TimePoint     m_Start;
+        };
+
+        void AddPhase(std::string name, const TimePoint& start, const TimePoint& end);
+        /// @brief Stops accepting phases, the trace covers everything from its creation until now
+        void Finish();
+
+        [[nodiscard]] bool IsFinished() const;
+        [[nodiscard]] Milliseconds GetTotalTime() const;
+        /// @brief The recorded phases, sorted by start time
+        [[nodiscard]] std::vector<Phase> GetPhases() const;
+
+        /// @brief Logs the phases (debug), and the total startup time
+        void Log() const;
+        /// @brief Writes the phases as CSV, one phase per row
+        Result<EmptyType, std::string> WriteCSV(const std::filesystem::path& path) const;
+    private:
+        mutable std::mutex m_Mutex;
+        TimePoint          m_Start;
+        Milliseconds       m_TotalTime;
+        bool               m_Finished = false;
+        std::vector<Phase> m_Phases;
+    };
+} // namespace Astrelis
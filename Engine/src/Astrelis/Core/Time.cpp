@@ -2,7 +2,26 @@
 
 #include "Astrelis/Core/Base.hpp"
 
+#include "FrameStats.hpp"
+#include "TimerWheel.hpp"
+
 namespace Astrelis {
     Milliseconds Time::s_DeltaTime;
     Seconds      Time::s_TimeSinceAppStart;
+    Seconds      Time::s_FixedDeltaTime(std::chrono::duration<double>(1.0 / 60.0));
+    double       Time::s_InterpolationAlpha = 0.0;
+    FrameStats*  Time::s_FrameStats         = nullptr;
+    TimerWheel*  Time::s_Timers             = nullptr;
+
+    FrameStats& Time::GetFrameStats() {
+        ASTRELIS_CORE_ASSERT(
+            s_FrameStats != nullptr, "Frame stats are only available while an application runs");
+        return *s_FrameStats;
+    }
+
+    TimerWheel& Time::GetTimers() {
+        ASTRELIS_CORE_ASSERT(
+            s_Timers != nullptr, "Timers are only available while an application runs");
+        return *s_Timers;
+    }
 } // namespace Astrelis
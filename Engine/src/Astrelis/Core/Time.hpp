@@ -3,6 +3,9 @@
 #include <chrono>
 
 namespace Astrelis {
+    class FrameStats;
+    class TimerWheel;
+
     // TODO: Test, refactor, and document this class
     template<typename T = double, typename Ratio = std::ratio<1>> class TimeSpan {
     public:
@@ -123,10 +126,26 @@ namespace Astrelis {
             return s_DeltaTime;
         }
 
+        /// @brief The time step of Layer::OnFixedUpdate
+        static Seconds FixedDeltaTime() {
+            return s_FixedDeltaTime;
+        }
+
+        /// @brief How far the current frame is between the last and the next fixed update, in [0, 1)
+        /// Use this to interpolate rendered state between the two most recent fixed updates
+        static double InterpolationAlpha() {
+            return s_InterpolationAlpha;
+        }
+
         static TimePoint Now() {
             return TimePoint::Now();
         }
 
+        /// @brief The frame time statistics of the running application, @see FrameStats
+        static FrameStats& GetFrameStats();
+        /// @brief The timers of the running application, which are advanced once per frame, @see TimerWheel
+        static TimerWheel& GetTimers();
+
         template<typename T>
             requires std::is_same_v<T, Milliseconds> || std::is_same_v<T, Seconds>
         static T ElapsedTime(const TimePoint& start, const TimePoint& end) {
@@ -135,7 +154,9 @@ namespace Astrelis {
     private:
         static Seconds      s_TimeSinceAppStart;
         static Milliseconds s_DeltaTime;
-
-        // TODO(Feat): Users can add custom timers
+        static Seconds      s_FixedDeltaTime;
+        static double       s_InterpolationAlpha;
+        static FrameStats*  s_FrameStats;
+        static TimerWheel*  s_Timers;
     };
 } // namespace Astrelis
@@ -0,0 +1,195 @@
+#include "TimerWheel.hpp"
+
+#include "Astrelis/Core/Base.hpp"
+
+#include <cmath>
+
+namespace Astrelis {
+    namespace {
+        constexpr std::uint64_t SLOT_MASK = TimerWheel::SLOT_COUNT - 1;
+        // Timers further away than the top level are parked in it, and reinserted when it cascades
+        constexpr std::uint64_t MAX_RANGE = std::uint64_t {1}
+            << (TimerWheel::SLOT_BITS * TimerWheel::LEVEL_COUNT);
+    } // namespace
+
+    TimerWheel::TimerWheel(Milliseconds resolution)
+        : m_TicksPerMillisecond(1.0 / static_cast<double>(resolution)) {
+        ASTRELIS_CORE_ASSERT(
+            static_cast<double>(resolution) > 0.0, "Timer resolution must be positive");
+        for (auto& level : m_Slots) {
+            level.fill(INVALID_INDEX);
+        }
+    }
+
+    TimerWheel::~TimerWheel() {
+        for (auto& chunk : m_Chunks) {
+            for (Timer& timer : *chunk) {
+                if (timer.State != TimerState::Free) {
+                    timer.Destroy(timer.Storage.data());
+                }
+            }
+        }
+    }
+
+    bool TimerWheel::Cancel(TimerHandle handle) {
+        if (!IsActive(handle)) {
+            return false;
+        }
+
+        Timer& timer = GetTimer(handle.Index);
+        if (timer.State == TimerState::Firing) {
+            // The callback is still running, it is freed once it returns
+            timer.State = TimerState::Cancelled;
+            return true;
+        }
+
+        Unlink(handle.Index);
+        FreeTimer(handle.Index);
+        return true;
+    }
+
+    bool TimerWheel::IsActive(TimerHandle handle) const {
+        if (!handle.IsValid() || handle.Index >= m_Chunks.size() * CHUNK_SIZE) {
+            return false;
+        }
+
+        const Timer& timer = GetTimer(handle.Index);
+        return timer.Generation == handle.Generation
+            && (timer.State == TimerState::Scheduled || timer.State == TimerState::Firing);
+    }
+
+    void TimerWheel::Advance(Milliseconds deltaTime) {
+        ASTRELIS_PROFILE_FUNCTION();
+        m_PendingTicks += static_cast<double>(deltaTime) * m_TicksPerMillisecond;
+        double ticks = std::floor(m_PendingTicks);
+        m_PendingTicks -= ticks;
+
+        for (auto remaining = static_cast<std::uint64_t>(ticks); remaining > 0; remaining--) {
+            if (m_ActiveCount == 0) {
+                // Nothing can expire, skip the empty ticks
+                m_CurrentTick += remaining;
+                break;
+            }
+            Tick();
+        }
+    }
+
+    std::uint64_t TimerWheel::ToTicks(Milliseconds time) const {
+        double ticks = std::ceil(static_cast<double>(time) * m_TicksPerMillisecond);
+        // A timer never fires in the tick it was scheduled in
+        return ticks < 1.0 ? 1 : static_cast<std::uint64_t>(ticks);
+    }
+
+    TimerWheel::Timer& TimerWheel::GetTimer(std::uint32_t index) const {
+        return (*m_Chunks[index / CHUNK_SIZE])[index % CHUNK_SIZE];
+    }
+
+    std::uint32_t TimerWheel::AllocateTimer() {
+        if (m_FreeList == INVALID_INDEX) {
+            auto base = static_cast<std::uint32_t>(m_Chunks.size() * CHUNK_SIZE);
+            m_Chunks.push_back(ScopedPtr<std::array<Timer, CHUNK_SIZE>>::Create());
+            for (std::uint32_t i = CHUNK_SIZE; i > 0; i--) {
+                GetTimer(base + i - 1).Next = m_FreeList;
+                m_FreeList                  = base + i - 1;
+            }
+        }
+
+        std::uint32_t index = m_FreeList;
+        m_FreeList          = GetTimer(index).Next;
+        m_ActiveCount++;
+        return index;
+    }
+
+    void TimerWheel::FreeTimer(std::uint32_t index) {
+        Timer& timer = GetTimer(index);
+        timer.Destroy(timer.Storage.data());
+        timer.State = TimerState::Free;
+        timer.Generation++;
+        timer.Prev = INVALID_INDEX;
+        timer.Next = m_FreeList;
+        m_FreeList = index;
+        m_ActiveCount--;
+    }
+
+    void TimerWheel::Insert(std::uint32_t index) {
+        Timer&        timer   = GetTimer(index);
+        std::uint64_t expires = timer.Expires;
+        if (expires - m_CurrentTick >= MAX_RANGE) {
+            expires = m_CurrentTick + MAX_RANGE - 1;
+        }
+
+        // The lowest level whose range covers the delay
+        std::uint64_t delta = expires - m_CurrentTick;
+        std::size_t   level = 0;
+        while (level + 1 < LEVEL_COUNT
+            && delta >= (std::uint64_t {1} << (SLOT_BITS * (level + 1)))) {
+            level++;
+        }
+
+        std::size_t slot = (expires >> (SLOT_BITS * level)) & SLOT_MASK;
+        timer.Bucket     = static_cast<std::uint16_t>(level * SLOT_COUNT + slot);
+
+        std::uint32_t& head = m_Slots[level][slot];
+        timer.Prev          = INVALID_INDEX;
+        timer.Next          = head;
+        if (head != INVALID_INDEX) {
+            GetTimer(head).Prev = index;
+        }
+        head = index;
+    }
+
+    void TimerWheel::Unlink(std::uint32_t index) {
+        Timer& timer = GetTimer(index);
+        if (timer.Prev != INVALID_INDEX) {
+            GetTimer(timer.Prev).Next = timer.Next;
+        }
+        else {
+            m_Slots[timer.Bucket / SLOT_COUNT][timer.Bucket % SLOT_COUNT] = timer.Next;
+        }
+
+        if (timer.Next != INVALID_INDEX) {
+            GetTimer(timer.Next).Prev = timer.Prev;
+        }
+        timer.Prev = INVALID_INDEX;
+        timer.Next = INVALID_INDEX;
+    }
+
+    void TimerWheel::Cascade(std::size_t level, std::size_t slot) {
+        // Every timer in the slot now fits in a lower level
+        std::uint32_t index  = m_Slots[level][slot];
+        m_Slots[level][slot] = INVALID_INDEX;
+        while (index != INVALID_INDEX) {
+            std::uint32_t next = GetTimer(index).Next;
+            Insert(index);
+            index = next;
+        }
+    }
+
+    void TimerWheel::Tick() {
+        m_CurrentTick++;
+        std::size_t slot = m_CurrentTick & SLOT_MASK;
+        for (std::size_t level = 1; slot == 0 && level < LEVEL_COUNT; level++) {
+            slot = (m_CurrentTick >> (SLOT_BITS * level)) & SLOT_MASK;
+            Cascade(level, slot);
+        }
+
+        std::uint32_t& head = m_Slots[0][m_CurrentTick & SLOT_MASK];
+        while (head != INVALID_INDEX) {
+            std::uint32_t index = head;
+            Timer&        timer = GetTimer(index);
+            Unlink(index);
+
+            timer.State = TimerState::Firing;
+            timer.Invoke(timer.Storage.data());
+
+            if (timer.State == TimerState::Firing && timer.Interval > 0) {
+                timer.State = TimerState::Scheduled;
+                timer.Expires += timer.Interval;
+                Insert(index);
+            }
+            else {
+                FreeTimer(index);
+            }
+        }
+    }
+} // namespace Astrelis
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "Astrelis/Core/Pointer.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Time.hpp"
+
+namespace Astrelis {
+    /// @brief Identifies a scheduled timer, the handle is invalidated once the timer has fired or is cancelled
+    struct TimerHandle {
+        static constexpr std::uint32_t INVALID_INDEX = std::numeric_limits<std::uint32_t>::max();
+
+        std::uint32_t Index      = INVALID_INDEX;
+        std::uint32_t Generation = 0;
+
+        [[nodiscard]] bool IsValid() const noexcept {
+            return Index != INVALID_INDEX;
+        }
+    };
+
+    /**
+    * @brief Schedules one shot and repeating callbacks, using a hierarchical timing wheel
+    * Timers are kept in 4 levels of 256 slots, each level covering 256 times the range of the one below it. Scheduling
+    * and cancelling are O(1), and advancing only touches the timers that expire, or that move down a level.
+    * Timers that expire in the same tick fire in no particular order.
+    * Timers live in a pool that grows in chunks, and callbacks are stored inline (up to CALLBACK_SIZE bytes),
+    * so scheduling a timer does not allocate once the pool is warm.
+    * The application advances its wheel once per frame with the frame time, @see Time::GetTimers
+    */
+    class TimerWheel {
+    public:
+        static constexpr std::size_t CALLBACK_SIZE = 48;
+        static constexpr std::size_t LEVEL_COUNT   = 4;
+        static constexpr std::size_t SLOT_BITS     = 8;
+        static constexpr std::size_t SLOT_COUNT    = 1U << SLOT_BITS;
+
+        /// @param resolution The length of a tick, delays are rounded up to whole ticks
+        explicit TimerWheel(
+            Milliseconds resolution = Milliseconds(std::chrono::duration<double, std::milli>(1.0)));
+        ~TimerWheel();
+        TimerWheel(const TimerWheel&)            = delete;
+        TimerWheel& operator=(const TimerWheel&) = delete;
+        TimerWheel(TimerWheel&&)                 = delete;
+        TimerWheel& operator=(TimerWheel&&)      = delete;
+
+        /// @brief Calls the callback once, after the delay
+        template<typename Fn> TimerHandle Schedule(Milliseconds delay, Fn&& callback) {
+            return Add(ToTicks(delay), 0, std::forward<Fn>(callback));
+        }
+
+        /// @brief Calls the callback every interval, until it is cancelled
+        template<typename Fn> TimerHandle ScheduleRepeating(Milliseconds interval, Fn&& callback) {
+            std::uint64_t ticks = ToTicks(interval);
+            return Add(ticks, ticks, std::forward<Fn>(callback));
+        }
+
+        /// @brief Cancels a timer, this can be called from inside timer callbacks
+        /// @return false if the timer already fired or was cancelled
+        bool Cancel(TimerHandle handle);
+        [[nodiscard]] bool IsActive(TimerHandle handle) const;
+
+        /// @brief Advances the wheel, and fires all of the timers that expire in order of expiry
+        void Advance(Milliseconds deltaTime);
+
+        [[nodiscard]] std::size_t GetActiveCount() const noexcept {
+            return m_ActiveCount;
+        }
+
+        [[nodiscard]] std::uint64_t GetCurrentTick() const noexcept {
+            return m_CurrentTick;
+        }
+    private:
+        static constexpr std::uint32_t INVALID_INDEX = TimerHandle::INVALID_INDEX;
+        static constexpr std::size_t   CHUNK_SIZE    = 256;
+
+        enum class TimerState : std::uint8_t {
+            Free,
+            Scheduled,
+            Firing,
+            Cancelled,
+        };
+
+        struct Timer {
+            std::uint64_t Expires    = 0;
+            std::uint64_t Interval   = 0;
+            std::uint32_t Next       = INVALID_INDEX;
+            std::uint32_t Prev       = INVALID_INDEX;
+            std::uint32_t Generation = 0;
+            std::uint16_t Bucket     = 0;
+            TimerState    State      = TimerState::Free;
+            void (*Invoke)(void*)    = nullptr;
+            void (*Destroy)(void*)   = nullptr;
+            alignas(std::max_align_t) std::array<std::byte, CALLBACK_SIZE> Storage {};
+        };
+
+        template<typename Fn>
+        TimerHandle Add(std::uint64_t delayTicks, std::uint64_t intervalTicks, Fn&& callback) {
+            using CallbackType = std::decay_t<Fn>;
+            static_assert(sizeof(CallbackType) <= CALLBACK_SIZE,
+                "Timer callback is too large, capture less or capture a pointer");
+            static_assert(alignof(CallbackType) <= alignof(std::max_align_t));
+
+            std::uint32_t index = AllocateTimer();
+            Timer&        timer = GetTimer(index);
+            new (timer.Storage.data()) CallbackType(std::forward<Fn>(callback));
+            timer.Invoke   = [](void* ptr) { (*static_cast<CallbackType*>(ptr))(); };
+            timer.Destroy  = [](void* ptr) { static_cast<CallbackType*>(ptr)->~CallbackType(); };
+            timer.Expires  = m_CurrentTick + delayTicks;
+            timer.Interval = intervalTicks;
+            timer.State    = TimerState::Scheduled;
+            Insert(index);
+            return TimerHandle {index, timer.Generation};
+        }
+
+        std::uint64_t ToTicks(Milliseconds time) const;
+        Timer&        GetTimer(std::uint32_t index) const;
+        std::uint32_t AllocateTimer();
+        void          FreeTimer(std::uint32_t index);
+        void          Insert(std::uint32_t index);
+        void          Unlink(std::uint32_t index);
+        void          Cascade(std::size_t level, std::size_t slot);
+        void          Tick();
+
+        double        m_TicksPerMillisecond;
+        double        m_PendingTicks = 0.0;
+        std::uint64_t m_CurrentTick  = 0;
+        std::size_t   m_ActiveCount  = 0;
+        std::uint32_t m_FreeList     = INVALID_INDEX;
+        // Timers are allocated in chunks, so they never move when the pool grows
+        std::vector<ScopedPtr<std::array<Timer, CHUNK_SIZE>>>          m_Chunks;
+        std::array<std::array<std::uint32_t, SLOT_COUNT>, LEVEL_COUNT> m_Slots {};
+    };
+} // namespace Astrelis
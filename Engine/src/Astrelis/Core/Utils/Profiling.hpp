@@ -25,3 +25,21 @@
 /// @def ASTRELIS_PROFILE_GPU_SCOPE(name)
 /// @brief A wrapper for Tracy's FrameMark
 #define ASTRELIS_PROFILE_END_FRAME() FrameMark
+/// @def ASTRELIS_PROFILE_THREAD(name)
+/// @brief A wrapper for Tracy's SetThreadName
+#define ASTRELIS_PROFILE_THREAD(name) tracy::SetThreadName(name)
+/// @def ASTRELIS_PROFILE_PLOT(name, value)
+/// @brief A wrapper for Tracy's TracyPlot
+#define ASTRELIS_PROFILE_PLOT(name, value) TracyPlot(name, value)
+
+#ifdef ASTRELIS_PROFILE_MEMORY
+    /// @def ASTRELIS_PROFILE_ALLOC(ptr, size, name)
+    /// @brief A wrapper for Tracy's TracyAllocN, name has to be a literal
+    #define ASTRELIS_PROFILE_ALLOC(ptr, size, name) TracyAllocN(ptr, size, name)
+    /// @def ASTRELIS_PROFILE_FREE(ptr, name)
+    /// @brief A wrapper for Tracy's TracyFreeN
+    #define ASTRELIS_PROFILE_FREE(ptr, name) TracyFreeN(ptr, name)
+#else
+    #define ASTRELIS_PROFILE_ALLOC(ptr, size, name)
+    #define ASTRELIS_PROFILE_FREE(ptr, name)
+#endif
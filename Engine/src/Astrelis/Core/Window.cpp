@@ -2,6 +2,8 @@
 
 #include "Astrelis/Core/Base.hpp"
 
+#include "Platform/Headless/HeadlessWindow.hpp"
+
 #ifdef ASTRELIS_PLATFORM_LINUX
     #include "Platform/Linux/LinuxWindow.hpp"
 #elif defined(ASTRELIS_PLATFORM_MACOS)
@@ -13,6 +15,12 @@
 namespace Astrelis {
     Result<RefPtr<Window>, std::string> Window::Create(const WindowProps& props) {
         ASTRELIS_PROFILE_FUNCTION();
+        if (props.Headless) {
+            return HeadlessWindow::Create(props).MapMove([](RefPtr<HeadlessWindow>&& window) {
+                return static_cast<RefPtr<Window>>(window);
+            });
+        }
+
 #ifdef ASTRELIS_PLATFORM_LINUX
         return LinuxWindow::Create(props).MapMove([](RefPtr<LinuxWindow>&& window) {
             return static_cast<RefPtr<Window>>(window);
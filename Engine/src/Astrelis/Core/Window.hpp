@@ -1,9 +1,8 @@
 #pragma once
 
-#include "Astrelis/Events/Event.hpp"
+#include "Astrelis/Events/EventQueue.hpp"
 #include "Astrelis/Renderer/GraphicsContext.hpp"
 
-#include <functional>
 #include <string>
 #include <utility>
 
@@ -12,12 +11,12 @@
 #include "Result.hpp"
 
 namespace Astrelis {
-    using WindowEventCallback = std::function<void(Event&)>;
-
     struct WindowProps {
         std::string  Title;
         Dimension2Du Dimensions;
         bool         VSync;
+        /// @brief Creates a window without a native window or graphics context, @see HeadlessWindow
+        bool Headless = false;
 
         explicit WindowProps(const std::string& title = "Astrelis Engine",
             Dimension2Du dimensions = {1'280, 720}, bool vsync = true)
@@ -26,14 +25,13 @@ namespace Astrelis {
     };
 
     struct BaseWindowData {
-        std::string         Title;
-        Dimension2Du        Dimensions;
-        WindowEventCallback EventCallback;
+        std::string  Title;
+        Dimension2Du Dimensions;
+        /// @brief The queue that the native event callbacks post into, set by Window::SetEventQueue
+        EventQueue* Events = nullptr;
 
-        BaseWindowData(
-            std::string title, Dimension2Du dimensions,
-            WindowEventCallback callback = [](Event&) {})
-            : Title(std::move(title)), Dimensions(dimensions), EventCallback(std::move(callback)) {
+        BaseWindowData(std::string title, Dimension2Du dimensions)
+            : Title(std::move(title)), Dimensions(dimensions) {
         }
     };
 
@@ -50,9 +48,10 @@ namespace Astrelis {
         virtual void EndFrame()   = 0;
         virtual void OnUpdate()   = 0;
 
-        virtual void    WaitForEvents()                                       = 0;
-        virtual void    SetEventCallback(const WindowEventCallback& callback) = 0;
-        virtual Rect2Di GetViewportBounds() const                             = 0;
+        virtual void WaitForEvents() = 0;
+        /// @brief Events of the window are posted into the queue while polling, and dispatched when it is drained
+        virtual void    SetEventQueue(EventQueue& queue) = 0;
+        virtual Rect2Di GetViewportBounds() const        = 0;
 
         virtual std::uint32_t GetWidth() const  = 0;
         virtual std::uint32_t GetHeight() const = 0;
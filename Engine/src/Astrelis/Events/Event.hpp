@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 
@@ -29,6 +30,9 @@ namespace Astrelis {
         MouseLeft,
     };
 
+    inline constexpr std::size_t EVENT_TYPE_COUNT =
+        static_cast<std::size_t>(EventType::MouseLeft) + 1;
+
     enum class EventCategory : std::uint32_t {
         None        = 0,
         Application = 1U << 0U,
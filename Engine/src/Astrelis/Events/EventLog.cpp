@@ -0,0 +1,131 @@
+#include "EventLog.hpp"
+
+#include "Astrelis/Core/Base.hpp"
+
+#include <fstream>
+#include <system_error>
+
+namespace Astrelis {
+    namespace {
+        struct EventLogHeader {
+            std::uint32_t Magic;
+            std::uint32_t Version;
+            std::uint32_t FrameCount;
+            std::uint32_t EventCount;
+        };
+
+        template<typename T>
+        void WriteArray(std::ofstream& file, const T* data, std::size_t count) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            file.write(reinterpret_cast<const char*>(data),
+                static_cast<std::streamsize>(sizeof(T) * count));
+        }
+
+        template<typename T> bool ReadArray(std::ifstream& file, T* data, std::size_t count) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            file.read(
+                reinterpret_cast<char*>(data), static_cast<std::streamsize>(sizeof(T) * count));
+            return file.good();
+        }
+    } // namespace
+
+    void EventLog::BeginFrame(Milliseconds deltaTime) {
+        m_Frames.push_back(Frame {
+            static_cast<double>(deltaTime), static_cast<std::uint32_t>(m_Events.size()), 0});
+    }
+
+    bool EventLog::Record(const EventRecord& record) {
+        if (m_Frames.empty() || !record.IsValid()) {
+            return false;
+        }
+
+        m_Events.push_back(record);
+        m_Frames.back().EventCount++;
+        return true;
+    }
+
+    void EventLog::Clear() {
+        m_Frames.clear();
+        m_Events.clear();
+    }
+
+    Milliseconds EventLog::GetDeltaTime(std::size_t frame) const {
+        ASTRELIS_CORE_ASSERT(frame < m_Frames.size(), "Frame is out of range");
+        return Milliseconds(std::chrono::duration<double, std::milli>(m_Frames[frame].DeltaTimeMs));
+    }
+
+    std::span<const EventRecord> EventLog::GetEvents(std::size_t frame) const {
+        ASTRELIS_CORE_ASSERT(frame < m_Frames.size(), "Frame is out of range");
+        const Frame& recorded = m_Frames[frame];
+        return std::span<const EventRecord>(m_Events).subspan(
+            recorded.FirstEvent, recorded.EventCount);
+    }
+
+    Result<EmptyType, std::string> EventLog::Save(const std::filesystem::path& path) const {
+        ASTRELIS_PROFILE_FUNCTION();
+        std::ofstream file(path, std::ios::binary);
+        if (!file.is_open()) {
+            return "Failed to open file for writing";
+        }
+
+        EventLogHeader header {MAGIC, VERSION, static_cast<std::uint32_t>(m_Frames.size()),
+            static_cast<std::uint32_t>(m_Events.size())};
+        WriteArray(file, &header, 1);
+        WriteArray(file, m_Frames.data(), m_Frames.size());
+        WriteArray(file, m_Events.data(), m_Events.size());
+
+        if (!file.good()) {
+            return "Failed to write event log";
+        }
+        return Result<EmptyType, std::string>::Ok();
+    }
+
+    Result<EventLog, std::string> EventLog::Load(const std::filesystem::path& path) {
+        ASTRELIS_PROFILE_FUNCTION();
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) {
+            return "Failed to open file for reading";
+        }
+
+        EventLogHeader header {};
+        if (!ReadArray(file, &header, 1) || header.Magic != MAGIC) {
+            return "File is not an event log";
+        }
+
+        if (header.Version != VERSION) {
+            return "Unsupported event log version";
+        }
+
+        // Checked before allocating, so a corrupt header can not request gigabytes of memory
+        const std::uint64_t expectedSize = sizeof(EventLogHeader)
+            + sizeof(Frame) * static_cast<std::uint64_t>(header.FrameCount)
+            + sizeof(EventRecord) * static_cast<std::uint64_t>(header.EventCount);
+        std::error_code     error;
+        const std::uint64_t fileSize = std::filesystem::file_size(path, error);
+        if (error || fileSize != expectedSize) {
+            return "Event log size does not match its header";
+        }
+
+        EventLog log;
+        log.m_Frames.resize(header.FrameCount);
+        log.m_Events.resize(header.EventCount);
+        if (!ReadArray(file, log.m_Frames.data(), log.m_Frames.size())
+            || !ReadArray(file, log.m_Events.data(), log.m_Events.size())) {
+            return "Event log is truncated";
+        }
+
+        for (const Frame& frame : log.m_Frames) {
+            const std::uint64_t lastEvent =
+                static_cast<std::uint64_t>(frame.FirstEvent) + frame.EventCount;
+            if (lastEvent > log.m_Events.size()) {
+                return "Event log frame is out of range";
+            }
+        }
+        for (const EventRecord& record : log.m_Events) {
+            if (!record.IsValid()) {
+                return "Event log contains an invalid event";
+            }
+        }
+        return log;
+    }
+} // namespace Astrelis
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Astrelis/Core/Allocator.hpp"
+#include "Astrelis/Core/Result.hpp"
+#include "Astrelis/Core/Time.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "EventRecord.hpp"
+
+namespace Astrelis {
+    /**
+    * @brief A log of the frame times and the events dispatched in every frame, for deterministic replays
+    * The application records into the log when ApplicationSpecification::RecordEventLog is set, and replays it when
+    * ApplicationSpecification::ReplayEventLog is set. The file format is a small header, followed by the frames and
+    * the events as flat arrays in native endianness, so logs are not portable between architectures.
+    */
+    class EventLog {
+    public:
+        static constexpr std::uint32_t MAGIC   = 0x474C4541; // "AELG"
+        static constexpr std::uint32_t VERSION = 1;
+
+        /// @brief Starts recording a new frame, events are recorded into the last frame
+        void BeginFrame(Milliseconds deltaTime);
+        /// @brief Records an event into the current frame
+        /// @return false if the event can not be replayed, or if no frame was started yet
+        bool Record(const EventRecord& record);
+        void Clear();
+
+        [[nodiscard]] std::size_t GetFrameCount() const noexcept {
+            return m_Frames.size();
+        }
+
+        [[nodiscard]] std::size_t GetEventCount() const noexcept {
+            return m_Events.size();
+        }
+
+        [[nodiscard]] Milliseconds GetDeltaTime(std::size_t frame) const;
+        /// @brief The events of a frame in recorded order
+        [[nodiscard]] std::span<const EventRecord> GetEvents(std::size_t frame) const;
+
+        Result<EmptyType, std::string>       Save(const std::filesystem::path& path) const;
+        static Result<EventLog, std::string> Load(const std::filesystem::path& path);
+    private:
+        struct Frame {
+            double        DeltaTimeMs;
+            std::uint32_t FirstEvent;
+            std::uint32_t EventCount;
+        };
+
+        std::vector<Frame, StlAllocator<Frame>> m_Frames {StlAllocator<Frame>(MemoryTag::Events)};
+        std::vector<EventRecord, StlAllocator<EventRecord>> m_Events {
+            StlAllocator<EventRecord>(MemoryTag::Events)};
+    };
+} // namespace Astrelis
@@ -0,0 +1,53 @@
+#include "EventQueue.hpp"
+
+#include "Astrelis/Core/Base.hpp"
+
+namespace Astrelis {
+    EventQueue::EventQueue() {
+        for (std::size_t i = 0; i < CAPACITY; i++) {
+            m_Slots[i].Sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool EventQueue::Post(const EventRecord& record) noexcept {
+        std::uint64_t position = m_Tail.load(std::memory_order_relaxed);
+        while (true) {
+            const std::uint64_t sequence =
+                m_Slots[position & MASK].Sequence.load(std::memory_order_acquire);
+            const auto difference =
+                static_cast<std::int64_t>(sequence) - static_cast<std::int64_t>(position);
+            if (difference == 0) {
+                if (m_Tail.compare_exchange_weak(
+                        position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+            else if (difference < 0) {
+                // The consumer has not freed this slot yet, the queue is full
+                m_DroppedCount.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            else {
+                // Another producer claimed the slot
+                position = m_Tail.load(std::memory_order_relaxed);
+            }
+        }
+
+        Slot& slot  = m_Slots[position & MASK];
+        slot.Record = record;
+        slot.Sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool EventQueue::Pop(EventRecord& record) noexcept {
+        Slot& slot = m_Slots[m_Head & MASK];
+        if (slot.Sequence.load(std::memory_order_acquire) != m_Head + 1) {
+            return false;
+        }
+
+        record = slot.Record;
+        slot.Sequence.store(m_Head + CAPACITY, std::memory_order_release);
+        m_Head++;
+        return true;
+    }
+} // namespace Astrelis
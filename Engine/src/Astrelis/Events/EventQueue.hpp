@@ -0,0 +1,68 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "EventRecord.hpp"
+
+namespace Astrelis {
+    /// @brief A fixed capacity, lock free queue of event records, with many producers and a single consumer
+    /// The window callbacks post records while polling, and any other thread (jobs, background systems) can post
+    /// records at the same time. The application drains the queue once per frame on the main thread.
+    /// Each slot carries a sequence number, so a producer claims a slot with a single CAS and publishes it
+    /// without blocking the consumer or the other producers.
+    class EventQueue {
+    public:
+        static constexpr std::size_t CAPACITY = 4'096;
+
+        EventQueue();
+        ~EventQueue()                            = default;
+        EventQueue(const EventQueue&)            = delete;
+        EventQueue& operator=(const EventQueue&) = delete;
+        EventQueue(EventQueue&&)                 = delete;
+        EventQueue& operator=(EventQueue&&)      = delete;
+
+        /// @brief Adds a record to the queue, can be called from any thread
+        /// @return false if the queue is full, the record is dropped
+        bool Post(const EventRecord& record) noexcept;
+
+        /// @brief Passes every record that was posted before the call to the function, in posting order
+        /// Records that are posted while draining are left for the next drain. Only the consumer thread may call this.
+        /// @return The number of drained records
+        template<typename Fn> std::size_t Drain(Fn&& func) {
+            const std::uint64_t end   = m_Tail.load(std::memory_order_acquire);
+            std::size_t         count = 0;
+            EventRecord         record {};
+            while (m_Head < end && Pop(record)) {
+                func(record);
+                count++;
+            }
+            return count;
+        }
+
+        /// @brief The number of records that were dropped because the queue was full
+        [[nodiscard]] std::uint64_t GetDroppedCount() const noexcept {
+            return m_DroppedCount.load(std::memory_order_relaxed);
+        }
+    private:
+        static constexpr std::uint64_t MASK = CAPACITY - 1;
+        static_assert((CAPACITY & MASK) == 0, "Capacity must be a power of two");
+
+        struct Slot {
+            // The position when the slot is free, and the position + 1 when it holds a record
+            std::atomic<std::uint64_t> Sequence;
+            EventRecord                Record;
+        };
+
+        /// @brief Removes the record at the head, fails if the producer of that slot has not published it yet
+        bool Pop(EventRecord& record) noexcept;
+
+        std::array<Slot, CAPACITY> m_Slots;
+        // The producers and the consumer write different cache lines
+        alignas(64) std::atomic<std::uint64_t> m_Tail = 0;
+        std::atomic<std::uint64_t> m_DroppedCount     = 0;
+        alignas(64) std::uint64_t m_Head              = 0;
+    };
+} // namespace Astrelis
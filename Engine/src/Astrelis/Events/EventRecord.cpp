@@ -0,0 +1,174 @@
+#include "EventRecord.hpp"
+
+#include "Astrelis/Core/Base.hpp"
+
+#include <array>
+#include <type_traits>
+#include <utility>
+
+#include "KeyEvent.hpp"
+#include "MouseEvent.hpp"
+#include "WindowEvent.hpp"
+
+namespace Astrelis {
+    namespace {
+        using DispatchFn = void (*)(const EventRecord& record, const EventCallback& callback);
+
+        struct EventTypeInfo {
+            std::uint32_t CategoryFlags;
+            DispatchFn    Dispatch;
+        };
+
+        static_assert(std::is_trivially_copyable_v<EventRecord>);
+        static_assert(sizeof(EventRecord) == 12, "EventRecord should not have padding");
+
+        template<typename T, typename... Args>
+        void DispatchAs(const EventCallback& callback, Args&&... args) {
+            T event(std::forward<Args>(args)...);
+            callback(event);
+        }
+
+        constexpr std::uint32_t APPLICATION =
+            static_cast<std::uint32_t>(EventCategory::Application);
+        constexpr std::uint32_t KEYBOARD     = EventCategory::Input | EventCategory::Keyboard;
+        constexpr std::uint32_t MOUSE        = EventCategory::Mouse | EventCategory::Input;
+        constexpr std::uint32_t MOUSE_BUTTON = MOUSE | EventCategory::MouseButton;
+
+        // Indexed by EventType, so the entries have to be in the same order as the enum
+        constexpr std::array<EventTypeInfo, EVENT_TYPE_COUNT> EVENT_TYPES = {{
+            // None
+            {0, nullptr},
+            // WindowClosed
+            {APPLICATION,
+                [](const EventRecord&, const EventCallback& callback) {
+                    DispatchAs<WindowCloseEvent>(callback);
+                }},
+            // WindowResized
+            {APPLICATION,
+                [](const EventRecord& record, const EventCallback& callback) {
+                    DispatchAs<WindowResizedEvent>(callback, record.Data0, record.Data1);
+                }},
+            // ViewportResized
+            {APPLICATION,
+                [](const EventRecord& record, const EventCallback& callback) {
+                    DispatchAs<ViewportResizedEvent>(callback, record.Data0, record.Data1);
+                }},
+            // WindowFocused
+            {APPLICATION,
+                [](const EventRecord&, const EventCallback& callback) {
+                    DispatchAs<WindowFocusedEvent>(callback);
+                }},
+            // WindowLostFocus
+            {APPLICATION,
+                [](const EventRecord&, const EventCallback& callback) {
+                    DispatchAs<WindowLostFocusEvent>(callback);
+                }},
+            // WindowMoved
+            {APPLICATION,
+                [](const EventRecord& record, const EventCallback& callback) {
+                    DispatchAs<WindowMovedEvent>(callback, record.Data0, record.Data1);
+                }},
+            // WindowMaximized
+            {APPLICATION,
+                [](const EventRecord&, const EventCallback& callback) {
+                    DispatchAs<WindowMaximizedEvent>(callback);
+                }},
+            // WindowMinimized
+            {APPLICATION,
+                [](const EventRecord&, const EventCallback& callback) {
+                    DispatchAs<WindowMinimizedEvent>(callback);
+                }},
+            // WindowRestored
+            {APPLICATION,
+                [](const EventRecord&, const EventCallback& callback) {
+                    DispatchAs<WindowRestoredEvent>(callback);
+                }},
+            // WindowRefresh
+            {APPLICATION,
+                [](const EventRecord&, const EventCallback& callback) {
+                    DispatchAs<WindowRefreshEvent>(callback);
+                }},
+            // WindowScale
+            {APPLICATION,
+                [](const EventRecord& record, const EventCallback& callback) {
+                    DispatchAs<WindowScaleEvent>(callback, record.GetFloat0(), record.GetFloat1());
+                }},
+            // AppRender has no event class
+            {APPLICATION, nullptr},
+            // KeyPressed
+            {KEYBOARD,
+                [](const EventRecord& record, const EventCallback& callback) {
+                    DispatchAs<KeyPressedEvent>(
+                        callback, static_cast<KeyCode>(record.Data0), record.Data1 != 0);
+                }},
+            // KeyReleased
+            {KEYBOARD,
+                [](const EventRecord& record, const EventCallback& callback) {
+                    DispatchAs<KeyReleasedEvent>(callback, static_cast<KeyCode>(record.Data0));
+                }},
+            // KeyTyped
+            {KEYBOARD,
+                [](const EventRecord& record, const EventCallback& callback) {
+                    DispatchAs<KeyTypedEvent>(callback, static_cast<KeyCode>(record.Data0));
+                }},
+            // MouseButtonPressed
+            {MOUSE_BUTTON,
+                [](const EventRecord& record, const EventCallback& callback) {
+                    DispatchAs<MouseButtonPressedEvent>(
+                        callback, static_cast<MouseCode>(record.Data0));
+                }},
+            // MouseButtonReleased
+            {MOUSE_BUTTON,
+                [](const EventRecord& record, const EventCallback& callback) {
+                    DispatchAs<MouseButtonReleasedEvent>(
+                        callback, static_cast<MouseCode>(record.Data0));
+                }},
+            // MouseMoved
+            {MOUSE,
+                [](const EventRecord& record, const EventCallback& callback) {
+                    DispatchAs<MouseMovedEvent>(callback, record.GetFloat0(), record.GetFloat1());
+                }},
+            // MouseScrolled
+            {MOUSE,
+                [](const EventRecord& record, const EventCallback& callback) {
+                    DispatchAs<MouseScrolledEvent>(
+                        callback, record.GetFloat0(), record.GetFloat1());
+                }},
+            // MouseEntered
+            {MOUSE,
+                [](const EventRecord&, const EventCallback& callback) {
+                    DispatchAs<MouseEnteredEvent>(callback);
+                }},
+            // MouseLeft
+            {MOUSE,
+                [](const EventRecord&, const EventCallback& callback) {
+                    DispatchAs<MouseLeftEvent>(callback);
+                }},
+        }};
+
+        const EventTypeInfo* GetTypeInfo(EventType type) {
+            const auto index = static_cast<std::size_t>(type);
+            return index < EVENT_TYPES.size() ? &EVENT_TYPES[index] : nullptr;
+        }
+    } // namespace
+
+    bool EventRecord::IsValid() const noexcept {
+        const EventTypeInfo* info = GetTypeInfo(Type);
+        return info != nullptr && info->Dispatch != nullptr;
+    }
+
+    std::uint32_t GetEventCategoryFlags(EventType type) noexcept {
+        const EventTypeInfo* info = GetTypeInfo(type);
+        return info != nullptr ? info->CategoryFlags : 0;
+    }
+
+    void EventRecord::Dispatch(const EventCallback& callback) const {
+        if (!IsValid()) {
+            ASTRELIS_CORE_LOG_WARN(
+                "Skipping event record of unknown type {0}", static_cast<std::uint32_t>(Type));
+            return;
+        }
+
+        EVENT_TYPES[static_cast<std::size_t>(Type)].Dispatch(*this, callback);
+    }
+} // namespace Astrelis
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <functional>
+
+#include "Event.hpp"
+
+namespace Astrelis {
+    using EventCallback = std::function<void(Event&)>;
+
+    /// @brief The same flags as Event::GetCategoryFlags of the event class of the type, 0 for unknown types
+    [[nodiscard]] std::uint32_t GetEventCategoryFlags(EventType type) noexcept;
+
+    /// @brief A plain copy of an event, which can be queued and recorded without allocations or virtual calls
+    /// The meaning of the data depends on the type, Data0 holds the key code, mouse button, x position, width or
+    /// x offset, and Data1 holds the key repeat flag, y position, height or y offset. Floats are stored bit cast.
+    struct EventRecord {
+        EventType     Type;
+        std::uint32_t Data0;
+        std::uint32_t Data1;
+
+        static EventRecord Create(
+            EventType type, std::uint32_t data0 = 0, std::uint32_t data1 = 0) noexcept {
+            return EventRecord {type, data0, data1};
+        }
+
+        static EventRecord CreateFloat(EventType type, float data0, float data1) noexcept {
+            return EventRecord {
+                type, std::bit_cast<std::uint32_t>(data0), std::bit_cast<std::uint32_t>(data1)};
+        }
+
+        [[nodiscard]] float GetFloat0() const noexcept {
+            return std::bit_cast<float>(Data0);
+        }
+
+        [[nodiscard]] float GetFloat1() const noexcept {
+            return std::bit_cast<float>(Data1);
+        }
+
+        /// @brief Whether the type has an event class that the record can be dispatched as
+        [[nodiscard]] bool IsValid() const noexcept;
+
+        [[nodiscard]] std::uint32_t GetCategoryFlags() const noexcept {
+            return GetEventCategoryFlags(Type);
+        }
+
+        [[nodiscard]] bool IsInCategory(const EventCategory& category) const noexcept {
+            return (GetCategoryFlags() & static_cast<std::uint32_t>(category)) != 0U;
+        }
+
+        /// @brief Constructs the typed event on the stack and passes it to the callback
+        /// The event class is looked up in a table indexed by the type, records of unknown types are skipped.
+        void Dispatch(const EventCallback& callback) const;
+
+        bool operator==(const EventRecord& other) const noexcept = default;
+    };
+} // namespace Astrelis
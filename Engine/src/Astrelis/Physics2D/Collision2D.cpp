@@ -0,0 +1,591 @@
+#include "Collision2D.hpp"
+
+#include "Astrelis/Core/Base.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numbers>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define ASTRELIS_COLLISION_SSE 1
+    #include <xmmintrin.h>
+#else
+    #define ASTRELIS_COLLISION_SSE 0
+#endif
+
+namespace Astrelis {
+    namespace {
+        // Shorter directions are treated as zero
+        constexpr float EPSILON = 1.0e-6F;
+        // Hull points closer than this are merged
+        constexpr float WELD_DISTANCE = 0.0025F;
+        // How much further the second polygon has to be separated to provide the reference face, so the
+        // choice does not flip between steps for shapes resting on each other
+        constexpr float REFERENCE_TOLERANCE = 0.0005F;
+        // Clip vertex ids for points created by the side planes of the reference face
+        constexpr std::uint32_t SIDE_CLIP_ID = Shape2D::MAX_POLYGON_VERTICES;
+
+        struct Point {
+            float X;
+            float Y;
+        };
+
+        struct ClipVertex {
+            Point         Position;
+            std::uint32_t Id;
+        };
+
+        Point ToWorld(const RigidTransform2D& transform, float posX, float posY) {
+            return Point {transform.Cos * posX - transform.Sin * posY + transform.X,
+                transform.Sin * posX + transform.Cos * posY + transform.Y};
+        }
+
+        Point ToLocal(const RigidTransform2D& transform, float posX, float posY) {
+            const float relX = posX - transform.X;
+            const float relY = posY - transform.Y;
+            return Point {transform.Cos * relX + transform.Sin * relY,
+                -transform.Sin * relX + transform.Cos * relY};
+        }
+
+        Point Rotate(const RigidTransform2D& transform, float dirX, float dirY) {
+            return Point {transform.Cos * dirX - transform.Sin * dirY,
+                transform.Sin * dirX + transform.Cos * dirY};
+        }
+
+        /// The transform of other, relative to the space of base
+        RigidTransform2D Relative(const RigidTransform2D& base, const RigidTransform2D& other) {
+            const Point position = ToLocal(base, other.X, other.Y);
+            return RigidTransform2D {position.X, position.Y,
+                base.Cos * other.Cos + base.Sin * other.Sin,
+                base.Cos * other.Sin - base.Sin * other.Cos};
+        }
+
+        float Cross(Point origin, Point lhs, Point rhs) {
+            return (lhs.X - origin.X) * (rhs.Y - origin.Y)
+                - (lhs.Y - origin.Y) * (rhs.X - origin.X);
+        }
+
+        void SetPolygon(Shape2D& shape, std::span<const Point> vertices) {
+            const auto count  = static_cast<std::uint32_t>(vertices.size());
+            shape.Type        = ShapeType2D::Polygon;
+            shape.VertexCount = count;
+            shape.Radius      = 0.0F;
+            for (std::uint32_t i = 0; i < count; i++) {
+                const Point current = vertices[i];
+                const Point next    = vertices[(i + 1) % count];
+                const float edgeX   = next.X - current.X;
+                const float edgeY   = next.Y - current.Y;
+                const float length  = std::sqrt(edgeX * edgeX + edgeY * edgeY);
+
+                shape.VertexX[i] = current.X;
+                shape.VertexY[i] = current.Y;
+                shape.NormalX[i] = edgeY / length;
+                shape.NormalY[i] = -edgeX / length;
+                shape.Radius     = std::max(
+                    shape.Radius, std::sqrt(current.X * current.X + current.Y * current.Y));
+            }
+
+            for (std::uint32_t i = count; i < Shape2D::MAX_POLYGON_VERTICES; i++) {
+                shape.VertexX[i] = shape.VertexX[0];
+                shape.VertexY[i] = shape.VertexY[0];
+                shape.NormalX[i] = shape.NormalX[0];
+                shape.NormalY[i] = shape.NormalY[0];
+            }
+        }
+
+        /**
+        * The largest separation of the points from any edge of the polygon, which is positive if there is a
+        * separating axis. The points are in the space of the polygon.
+        */
+        float FindMaxSeparation(const Shape2D& polygon, std::span<const float> pointX,
+            std::span<const float> pointY, std::uint32_t& edge) {
+            alignas(16) Shape2D::PolygonArray separations;
+#if ASTRELIS_COLLISION_SSE
+            for (std::uint32_t group = 0; group < polygon.VertexCount; group += 4) {
+                const __m128 normalX  = _mm_load_ps(&polygon.NormalX[group]);
+                const __m128 normalY  = _mm_load_ps(&polygon.NormalY[group]);
+                const __m128 vertexX  = _mm_load_ps(&polygon.VertexX[group]);
+                const __m128 vertexY  = _mm_load_ps(&polygon.VertexY[group]);
+                __m128       smallest = _mm_set1_ps(std::numeric_limits<float>::max());
+                for (std::size_t point = 0; point < pointX.size(); point++) {
+                    const __m128 relX = _mm_sub_ps(_mm_set1_ps(pointX[point]), vertexX);
+                    const __m128 relY = _mm_sub_ps(_mm_set1_ps(pointY[point]), vertexY);
+                    smallest          = _mm_min_ps(smallest,
+                                 _mm_add_ps(_mm_mul_ps(normalX, relX), _mm_mul_ps(normalY, relY)));
+                }
+                _mm_store_ps(&separations[group], smallest);
+            }
+#else
+            for (std::uint32_t i = 0; i < polygon.VertexCount; i++) {
+                separations[i] = std::numeric_limits<float>::max();
+                for (std::size_t point = 0; point < pointX.size(); point++) {
+                    const float relX = pointX[point] - polygon.VertexX[i];
+                    const float relY = pointY[point] - polygon.VertexY[i];
+                    separations[i]   = std::min(
+                        separations[i], polygon.NormalX[i] * relX + polygon.NormalY[i] * relY);
+                }
+            }
+#endif
+
+            edge = 0;
+            for (std::uint32_t i = 1; i < polygon.VertexCount; i++) {
+                if (separations[i] > separations[edge]) {
+                    edge = i;
+                }
+            }
+            return separations[edge];
+        }
+
+        /// FindMaxSeparation for the vertices of another polygon, placed relative to the first one
+        float FindMaxSeparation(const Shape2D& polygon, const Shape2D& other,
+            const RigidTransform2D& relative, std::uint32_t& edge) {
+            Shape2D::PolygonArray pointX;
+            Shape2D::PolygonArray pointY;
+            for (std::uint32_t i = 0; i < other.VertexCount; i++) {
+                const Point point = ToWorld(relative, other.VertexX[i], other.VertexY[i]);
+                pointX[i]         = point.X;
+                pointY[i]         = point.Y;
+            }
+            return FindMaxSeparation(polygon, std::span(pointX.data(), other.VertexCount),
+                std::span(pointY.data(), other.VertexCount), edge);
+        }
+
+        /// Keeps the part of the segment behind the plane, points created by the plane get the clip id
+        std::uint32_t ClipSegment(std::span<const ClipVertex, 2> input,
+            std::span<ClipVertex, 2> output, Point normal, float offset, std::uint32_t clipId) {
+            const float distance0 =
+                normal.X * input[0].Position.X + normal.Y * input[0].Position.Y - offset;
+            const float distance1 =
+                normal.X * input[1].Position.X + normal.Y * input[1].Position.Y - offset;
+
+            std::uint32_t count = 0;
+            if (distance0 <= 0.0F) {
+                output[count++] = input[0];
+            }
+            if (distance1 <= 0.0F) {
+                output[count++] = input[1];
+            }
+            if (distance0 * distance1 < 0.0F) {
+                const float fraction = distance0 / (distance0 - distance1);
+                output[count++]      = ClipVertex {
+                    Point {input[0].Position.X
+                            + fraction * (input[1].Position.X - input[0].Position.X),
+                        input[0].Position.Y
+                            + fraction * (input[1].Position.Y - input[0].Position.Y)},
+                    clipId};
+            }
+            return count;
+        }
+
+        bool CollideCircles(float posAX, float posAY, float radiusA, float posBX, float posBY,
+            float radiusB, float margin, Manifold2D& manifold) {
+            manifold.PointCount = 0;
+
+            const float relX            = posBX - posAX;
+            const float relY            = posBY - posAY;
+            const float distanceSquared = relX * relX + relY * relY;
+            const float reach           = radiusA + radiusB + margin;
+            if (distanceSquared > reach * reach) {
+                return false;
+            }
+
+            const float distance   = std::sqrt(distanceSquared);
+            const bool  valid      = distance > EPSILON;
+            const float normalX    = valid ? relX / distance : 0.0F;
+            const float normalY    = valid ? relY / distance : 1.0F;
+            const float separation = distance - radiusA - radiusB;
+            const float offset     = radiusA + 0.5F * separation;
+
+            manifold.NormalX   = normalX;
+            manifold.NormalY   = normalY;
+            manifold.Points[0] = ContactPoint2D {
+                posAX + normalX * offset, posAY + normalY * offset, separation, 0};
+            manifold.PointCount = 1;
+            return true;
+        }
+
+        bool CollidePolygonCircle(const Shape2D& polygon, const RigidTransform2D& polygonTransform,
+            const Shape2D& circle, const RigidTransform2D& circleTransform, float margin,
+            Manifold2D& manifold) {
+            manifold.PointCount = 0;
+
+            const Point   center = ToLocal(polygonTransform, circleTransform.X, circleTransform.Y);
+            std::uint32_t edge   = 0;
+            const float   separation =
+                FindMaxSeparation(polygon, std::span(&center.X, 1), std::span(&center.Y, 1), edge);
+            if (separation > circle.Radius + margin) {
+                return false;
+            }
+
+            const std::uint32_t next     = (edge + 1) % polygon.VertexCount;
+            float               normalX  = polygon.NormalX[edge];
+            float               normalY  = polygon.NormalY[edge];
+            float               distance = separation;
+            std::uint32_t       id       = edge;
+            if (separation >= EPSILON) {
+                // Outside, the closest feature is either the edge or one of its vertices
+                const Point   vertex1 {polygon.VertexX[edge], polygon.VertexY[edge]};
+                const Point   vertex2 {polygon.VertexX[next], polygon.VertexY[next]};
+                const float   edgeX  = vertex2.X - vertex1.X;
+                const float   edgeY  = vertex2.Y - vertex1.Y;
+                const float   along1 =
+                    (center.X - vertex1.X) * edgeX + (center.Y - vertex1.Y) * edgeY;
+                const float   along2 =
+                    (vertex2.X - center.X) * edgeX + (vertex2.Y - center.Y) * edgeY;
+                std::uint32_t corner = Shape2D::MAX_POLYGON_VERTICES;
+                if (along1 <= 0.0F) {
+                    corner = edge;
+                }
+                else if (along2 <= 0.0F) {
+                    corner = next;
+                }
+
+                if (corner != Shape2D::MAX_POLYGON_VERTICES) {
+                    const float relX = center.X - polygon.VertexX[corner];
+                    const float relY = center.Y - polygon.VertexY[corner];
+                    distance         = std::sqrt(relX * relX + relY * relY);
+                    if (distance > circle.Radius + margin) {
+                        return false;
+                    }
+                    normalX = relX / distance;
+                    normalY = relY / distance;
+                    id      = polygon.VertexCount + corner;
+                }
+            }
+
+            const float contactSeparation = distance - circle.Radius;
+            const float offset            = circle.Radius + 0.5F * contactSeparation;
+            const Point point    = ToWorld(polygonTransform, center.X - normalX * offset,
+                   center.Y - normalY * offset);
+            const Point normal   = Rotate(polygonTransform, normalX, normalY);
+            manifold.NormalX     = normal.X;
+            manifold.NormalY     = normal.Y;
+            manifold.Points[0]   = ContactPoint2D {point.X, point.Y, contactSeparation, id};
+            manifold.PointCount  = 1;
+            return true;
+        }
+
+        bool CollidePolygons(const Shape2D& polygonA, const RigidTransform2D& transformA,
+            const Shape2D& polygonB, const RigidTransform2D& transformB, float margin,
+            Manifold2D& manifold) {
+            manifold.PointCount = 0;
+
+            std::uint32_t edgeA = 0;
+            const float   separationA =
+                FindMaxSeparation(polygonA, polygonB, Relative(transformA, transformB), edgeA);
+            if (separationA > margin) {
+                return false;
+            }
+            std::uint32_t edgeB = 0;
+            const float   separationB =
+                FindMaxSeparation(polygonB, polygonA, Relative(transformB, transformA), edgeB);
+            if (separationB > margin) {
+                return false;
+            }
+
+            const bool              flip      = separationB > separationA + REFERENCE_TOLERANCE;
+            const Shape2D&          reference = flip ? polygonB : polygonA;
+            const Shape2D&          incident  = flip ? polygonA : polygonB;
+            const RigidTransform2D& referenceTransform = flip ? transformB : transformA;
+            const RigidTransform2D& incidentTransform  = flip ? transformA : transformB;
+            const std::uint32_t     edge               = flip ? edgeB : edgeA;
+
+            // The incident edge is the one facing the reference face the most
+            const Point referenceNormal = Rotate(Relative(incidentTransform, referenceTransform),
+                reference.NormalX[edge], reference.NormalY[edge]);
+            std::uint32_t incidentEdge    = 0;
+            float         smallestDot     = std::numeric_limits<float>::max();
+            for (std::uint32_t i = 0; i < incident.VertexCount; i++) {
+                const float dot = referenceNormal.X * incident.NormalX[i]
+                    + referenceNormal.Y * incident.NormalY[i];
+                if (dot < smallestDot) {
+                    smallestDot  = dot;
+                    incidentEdge = i;
+                }
+            }
+
+            const std::uint32_t incidentNext = (incidentEdge + 1) % incident.VertexCount;
+            const std::array<ClipVertex, 2> incidentVertices {
+                ClipVertex {ToWorld(incidentTransform, incident.VertexX[incidentEdge],
+                                incident.VertexY[incidentEdge]),
+                    incidentEdge},
+                ClipVertex {ToWorld(incidentTransform, incident.VertexX[incidentNext],
+                                incident.VertexY[incidentNext]),
+                    incidentNext},
+            };
+
+            const std::uint32_t referenceNext = (edge + 1) % reference.VertexCount;
+            const Point         vertex1 =
+                ToWorld(referenceTransform, reference.VertexX[edge], reference.VertexY[edge]);
+            const Point vertex2 = ToWorld(referenceTransform, reference.VertexX[referenceNext],
+                reference.VertexY[referenceNext]);
+            const Point normal =
+                Rotate(referenceTransform, reference.NormalX[edge], reference.NormalY[edge]);
+            // Counter clockwise, so the edge runs along the normal rotated by 90 degrees
+            const Point tangent {-normal.Y, normal.X};
+
+            std::array<ClipVertex, 2> clipped1 {};
+            std::array<ClipVertex, 2> clipped2 {};
+            if (ClipSegment(incidentVertices, clipped1, Point {-tangent.X, -tangent.Y},
+                    -(tangent.X * vertex1.X + tangent.Y * vertex1.Y), SIDE_CLIP_ID)
+                < 2) {
+                return false;
+            }
+            if (ClipSegment(clipped1, clipped2, tangent,
+                    tangent.X * vertex2.X + tangent.Y * vertex2.Y, SIDE_CLIP_ID + 1)
+                < 2) {
+                return false;
+            }
+
+            const float frontOffset = normal.X * vertex1.X + normal.Y * vertex1.Y;
+            for (const ClipVertex& vertex : clipped2) {
+                const float separation =
+                    normal.X * vertex.Position.X + normal.Y * vertex.Position.Y - frontOffset;
+                if (separation > margin) {
+                    continue;
+                }
+
+                ContactPoint2D& point = manifold.Points[manifold.PointCount++];
+                point.X               = vertex.Position.X - 0.5F * separation * normal.X;
+                point.Y               = vertex.Position.Y - 0.5F * separation * normal.Y;
+                point.Separation      = separation;
+                point.Id = edge | (vertex.Id << 4) | (static_cast<std::uint32_t>(flip) << 8);
+            }
+
+            manifold.NormalX = flip ? -normal.X : normal.X;
+            manifold.NormalY = flip ? -normal.Y : normal.Y;
+            return manifold.PointCount > 0;
+        }
+    } // namespace
+
+    Shape2D Shape2D::Circle(float radius) {
+        Shape2D shape;
+        shape.Type   = ShapeType2D::Circle;
+        shape.Radius = radius;
+        return shape;
+    }
+
+    Shape2D Shape2D::Box(float halfWidth, float halfHeight) {
+        const std::array<Point, 4> vertices {
+            Point {-halfWidth, -halfHeight},
+            Point {halfWidth, -halfHeight},
+            Point {halfWidth, halfHeight},
+            Point {-halfWidth, halfHeight},
+        };
+
+        Shape2D shape;
+        SetPolygon(shape, vertices);
+        return shape;
+    }
+
+    std::optional<Shape2D> Shape2D::ConvexHull(std::span<const Vec2f> points) {
+        std::vector<Point> sorted;
+        sorted.reserve(points.size());
+        for (const Vec2f& point : points) {
+            sorted.push_back(Point {point[0], point[1]});
+        }
+        std::sort(sorted.begin(), sorted.end(), [](Point lhs, Point rhs) {
+            return lhs.X < rhs.X || (lhs.X == rhs.X && lhs.Y < rhs.Y);
+        });
+        sorted.erase(std::unique(sorted.begin(), sorted.end(),
+                         [](Point lhs, Point rhs) {
+                             const float relX = rhs.X - lhs.X;
+                             const float relY = rhs.Y - lhs.Y;
+                             return relX * relX + relY * relY < WELD_DISTANCE * WELD_DISTANCE;
+                         }),
+            sorted.end());
+        if (sorted.size() < 3) {
+            return std::nullopt;
+        }
+
+        // Monotone chain, the lower hull from left to right and then the upper hull back
+        std::vector<Point> hull(sorted.size() * 2);
+        std::size_t        count = 0;
+        for (std::size_t i = 0; i < sorted.size(); i++) {
+            while (count >= 2 && Cross(hull[count - 2], hull[count - 1], sorted[i]) <= EPSILON) {
+                count--;
+            }
+            hull[count++] = sorted[i];
+        }
+        const std::size_t lowerCount = count + 1;
+        for (std::size_t i = sorted.size() - 1; i > 0; i--) {
+            while (count >= lowerCount
+                && Cross(hull[count - 2], hull[count - 1], sorted[i - 1]) <= EPSILON) {
+                count--;
+            }
+            hull[count++] = sorted[i - 1];
+        }
+        // The first point is repeated at the end
+        count--;
+        if (count < 3 || count > MAX_POLYGON_VERTICES) {
+            return std::nullopt;
+        }
+        hull.resize(count);
+
+        float area      = 0.0F;
+        float centroidX = 0.0F;
+        float centroidY = 0.0F;
+        for (std::size_t i = 0; i < count; i++) {
+            const Point current = hull[i];
+            const Point next    = hull[(i + 1) % count];
+            const float cross   = current.X * next.Y - current.Y * next.X;
+            area += 0.5F * cross;
+            centroidX += (current.X + next.X) * cross;
+            centroidY += (current.Y + next.Y) * cross;
+        }
+        if (area <= EPSILON) {
+            return std::nullopt;
+        }
+
+        centroidX /= 6.0F * area;
+        centroidY /= 6.0F * area;
+        for (Point& point : hull) {
+            point.X -= centroidX;
+            point.Y -= centroidY;
+        }
+
+        Shape2D shape;
+        SetPolygon(shape, hull);
+        return shape;
+    }
+
+    Rect2Df Shape2D::GetBounds(const RigidTransform2D& transform) const noexcept {
+        if (Type == ShapeType2D::Circle) {
+            return Rect2Df(
+                transform.X - Radius, transform.Y - Radius, 2.0F * Radius, 2.0F * Radius);
+        }
+
+        Point minimum = ToWorld(transform, VertexX[0], VertexY[0]);
+        Point maximum = minimum;
+        for (std::uint32_t i = 1; i < VertexCount; i++) {
+            const Point vertex = ToWorld(transform, VertexX[i], VertexY[i]);
+            minimum.X          = std::min(minimum.X, vertex.X);
+            minimum.Y          = std::min(minimum.Y, vertex.Y);
+            maximum.X          = std::max(maximum.X, vertex.X);
+            maximum.Y          = std::max(maximum.Y, vertex.Y);
+        }
+        return Rect2Df(minimum.X, minimum.Y, maximum.X - minimum.X, maximum.Y - minimum.Y);
+    }
+
+    float Shape2D::GetArea() const noexcept {
+        if (Type == ShapeType2D::Circle) {
+            return std::numbers::pi_v<float> * Radius * Radius;
+        }
+
+        float area = 0.0F;
+        for (std::uint32_t i = 0; i < VertexCount; i++) {
+            const std::uint32_t next = (i + 1) % VertexCount;
+            area += 0.5F * (VertexX[i] * VertexY[next] - VertexY[i] * VertexX[next]);
+        }
+        return area;
+    }
+
+    float Shape2D::GetUnitInertia() const noexcept {
+        if (Type == ShapeType2D::Circle) {
+            return 0.5F * GetArea() * Radius * Radius;
+        }
+
+        // Sum of the triangles between the origin and every edge
+        float inertia = 0.0F;
+        for (std::uint32_t i = 0; i < VertexCount; i++) {
+            const std::uint32_t next  = (i + 1) % VertexCount;
+            const float         cross = VertexX[i] * VertexY[next] - VertexY[i] * VertexX[next];
+            inertia += cross / 12.0F
+                * (VertexX[i] * VertexX[i] + VertexY[i] * VertexY[i]
+                    + VertexX[i] * VertexX[next] + VertexY[i] * VertexY[next]
+                    + VertexX[next] * VertexX[next] + VertexY[next] * VertexY[next]);
+        }
+        return inertia;
+    }
+
+    bool Collide(const Shape2D& shapeA, const RigidTransform2D& transformA, const Shape2D& shapeB,
+        const RigidTransform2D& transformB, float margin, Manifold2D& manifold) {
+        if (shapeA.Type == ShapeType2D::Circle && shapeB.Type == ShapeType2D::Circle) {
+            return CollideCircles(transformA.X, transformA.Y, shapeA.Radius, transformB.X,
+                transformB.Y, shapeB.Radius, margin, manifold);
+        }
+        if (shapeA.Type == ShapeType2D::Polygon && shapeB.Type == ShapeType2D::Polygon) {
+            return CollidePolygons(shapeA, transformA, shapeB, transformB, margin, manifold);
+        }
+        if (shapeA.Type == ShapeType2D::Polygon) {
+            return CollidePolygonCircle(shapeA, transformA, shapeB, transformB, margin, manifold);
+        }
+
+        const bool touching =
+            CollidePolygonCircle(shapeB, transformB, shapeA, transformA, margin, manifold);
+        manifold.NormalX = -manifold.NormalX;
+        manifold.NormalY = -manifold.NormalY;
+        return touching;
+    }
+
+    void CollideCircles(const CirclePairs2D& pairs, float margin, std::span<Manifold2D> manifolds) {
+        ASTRELIS_CORE_ASSERT(
+            manifolds.size() >= pairs.GetCount(), "Not enough manifolds for the pairs");
+
+        std::size_t pair = 0;
+#if ASTRELIS_COLLISION_SSE
+        const __m128 half     = _mm_set1_ps(0.5F);
+        const __m128 one      = _mm_set1_ps(1.0F);
+        const __m128 marginX4 = _mm_set1_ps(margin);
+        const __m128 epsilon  = _mm_set1_ps(EPSILON);
+        for (; pair + 4 <= pairs.GetCount(); pair += 4) {
+            const __m128 posAX   = _mm_loadu_ps(&pairs.AX[pair]);
+            const __m128 posAY   = _mm_loadu_ps(&pairs.AY[pair]);
+            const __m128 radiusA = _mm_loadu_ps(&pairs.RadiusA[pair]);
+            const __m128 radiusB = _mm_loadu_ps(&pairs.RadiusB[pair]);
+            const __m128 relX    = _mm_sub_ps(_mm_loadu_ps(&pairs.BX[pair]), posAX);
+            const __m128 relY    = _mm_sub_ps(_mm_loadu_ps(&pairs.BY[pair]), posAY);
+
+            const __m128 distanceSquared =
+                _mm_add_ps(_mm_mul_ps(relX, relX), _mm_mul_ps(relY, relY));
+            const __m128 reach    = _mm_add_ps(_mm_add_ps(radiusA, radiusB), marginX4);
+            const int    touching =
+                _mm_movemask_ps(_mm_cmple_ps(distanceSquared, _mm_mul_ps(reach, reach)));
+            if (touching == 0) {
+                for (std::size_t lane = 0; lane < 4; lane++) {
+                    manifolds[pair + lane].PointCount = 0;
+                }
+                continue;
+            }
+
+            // Coincident centres get an upwards normal, the divisions by zero are masked out
+            const __m128 distance = _mm_sqrt_ps(distanceSquared);
+            const __m128 valid    = _mm_cmpgt_ps(distance, epsilon);
+            const __m128 normalX  = _mm_and_ps(valid, _mm_div_ps(relX, distance));
+            const __m128 normalY  = _mm_or_ps(
+                _mm_and_ps(valid, _mm_div_ps(relY, distance)), _mm_andnot_ps(valid, one));
+            const __m128 separation = _mm_sub_ps(_mm_sub_ps(distance, radiusA), radiusB);
+            const __m128 offset     = _mm_add_ps(radiusA, _mm_mul_ps(half, separation));
+
+            alignas(16) std::array<float, 4> outNormalX;
+            alignas(16) std::array<float, 4> outNormalY;
+            alignas(16) std::array<float, 4> outPointX;
+            alignas(16) std::array<float, 4> outPointY;
+            alignas(16) std::array<float, 4> outSeparation;
+            _mm_store_ps(outNormalX.data(), normalX);
+            _mm_store_ps(outNormalY.data(), normalY);
+            _mm_store_ps(outPointX.data(), _mm_add_ps(posAX, _mm_mul_ps(normalX, offset)));
+            _mm_store_ps(outPointY.data(), _mm_add_ps(posAY, _mm_mul_ps(normalY, offset)));
+            _mm_store_ps(outSeparation.data(), separation);
+
+            for (std::size_t lane = 0; lane < 4; lane++) {
+                Manifold2D& manifold = manifolds[pair + lane];
+                if ((touching & (1 << lane)) == 0) {
+                    manifold.PointCount = 0;
+                    continue;
+                }
+                manifold.NormalX   = outNormalX[lane];
+                manifold.NormalY   = outNormalY[lane];
+                manifold.Points[0] = ContactPoint2D {
+                    outPointX[lane], outPointY[lane], outSeparation[lane], 0};
+                manifold.PointCount = 1;
+            }
+        }
+#endif
+
+        for (; pair < pairs.GetCount(); pair++) {
+            CollideCircles(pairs.AX[pair], pairs.AY[pair], pairs.RadiusA[pair], pairs.BX[pair],
+                pairs.BY[pair], pairs.RadiusB[pair], margin, manifolds[pair]);
+        }
+    }
+} // namespace Astrelis
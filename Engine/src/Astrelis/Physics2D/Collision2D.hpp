@@ -0,0 +1,130 @@
+#pragma once
+
+#include "Astrelis/Core/Geometry.hpp"
+#include "Astrelis/Core/Math.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace Astrelis {
+    enum class ShapeType2D : std::uint8_t {
+        Circle,
+        Polygon,
+    };
+
+    /// @brief A position and a rotation, the rotation is kept as its cosine and sine
+    struct RigidTransform2D {
+        float X   = 0.0F;
+        float Y   = 0.0F;
+        float Cos = 1.0F;
+        float Sin = 0.0F;
+
+        static RigidTransform2D FromAngle(float posX, float posY, float angle) noexcept {
+            return RigidTransform2D {posX, posY, std::cos(angle), std::sin(angle)};
+        }
+    };
+
+    /**
+    * @brief A circle or a convex polygon, in body space
+    * Polygons are stored as structure of arrays, padded to a multiple of four with copies of the first vertex and
+    * normal, so the narrow phase can test four edges at once. Their vertices are counter clockwise.
+    */
+    struct Shape2D {
+        static constexpr std::uint32_t MAX_POLYGON_VERTICES = 8;
+
+        using PolygonArray = std::array<float, MAX_POLYGON_VERTICES>;
+
+        ShapeType2D Type = ShapeType2D::Circle;
+        /// @brief The radius of a circle, or of the bounding circle of a polygon
+        float                      Radius      = 0.0F;
+        std::uint32_t              VertexCount = 0;
+        alignas(16) PolygonArray   VertexX {};
+        alignas(16) PolygonArray   VertexY {};
+        /// @brief The outward normal of the edge from vertex i to vertex i + 1
+        alignas(16) PolygonArray   NormalX {};
+        alignas(16) PolygonArray   NormalY {};
+
+        static Shape2D Circle(float radius);
+        static Shape2D Box(float halfWidth, float halfHeight);
+        /**
+        * @brief Builds the convex hull of the points, moved so that its centroid is at the origin
+        * @return nullopt if the points do not enclose an area, or the hull has more than MAX_POLYGON_VERTICES
+        */
+        static std::optional<Shape2D> ConvexHull(std::span<const Vec2f> points);
+
+        /// @brief The bounds of the shape placed by the transform
+        [[nodiscard]] Rect2Df GetBounds(const RigidTransform2D& transform) const noexcept;
+        [[nodiscard]] float   GetArea() const noexcept;
+        /// @brief The rotational inertia around the origin for a density of one
+        [[nodiscard]] float   GetUnitInertia() const noexcept;
+    };
+
+    struct ContactPoint2D {
+        /// @brief The point halfway between both surfaces, in world space
+        float X = 0.0F;
+        float Y = 0.0F;
+        /// @brief The distance between the surfaces along the normal, negative when they overlap
+        float Separation = 0.0F;
+        /// @brief Identifies the features that touch, so impulses can be carried over between steps
+        std::uint32_t Id = 0;
+    };
+
+    /// @brief The contact between two shapes, the normal points from the first to the second shape
+    struct Manifold2D {
+        float                         NormalX = 0.0F;
+        float                         NormalY = 0.0F;
+        std::array<ContactPoint2D, 2> Points {};
+        std::uint32_t                 PointCount = 0;
+    };
+
+    /// @brief Circle pairs as structure of arrays, @see CollideCircles
+    struct CirclePairs2D {
+        std::vector<float> AX;
+        std::vector<float> AY;
+        std::vector<float> RadiusA;
+        std::vector<float> BX;
+        std::vector<float> BY;
+        std::vector<float> RadiusB;
+
+        void Add(float posAX, float posAY, float radiusA, float posBX, float posBY, float radiusB) {
+            AX.push_back(posAX);
+            AY.push_back(posAY);
+            RadiusA.push_back(radiusA);
+            BX.push_back(posBX);
+            BY.push_back(posBY);
+            RadiusB.push_back(radiusB);
+        }
+
+        void Clear() noexcept {
+            AX.clear();
+            AY.clear();
+            RadiusA.clear();
+            BX.clear();
+            BY.clear();
+            RadiusB.clear();
+        }
+
+        [[nodiscard]] std::size_t GetCount() const noexcept {
+            return AX.size();
+        }
+    };
+
+    /**
+    * @brief Computes the contact manifold between two shapes
+    * @param margin Points are kept while the surfaces are closer than this, so contacts exist just before touching
+    * @return false if the shapes are further apart than the margin
+    */
+    bool Collide(const Shape2D& shapeA, const RigidTransform2D& transformA, const Shape2D& shapeB,
+        const RigidTransform2D& transformB, float margin, Manifold2D& manifold);
+
+    /**
+    * @brief Collides many circle pairs at once, four at a time with SSE
+    * Pairs that are further apart than the margin get a manifold without points.
+    */
+    void CollideCircles(const CirclePairs2D& pairs, float margin, std::span<Manifold2D> manifolds);
+} // namespace Astrelis
@@ -0,0 +1,807 @@
+#include "PhysicsWorld2D.hpp"
+
+#include "Astrelis/Core/Base.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Astrelis {
+    namespace {
+        // Contacts are created this far before the shapes touch, so fast bodies are stopped at the surface
+        constexpr float SPECULATIVE_DISTANCE = 0.02F;
+        // The overlap that is allowed to remain, correcting all of it makes resting contacts jitter
+        constexpr float LINEAR_SLOP = 0.005F;
+        // The fraction of the overlap that is corrected per step
+        constexpr float BAUMGARTE = 0.2F;
+        constexpr float MAX_CORRECTION_VELOCITY = 3.0F;
+        // Slower impacts do not bounce, so resting bodies settle
+        constexpr float RESTITUTION_THRESHOLD = 1.0F;
+        // Two point contacts above this are solved one point at a time
+        constexpr float MAX_CONDITION_NUMBER = 1000.0F;
+        // The furthest a body can move in one step, keeps the solver stable at extreme velocities
+        constexpr float MAX_TRANSLATION = 4.0F;
+
+        constexpr std::uint64_t MakeKey(BodyId2D lhs, BodyId2D rhs) {
+            return (static_cast<std::uint64_t>(std::min(lhs, rhs)) << 32) | std::max(lhs, rhs);
+        }
+
+        /// Calls function(begin, end) through the job system when there is one
+        template<typename Fn> void ForEach(JobSystem* jobSystem, std::size_t count, Fn&& function) {
+            if (jobSystem != nullptr) {
+                jobSystem->ParallelFor(count, 0, function);
+            }
+            else {
+                function(std::size_t {0}, count);
+            }
+        }
+    } // namespace
+
+    PhysicsWorld2D::PhysicsWorld2D(const PhysicsWorldProps2D& props) : m_Props(props) {
+    }
+
+    BodyId2D PhysicsWorld2D::CreateBody(const BodyProps2D& props, const Shape2D& shape) {
+        BodyId2D body = 0;
+        if (!m_FreeBodies.empty()) {
+            body = m_FreeBodies.back();
+            m_FreeBodies.pop_back();
+        }
+        else {
+            body                   = static_cast<BodyId2D>(m_PositionX.size());
+            const std::size_t size = body + 1;
+            m_PositionX.resize(size);
+            m_PositionY.resize(size);
+            m_Angle.resize(size);
+            m_Cos.resize(size);
+            m_Sin.resize(size);
+            m_VelocityX.resize(size);
+            m_VelocityY.resize(size);
+            m_AngularVelocity.resize(size);
+            m_ForceX.resize(size);
+            m_ForceY.resize(size);
+            m_Torque.resize(size);
+            m_InverseMass.resize(size);
+            m_InverseInertia.resize(size);
+            m_Friction.resize(size);
+            m_Restitution.resize(size);
+            m_SleepTime.resize(size);
+            m_Type.resize(size);
+            m_Awake.resize(size);
+            m_AllowSleep.resize(size);
+            m_Alive.resize(size);
+            m_Proxies.resize(size);
+            m_Bounds.resize(size);
+            m_Shapes.resize(size);
+        }
+
+        const bool dynamic      = props.Type == BodyType2D::Dynamic;
+        m_PositionX[body]       = props.Position[0];
+        m_PositionY[body]       = props.Position[1];
+        m_Angle[body]           = props.Angle;
+        m_Cos[body]             = std::cos(props.Angle);
+        m_Sin[body]             = std::sin(props.Angle);
+        m_VelocityX[body]       = dynamic ? props.Velocity[0] : 0.0F;
+        m_VelocityY[body]       = dynamic ? props.Velocity[1] : 0.0F;
+        m_AngularVelocity[body] = dynamic ? props.AngularVelocity : 0.0F;
+        m_ForceX[body]          = 0.0F;
+        m_ForceY[body]          = 0.0F;
+        m_Torque[body]          = 0.0F;
+        m_Friction[body]        = props.Friction;
+        m_Restitution[body]     = props.Restitution;
+        m_SleepTime[body]       = 0.0F;
+        m_Type[body]            = props.Type;
+        m_Awake[body]           = dynamic ? 1 : 0;
+        m_AllowSleep[body]      = props.AllowSleep ? 1 : 0;
+        m_Alive[body]           = 1;
+        m_Shapes[body]          = shape;
+
+        const float mass       = dynamic ? props.Density * shape.GetArea() : 0.0F;
+        const float inertia    = dynamic ? props.Density * shape.GetUnitInertia() : 0.0F;
+        m_InverseMass[body]    = mass > 0.0F ? 1.0F / mass : 0.0F;
+        m_InverseInertia[body] = inertia > 0.0F ? 1.0F / inertia : 0.0F;
+
+        m_Bounds[body]  = shape.GetBounds(GetTransform(body));
+        m_Proxies[body] = m_Tree.CreateProxy(m_Bounds[body], body);
+        m_BodyCount++;
+        return body;
+    }
+
+    void PhysicsWorld2D::DestroyBody(BodyId2D body) {
+        ASTRELIS_CORE_ASSERT(body < m_Alive.size() && m_Alive[body] != 0, "Unknown body");
+        WakeContacts(body);
+        std::erase_if(m_Contacts, [body](const Contact& contact) {
+            return contact.BodyA == body || contact.BodyB == body;
+        });
+
+        m_Tree.DestroyProxy(m_Proxies[body]);
+        m_Alive[body] = 0;
+        m_Awake[body] = 0;
+        m_FreeBodies.push_back(body);
+        m_BodyCount--;
+    }
+
+    void PhysicsWorld2D::Clear() {
+        m_Tree.Clear();
+        m_PositionX.clear();
+        m_PositionY.clear();
+        m_Angle.clear();
+        m_Cos.clear();
+        m_Sin.clear();
+        m_VelocityX.clear();
+        m_VelocityY.clear();
+        m_AngularVelocity.clear();
+        m_ForceX.clear();
+        m_ForceY.clear();
+        m_Torque.clear();
+        m_InverseMass.clear();
+        m_InverseInertia.clear();
+        m_Friction.clear();
+        m_Restitution.clear();
+        m_SleepTime.clear();
+        m_Type.clear();
+        m_Awake.clear();
+        m_AllowSleep.clear();
+        m_Alive.clear();
+        m_Proxies.clear();
+        m_Bounds.clear();
+        m_Shapes.clear();
+        m_FreeBodies.clear();
+        m_BodyCount = 0;
+
+        m_Contacts.clear();
+        m_PreviousContacts.clear();
+        m_IslandBodyOffsets.clear();
+    }
+
+    void PhysicsWorld2D::Step(float deltaTime) {
+        StepInternal(deltaTime, nullptr);
+    }
+
+    void PhysicsWorld2D::Step(float deltaTime, JobSystem& jobSystem) {
+        StepInternal(deltaTime, &jobSystem);
+    }
+
+    std::span<const BodyId2D> PhysicsWorld2D::QueryRect(
+        const Rect2Df& rect, std::vector<BodyId2D>& results) const {
+        m_Tree.QueryRect(rect, results);
+        for (BodyId2D& result : results) {
+            result = m_Tree.GetUserData(result);
+        }
+        return results;
+    }
+
+    void PhysicsWorld2D::SetTransform(BodyId2D body, Vec2f position, float angle) {
+        ASTRELIS_CORE_ASSERT(body < m_Alive.size() && m_Alive[body] != 0, "Unknown body");
+        // Bodies resting on a moved static body would keep floating on their stale contacts
+        WakeContacts(body);
+        m_PositionX[body] = position[0];
+        m_PositionY[body] = position[1];
+        m_Angle[body]     = angle;
+        m_Cos[body]       = std::cos(angle);
+        m_Sin[body]       = std::sin(angle);
+        m_Bounds[body]    = m_Shapes[body].GetBounds(GetTransform(body));
+        m_Tree.MoveProxy(m_Proxies[body], m_Bounds[body]);
+        WakeUp(body);
+        for (std::uint32_t proxy : m_Tree.QueryRect(m_Bounds[body], m_QueryResults)) {
+            WakeUp(m_Tree.GetUserData(proxy));
+        }
+    }
+
+    void PhysicsWorld2D::SetVelocity(BodyId2D body, Vec2f velocity) {
+        ASTRELIS_CORE_ASSERT(body < m_Alive.size() && m_Alive[body] != 0, "Unknown body");
+        ASTRELIS_CORE_ASSERT(m_Type[body] == BodyType2D::Dynamic, "Static bodies cannot move");
+        m_VelocityX[body] = velocity[0];
+        m_VelocityY[body] = velocity[1];
+        WakeUp(body);
+    }
+
+    void PhysicsWorld2D::SetAngularVelocity(BodyId2D body, float angularVelocity) {
+        ASTRELIS_CORE_ASSERT(body < m_Alive.size() && m_Alive[body] != 0, "Unknown body");
+        ASTRELIS_CORE_ASSERT(m_Type[body] == BodyType2D::Dynamic, "Static bodies cannot move");
+        m_AngularVelocity[body] = angularVelocity;
+        WakeUp(body);
+    }
+
+    void PhysicsWorld2D::ApplyForce(BodyId2D body, Vec2f force) {
+        ASTRELIS_CORE_ASSERT(body < m_Alive.size() && m_Alive[body] != 0, "Unknown body");
+        ASTRELIS_CORE_ASSERT(m_Type[body] == BodyType2D::Dynamic, "Static bodies cannot move");
+        m_ForceX[body] += force[0];
+        m_ForceY[body] += force[1];
+        WakeUp(body);
+    }
+
+    void PhysicsWorld2D::ApplyTorque(BodyId2D body, float torque) {
+        ASTRELIS_CORE_ASSERT(body < m_Alive.size() && m_Alive[body] != 0, "Unknown body");
+        ASTRELIS_CORE_ASSERT(m_Type[body] == BodyType2D::Dynamic, "Static bodies cannot move");
+        m_Torque[body] += torque;
+        WakeUp(body);
+    }
+
+    void PhysicsWorld2D::ApplyLinearImpulse(BodyId2D body, Vec2f impulse) {
+        ASTRELIS_CORE_ASSERT(body < m_Alive.size() && m_Alive[body] != 0, "Unknown body");
+        ASTRELIS_CORE_ASSERT(m_Type[body] == BodyType2D::Dynamic, "Static bodies cannot move");
+        m_VelocityX[body] += m_InverseMass[body] * impulse[0];
+        m_VelocityY[body] += m_InverseMass[body] * impulse[1];
+        WakeUp(body);
+    }
+
+    void PhysicsWorld2D::WakeUp(BodyId2D body) {
+        if (m_Type[body] == BodyType2D::Dynamic) {
+            m_Awake[body]     = 1;
+            m_SleepTime[body] = 0.0F;
+        }
+    }
+
+    void PhysicsWorld2D::WakeContacts(BodyId2D body) {
+        for (const Contact& contact : m_Contacts) {
+            if (contact.BodyA == body) {
+                WakeUp(contact.BodyB);
+            }
+            else if (contact.BodyB == body) {
+                WakeUp(contact.BodyA);
+            }
+        }
+    }
+
+    void PhysicsWorld2D::StepInternal(float deltaTime, JobSystem* jobSystem) {
+        ASTRELIS_PROFILE_FUNCTION();
+        if (deltaTime <= 0.0F) {
+            return;
+        }
+
+        m_AwakeBodies.clear();
+        for (BodyId2D body = 0; body < m_Alive.size(); body++) {
+            if (m_Alive[body] != 0 && m_Awake[body] != 0) {
+                m_AwakeBodies.push_back(body);
+            }
+        }
+
+        FindPairs();
+        UpdateContacts(jobSystem);
+        BuildIslands();
+        ForEach(jobSystem, GetIslandCount(), [this, deltaTime](std::size_t begin, std::size_t end) {
+            for (std::size_t island = begin; island < end; island++) {
+                SolveIsland(island, deltaTime);
+            }
+        });
+        Synchronize(deltaTime);
+    }
+
+    void PhysicsWorld2D::FindPairs() {
+        ASTRELIS_PROFILE_FUNCTION();
+        m_Pairs.clear();
+        for (BodyId2D body : m_AwakeBodies) {
+            const Rect2Df& bounds = m_Bounds[body];
+            const Rect2Df  query(bounds.X() - SPECULATIVE_DISTANCE,
+                bounds.Y() - SPECULATIVE_DISTANCE, bounds.Width() + 2.0F * SPECULATIVE_DISTANCE,
+                bounds.Height() + 2.0F * SPECULATIVE_DISTANCE);
+            for (std::uint32_t proxy : m_Tree.QueryRect(query, m_QueryResults)) {
+                const BodyId2D other = m_Tree.GetUserData(proxy);
+                // Pairs of awake bodies are found from both sides, only the lower id keeps them
+                if (other == body || (m_Awake[other] != 0 && other < body)) {
+                    continue;
+                }
+                m_Pairs.push_back(MakeKey(body, other));
+            }
+        }
+        std::sort(m_Pairs.begin(), m_Pairs.end());
+    }
+
+    void PhysicsWorld2D::UpdateContacts(JobSystem* jobSystem) {
+        ASTRELIS_PROFILE_FUNCTION();
+        std::swap(m_Contacts, m_PreviousContacts);
+        m_Contacts.resize(m_Pairs.size());
+        m_CirclePairs.Clear();
+        m_CircleContacts.clear();
+        for (std::size_t i = 0; i < m_Pairs.size(); i++) {
+            Contact& contact            = m_Contacts[i];
+            contact.Key                 = m_Pairs[i];
+            contact.BodyA               = static_cast<BodyId2D>(m_Pairs[i] >> 32);
+            contact.BodyB               = static_cast<BodyId2D>(m_Pairs[i]);
+            contact.Manifold.PointCount = 0;
+
+            const BodyId2D bodyA = contact.BodyA;
+            const BodyId2D bodyB = contact.BodyB;
+            if (m_Shapes[bodyA].Type == ShapeType2D::Circle
+                && m_Shapes[bodyB].Type == ShapeType2D::Circle) {
+                m_CirclePairs.Add(m_PositionX[bodyA], m_PositionY[bodyA], m_Shapes[bodyA].Radius,
+                    m_PositionX[bodyB], m_PositionY[bodyB], m_Shapes[bodyB].Radius);
+                m_CircleContacts.push_back(static_cast<std::uint32_t>(i));
+            }
+        }
+
+        // Circle pairs are batched, everything else goes through the generic path
+        ForEach(jobSystem, m_Contacts.size(), [this](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                Contact&       contact = m_Contacts[i];
+                const Shape2D& shapeA  = m_Shapes[contact.BodyA];
+                const Shape2D& shapeB  = m_Shapes[contact.BodyB];
+                if (shapeA.Type != ShapeType2D::Circle || shapeB.Type != ShapeType2D::Circle) {
+                    Astrelis::Collide(shapeA, GetTransform(contact.BodyA), shapeB,
+                        GetTransform(contact.BodyB), SPECULATIVE_DISTANCE, contact.Manifold);
+                }
+            }
+        });
+        m_CircleManifolds.resize(m_CirclePairs.GetCount());
+        CollideCircles(m_CirclePairs, SPECULATIVE_DISTANCE, m_CircleManifolds);
+        for (std::size_t i = 0; i < m_CircleContacts.size(); i++) {
+            m_Contacts[m_CircleContacts[i]].Manifold = m_CircleManifolds[i];
+        }
+
+        std::erase_if(
+            m_Contacts, [](const Contact& contact) { return contact.Manifold.PointCount == 0; });
+
+        // Both lists are sorted by key, so the impulses of the last step can be matched in one pass
+        std::size_t previous = 0;
+        for (Contact& contact : m_Contacts) {
+            const BodyId2D bodyA = contact.BodyA;
+            const BodyId2D bodyB = contact.BodyB;
+            contact.Friction     = std::sqrt(m_Friction[bodyA] * m_Friction[bodyB]);
+            contact.Restitution  = std::max(m_Restitution[bodyA], m_Restitution[bodyB]);
+            contact.Points       = {};
+
+            while (previous < m_PreviousContacts.size()
+                && m_PreviousContacts[previous].Key < contact.Key) {
+                previous++;
+            }
+            if (previous < m_PreviousContacts.size()
+                && m_PreviousContacts[previous].Key == contact.Key) {
+                const Contact& old = m_PreviousContacts[previous];
+                for (std::uint32_t point = 0; point < contact.Manifold.PointCount; point++) {
+                    for (std::uint32_t from = 0; from < old.Manifold.PointCount; from++) {
+                        if (old.Manifold.Points[from].Id == contact.Manifold.Points[point].Id) {
+                            contact.Points[point].NormalImpulse  = old.Points[from].NormalImpulse;
+                            contact.Points[point].TangentImpulse = old.Points[from].TangentImpulse;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+
+        // Pairs without an awake body were not searched, but sleeping bodies have not moved since their
+        // contacts were last updated, so those are kept as they are
+        const std::size_t updatedCount = m_Contacts.size();
+        for (const Contact& contact : m_PreviousContacts) {
+            if (m_Awake[contact.BodyA] == 0 && m_Awake[contact.BodyB] == 0) {
+                m_Contacts.push_back(contact);
+            }
+        }
+        std::inplace_merge(m_Contacts.begin(),
+            m_Contacts.begin() + static_cast<std::ptrdiff_t>(updatedCount), m_Contacts.end(),
+            [](const Contact& lhs, const Contact& rhs) { return lhs.Key < rhs.Key; });
+
+        // A sleeping body touching an awake one wakes up, along with everything it rests on, so whole
+        // islands wake at once
+        bool woken = true;
+        while (woken) {
+            woken = false;
+            for (const Contact& contact : m_Contacts) {
+                if ((m_Awake[contact.BodyA] != 0) == (m_Awake[contact.BodyB] != 0)) {
+                    continue;
+                }
+                const BodyId2D sleeping =
+                    m_Awake[contact.BodyA] != 0 ? contact.BodyB : contact.BodyA;
+                if (m_Type[sleeping] == BodyType2D::Dynamic) {
+                    WakeUp(sleeping);
+                    m_AwakeBodies.push_back(sleeping);
+                    woken = true;
+                }
+            }
+        }
+    }
+
+    void PhysicsWorld2D::BuildIslands() {
+        ASTRELIS_PROFILE_FUNCTION();
+        m_IslandParent.resize(m_Alive.size());
+        m_IslandOf.resize(m_Alive.size());
+        for (BodyId2D body : m_AwakeBodies) {
+            m_IslandParent[body] = body;
+        }
+
+        const auto find = [this](std::uint32_t body) {
+            while (m_IslandParent[body] != body) {
+                m_IslandParent[body] = m_IslandParent[m_IslandParent[body]];
+                body                 = m_IslandParent[body];
+            }
+            return body;
+        };
+        for (const Contact& contact : m_Contacts) {
+            if (m_Awake[contact.BodyA] != 0 && m_Awake[contact.BodyB] != 0) {
+                const std::uint32_t rootA = find(contact.BodyA);
+                const std::uint32_t rootB = find(contact.BodyB);
+                if (rootA != rootB) {
+                    m_IslandParent[std::max(rootA, rootB)] = std::min(rootA, rootB);
+                }
+            }
+        }
+
+        std::uint32_t islandCount = 0;
+        for (BodyId2D body : m_AwakeBodies) {
+            if (find(body) == body) {
+                m_IslandOf[body] = islandCount++;
+            }
+        }
+        for (BodyId2D body : m_AwakeBodies) {
+            m_IslandOf[body] = m_IslandOf[find(body)];
+        }
+
+        // Counting sort of the bodies and contacts by island, the offsets are used as cursors and then
+        // shifted back to the starts
+        m_IslandBodyOffsets.assign(islandCount + 1, 0);
+        m_IslandContactOffsets.assign(islandCount + 1, 0);
+        // Contacts between sleeping bodies, and between a sleeping body and a static one, are not solved
+        const auto isActive = [this](const Contact& contact) {
+            return m_Awake[contact.BodyA] != 0 || m_Awake[contact.BodyB] != 0;
+        };
+        const auto contactIsland = [this](const Contact& contact) {
+            return m_IslandOf[m_Awake[contact.BodyA] != 0 ? contact.BodyA : contact.BodyB];
+        };
+        for (BodyId2D body : m_AwakeBodies) {
+            m_IslandBodyOffsets[m_IslandOf[body] + 1]++;
+        }
+        std::size_t activeCount = 0;
+        for (const Contact& contact : m_Contacts) {
+            if (isActive(contact)) {
+                m_IslandContactOffsets[contactIsland(contact) + 1]++;
+                activeCount++;
+            }
+        }
+        for (std::uint32_t island = 0; island < islandCount; island++) {
+            m_IslandBodyOffsets[island + 1] += m_IslandBodyOffsets[island];
+            m_IslandContactOffsets[island + 1] += m_IslandContactOffsets[island];
+        }
+
+        m_IslandBodies.resize(m_AwakeBodies.size());
+        m_IslandContacts.resize(activeCount);
+        for (BodyId2D body : m_AwakeBodies) {
+            m_IslandBodies[m_IslandBodyOffsets[m_IslandOf[body]]++] = body;
+        }
+        for (std::size_t contact = 0; contact < m_Contacts.size(); contact++) {
+            if (isActive(m_Contacts[contact])) {
+                m_IslandContacts[m_IslandContactOffsets[contactIsland(m_Contacts[contact])]++] =
+                    static_cast<std::uint32_t>(contact);
+            }
+        }
+        for (std::uint32_t island = islandCount; island > 0; island--) {
+            m_IslandBodyOffsets[island]    = m_IslandBodyOffsets[island - 1];
+            m_IslandContactOffsets[island] = m_IslandContactOffsets[island - 1];
+        }
+        m_IslandBodyOffsets[0]    = 0;
+        m_IslandContactOffsets[0] = 0;
+    }
+
+    void PhysicsWorld2D::SolveIsland(std::size_t island, float deltaTime) {
+        const std::span<const std::uint32_t> bodies(
+            m_IslandBodies.data() + m_IslandBodyOffsets[island],
+            m_IslandBodyOffsets[island + 1] - m_IslandBodyOffsets[island]);
+        const std::span<const std::uint32_t> contacts(
+            m_IslandContacts.data() + m_IslandContactOffsets[island],
+            m_IslandContactOffsets[island + 1] - m_IslandContactOffsets[island]);
+
+        const float gravityX = m_Props.Gravity[0];
+        const float gravityY = m_Props.Gravity[1];
+        for (BodyId2D body : bodies) {
+            m_VelocityX[body] += deltaTime * (gravityX + m_InverseMass[body] * m_ForceX[body]);
+            m_VelocityY[body] += deltaTime * (gravityY + m_InverseMass[body] * m_ForceY[body]);
+            m_AngularVelocity[body] += deltaTime * m_InverseInertia[body] * m_Torque[body];
+            m_ForceX[body] = 0.0F;
+            m_ForceY[body] = 0.0F;
+            m_Torque[body] = 0.0F;
+        }
+
+        for (std::uint32_t contact : contacts) {
+            PrepareContact(m_Contacts[contact], 1.0F / deltaTime);
+        }
+        for (std::uint32_t contact : contacts) {
+            WarmStartContact(m_Contacts[contact]);
+        }
+        for (std::uint32_t iteration = 0; iteration < m_Props.VelocityIterations; iteration++) {
+            for (std::uint32_t contact : contacts) {
+                SolveContact(m_Contacts[contact]);
+            }
+        }
+
+        float minSleepTime = std::numeric_limits<float>::max();
+        for (BodyId2D body : bodies) {
+            float       velocityX     = m_VelocityX[body];
+            float       velocityY     = m_VelocityY[body];
+            const float translationSq =
+                deltaTime * deltaTime * (velocityX * velocityX + velocityY * velocityY);
+            if (translationSq > MAX_TRANSLATION * MAX_TRANSLATION) {
+                const float scale = MAX_TRANSLATION / std::sqrt(translationSq);
+                velocityX *= scale;
+                velocityY *= scale;
+                m_VelocityX[body] = velocityX;
+                m_VelocityY[body] = velocityY;
+            }
+
+            m_PositionX[body] += deltaTime * velocityX;
+            m_PositionY[body] += deltaTime * velocityY;
+            m_Angle[body] += deltaTime * m_AngularVelocity[body];
+            m_Cos[body] = std::cos(m_Angle[body]);
+            m_Sin[body] = std::sin(m_Angle[body]);
+
+            const float angularVelocity = m_AngularVelocity[body];
+            if (m_AllowSleep[body] == 0
+                || velocityX * velocityX + velocityY * velocityY
+                    > m_Props.LinearSleepTolerance * m_Props.LinearSleepTolerance
+                || angularVelocity * angularVelocity
+                    > m_Props.AngularSleepTolerance * m_Props.AngularSleepTolerance) {
+                m_SleepTime[body] = 0.0F;
+                minSleepTime      = 0.0F;
+            }
+            else {
+                m_SleepTime[body] += deltaTime;
+                minSleepTime = std::min(minSleepTime, m_SleepTime[body]);
+            }
+        }
+
+        if (m_Props.EnableSleep && minSleepTime >= m_Props.TimeToSleep) {
+            for (BodyId2D body : bodies) {
+                m_Awake[body]           = 0;
+                m_VelocityX[body]       = 0.0F;
+                m_VelocityY[body]       = 0.0F;
+                m_AngularVelocity[body] = 0.0F;
+            }
+        }
+
+        for (BodyId2D body : bodies) {
+            m_Bounds[body] = m_Shapes[body].GetBounds(GetTransform(body));
+        }
+    }
+
+    void PhysicsWorld2D::Synchronize(float deltaTime) {
+        ASTRELIS_PROFILE_FUNCTION();
+        for (BodyId2D body : m_AwakeBodies) {
+            m_Tree.MoveProxy(m_Proxies[body], m_Bounds[body],
+                Vec2f(m_VelocityX[body] * deltaTime, m_VelocityY[body] * deltaTime));
+        }
+    }
+
+    void PhysicsWorld2D::PrepareContact(Contact& contact, float inverseDeltaTime) const {
+        const BodyId2D bodyA           = contact.BodyA;
+        const BodyId2D bodyB           = contact.BodyB;
+        const float    inverseMassA    = m_InverseMass[bodyA];
+        const float    inverseMassB    = m_InverseMass[bodyB];
+        const float    inverseInertiaA = m_InverseInertia[bodyA];
+        const float    inverseInertiaB = m_InverseInertia[bodyB];
+        const float    normalX         = contact.Manifold.NormalX;
+        const float    normalY         = contact.Manifold.NormalY;
+        const float    tangentX        = normalY;
+        const float    tangentY        = -normalX;
+
+        for (std::uint32_t i = 0; i < contact.Manifold.PointCount; i++) {
+            const ContactPoint2D&   point      = contact.Manifold.Points[i];
+            ContactPointConstraint& constraint = contact.Points[i];
+            constraint.AnchorAX                = point.X - m_PositionX[bodyA];
+            constraint.AnchorAY                = point.Y - m_PositionY[bodyA];
+            constraint.AnchorBX                = point.X - m_PositionX[bodyB];
+            constraint.AnchorBY                = point.Y - m_PositionY[bodyB];
+
+            const float normalA = constraint.AnchorAX * normalY - constraint.AnchorAY * normalX;
+            const float normalB = constraint.AnchorBX * normalY - constraint.AnchorBY * normalX;
+            const float normalK = inverseMassA + inverseMassB + inverseInertiaA * normalA * normalA
+                + inverseInertiaB * normalB * normalB;
+            constraint.NormalMass = normalK > 0.0F ? 1.0F / normalK : 0.0F;
+
+            const float tangentA = constraint.AnchorAX * tangentY - constraint.AnchorAY * tangentX;
+            const float tangentB = constraint.AnchorBX * tangentY - constraint.AnchorBY * tangentX;
+            const float tangentK = inverseMassA + inverseMassB
+                + inverseInertiaA * tangentA * tangentA + inverseInertiaB * tangentB * tangentB;
+            constraint.TangentMass = tangentK > 0.0F ? 1.0F / tangentK : 0.0F;
+
+            // Speculative points let the bodies close the gap, overlapping ones push them apart
+            if (point.Separation > 0.0F) {
+                constraint.TargetVelocity = -point.Separation * inverseDeltaTime;
+            }
+            else {
+                constraint.TargetVelocity = std::min(BAUMGARTE * inverseDeltaTime
+                        * std::max(-point.Separation - LINEAR_SLOP, 0.0F),
+                    MAX_CORRECTION_VELOCITY);
+            }
+
+            const float relativeX = m_VelocityX[bodyB]
+                - m_AngularVelocity[bodyB] * constraint.AnchorBY - m_VelocityX[bodyA]
+                + m_AngularVelocity[bodyA] * constraint.AnchorAY;
+            const float relativeY = m_VelocityY[bodyB]
+                + m_AngularVelocity[bodyB] * constraint.AnchorBX - m_VelocityY[bodyA]
+                - m_AngularVelocity[bodyA] * constraint.AnchorAX;
+            const float normalVelocity = relativeX * normalX + relativeY * normalY;
+            if (contact.Restitution > 0.0F && normalVelocity < -RESTITUTION_THRESHOLD) {
+                constraint.TargetVelocity =
+                    std::max(constraint.TargetVelocity, -contact.Restitution * normalVelocity);
+            }
+        }
+
+        // Solving two points one after the other makes resting boxes rock, so they are solved together
+        // unless the points are so close that the system is badly conditioned
+        contact.UseBlockSolver = false;
+        if (contact.Manifold.PointCount == 2) {
+            const ContactPointConstraint& point1 = contact.Points[0];
+            const ContactPointConstraint& point2 = contact.Points[1];
+            const float normal1A = point1.AnchorAX * normalY - point1.AnchorAY * normalX;
+            const float normal1B = point1.AnchorBX * normalY - point1.AnchorBY * normalX;
+            const float normal2A = point2.AnchorAX * normalY - point2.AnchorAY * normalX;
+            const float normal2B = point2.AnchorBX * normalY - point2.AnchorBY * normalX;
+            const float inverseMass = inverseMassA + inverseMassB;
+
+            const float k11 = inverseMass + inverseInertiaA * normal1A * normal1A
+                + inverseInertiaB * normal1B * normal1B;
+            const float k22 = inverseMass + inverseInertiaA * normal2A * normal2A
+                + inverseInertiaB * normal2B * normal2B;
+            const float k12 = inverseMass + inverseInertiaA * normal1A * normal2A
+                + inverseInertiaB * normal1B * normal2B;
+            const float determinant = k11 * k22 - k12 * k12;
+            if (k11 * k11 < MAX_CONDITION_NUMBER * determinant) {
+                contact.UseBlockSolver          = true;
+                contact.BlockK11                = k11;
+                contact.BlockK12                = k12;
+                contact.BlockK22                = k22;
+                contact.BlockInverseDeterminant = 1.0F / determinant;
+            }
+        }
+    }
+
+    void PhysicsWorld2D::WarmStartContact(const Contact& contact) {
+        const BodyId2D bodyA            = contact.BodyA;
+        const BodyId2D bodyB            = contact.BodyB;
+        const float    inverseMassA     = m_InverseMass[bodyA];
+        const float    inverseMassB     = m_InverseMass[bodyB];
+        const float    inverseInertiaA  = m_InverseInertia[bodyA];
+        const float    inverseInertiaB  = m_InverseInertia[bodyB];
+        float          velocityAX       = m_VelocityX[bodyA];
+        float          velocityAY       = m_VelocityY[bodyA];
+        float          angularVelocityA = m_AngularVelocity[bodyA];
+        float          velocityBX       = m_VelocityX[bodyB];
+        float          velocityBY       = m_VelocityY[bodyB];
+        float          angularVelocityB = m_AngularVelocity[bodyB];
+
+        for (std::uint32_t i = 0; i < contact.Manifold.PointCount; i++) {
+            const ContactPointConstraint& constraint = contact.Points[i];
+            const float impulseX = contact.Manifold.NormalX * constraint.NormalImpulse
+                + contact.Manifold.NormalY * constraint.TangentImpulse;
+            const float impulseY = contact.Manifold.NormalY * constraint.NormalImpulse
+                - contact.Manifold.NormalX * constraint.TangentImpulse;
+
+            velocityAX -= inverseMassA * impulseX;
+            velocityAY -= inverseMassA * impulseY;
+            angularVelocityA -= inverseInertiaA
+                * (constraint.AnchorAX * impulseY - constraint.AnchorAY * impulseX);
+            velocityBX += inverseMassB * impulseX;
+            velocityBY += inverseMassB * impulseY;
+            angularVelocityB += inverseInertiaB
+                * (constraint.AnchorBX * impulseY - constraint.AnchorBY * impulseX);
+        }
+
+        // Static bodies can be shared by islands solved on other threads, so they are never written
+        if (m_Type[bodyA] == BodyType2D::Dynamic) {
+            m_VelocityX[bodyA]       = velocityAX;
+            m_VelocityY[bodyA]       = velocityAY;
+            m_AngularVelocity[bodyA] = angularVelocityA;
+        }
+        if (m_Type[bodyB] == BodyType2D::Dynamic) {
+            m_VelocityX[bodyB]       = velocityBX;
+            m_VelocityY[bodyB]       = velocityBY;
+            m_AngularVelocity[bodyB] = angularVelocityB;
+        }
+    }
+
+    void PhysicsWorld2D::SolveContact(Contact& contact) {
+        const BodyId2D bodyA            = contact.BodyA;
+        const BodyId2D bodyB            = contact.BodyB;
+        const float    inverseMassA     = m_InverseMass[bodyA];
+        const float    inverseMassB     = m_InverseMass[bodyB];
+        const float    inverseInertiaA  = m_InverseInertia[bodyA];
+        const float    inverseInertiaB  = m_InverseInertia[bodyB];
+        const float    normalX          = contact.Manifold.NormalX;
+        const float    normalY          = contact.Manifold.NormalY;
+        const float    tangentX         = normalY;
+        const float    tangentY         = -normalX;
+        float          velocityAX       = m_VelocityX[bodyA];
+        float          velocityAY       = m_VelocityY[bodyA];
+        float          angularVelocityA = m_AngularVelocity[bodyA];
+        float          velocityBX       = m_VelocityX[bodyB];
+        float          velocityBY       = m_VelocityY[bodyB];
+        float          angularVelocityB = m_AngularVelocity[bodyB];
+
+        const auto apply = [&](const ContactPointConstraint& constraint, float impulseX,
+            float impulseY) {
+            velocityAX -= inverseMassA * impulseX;
+            velocityAY -= inverseMassA * impulseY;
+            angularVelocityA -= inverseInertiaA
+                * (constraint.AnchorAX * impulseY - constraint.AnchorAY * impulseX);
+            velocityBX += inverseMassB * impulseX;
+            velocityBY += inverseMassB * impulseY;
+            angularVelocityB += inverseInertiaB
+                * (constraint.AnchorBX * impulseY - constraint.AnchorBY * impulseX);
+        };
+        const auto relativeVelocity = [&](const ContactPointConstraint& constraint, float dirX,
+            float dirY) {
+            const float relativeX = velocityBX - angularVelocityB * constraint.AnchorBY - velocityAX
+                + angularVelocityA * constraint.AnchorAY;
+            const float relativeY = velocityBY + angularVelocityB * constraint.AnchorBX - velocityAY
+                - angularVelocityA * constraint.AnchorAX;
+            return relativeX * dirX + relativeY * dirY;
+        };
+
+        // Friction first, its limit depends on the normal impulse of the previous iteration
+        for (std::uint32_t i = 0; i < contact.Manifold.PointCount; i++) {
+            ContactPointConstraint& constraint = contact.Points[i];
+            const float maxFriction = contact.Friction * constraint.NormalImpulse;
+            const float impulse     = std::clamp(constraint.TangentImpulse
+                    - constraint.TangentMass * relativeVelocity(constraint, tangentX, tangentY),
+                -maxFriction, maxFriction);
+            const float change        = impulse - constraint.TangentImpulse;
+            constraint.TangentImpulse = impulse;
+            apply(constraint, change * tangentX, change * tangentY);
+        }
+
+        if (!contact.UseBlockSolver) {
+            for (std::uint32_t i = 0; i < contact.Manifold.PointCount; i++) {
+                ContactPointConstraint& constraint = contact.Points[i];
+                const float             impulse    = std::max(constraint.NormalImpulse
+                        - constraint.NormalMass
+                            * (relativeVelocity(constraint, normalX, normalY)
+                                - constraint.TargetVelocity),
+                    0.0F);
+                const float change       = impulse - constraint.NormalImpulse;
+                constraint.NormalImpulse = impulse;
+                apply(constraint, change * normalX, change * normalY);
+            }
+        }
+        else {
+            // The linear complementarity problem of both points, vn = K * x + b with x >= 0, vn >= 0 and
+            // x * vn = 0, solved by trying which points are active
+            ContactPointConstraint& point1   = contact.Points[0];
+            ContactPointConstraint& point2   = contact.Points[1];
+            const float             current1 = point1.NormalImpulse;
+            const float             current2 = point2.NormalImpulse;
+            const float             k11      = contact.BlockK11;
+            const float             k12      = contact.BlockK12;
+            const float             k22      = contact.BlockK22;
+            const float             b1       = relativeVelocity(point1, normalX, normalY)
+                - point1.TargetVelocity - (k11 * current1 + k12 * current2);
+            const float b2 = relativeVelocity(point2, normalX, normalY) - point2.TargetVelocity
+                - (k12 * current1 + k22 * current2);
+
+            float impulse1 = -contact.BlockInverseDeterminant * (k22 * b1 - k12 * b2);
+            float impulse2 = -contact.BlockInverseDeterminant * (k11 * b2 - k12 * b1);
+            if (impulse1 < 0.0F || impulse2 < 0.0F) {
+                impulse1 = -point1.NormalMass * b1;
+                impulse2 = 0.0F;
+                if (impulse1 < 0.0F || k12 * impulse1 + b2 < 0.0F) {
+                    impulse1 = 0.0F;
+                    impulse2 = -point2.NormalMass * b2;
+                    if (impulse2 < 0.0F || k12 * impulse2 + b1 < 0.0F) {
+                        impulse2 = 0.0F;
+                        if (b1 < 0.0F || b2 < 0.0F) {
+                            // No solution, keep the impulses, which only happens with bad conditioning
+                            impulse1 = current1;
+                            impulse2 = current2;
+                        }
+                        else {
+                            impulse1 = 0.0F;
+                        }
+                    }
+                }
+            }
+
+            point1.NormalImpulse = impulse1;
+            point2.NormalImpulse = impulse2;
+            apply(point1, (impulse1 - current1) * normalX, (impulse1 - current1) * normalY);
+            apply(point2, (impulse2 - current2) * normalX, (impulse2 - current2) * normalY);
+        }
+
+        if (m_Type[bodyA] == BodyType2D::Dynamic) {
+            m_VelocityX[bodyA]       = velocityAX;
+            m_VelocityY[bodyA]       = velocityAY;
+            m_AngularVelocity[bodyA] = angularVelocityA;
+        }
+        if (m_Type[bodyB] == BodyType2D::Dynamic) {
+            m_VelocityX[bodyB]       = velocityBX;
+            m_VelocityY[bodyB]       = velocityBY;
+            m_AngularVelocity[bodyB] = angularVelocityB;
+        }
+    }
+} // namespace Astrelis
@@ -0,0 +1,234 @@
+#pragma once
+
+#include "Astrelis/Core/Geometry.hpp"
+#include "Astrelis/Core/Jobs/JobSystem.hpp"
+#include "Astrelis/Core/Math.hpp"
+#include "Astrelis/Physics2D/Collision2D.hpp"
+#include "Astrelis/Scene/DynamicAABBTree.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Astrelis {
+    using BodyId2D = std::uint32_t;
+
+    enum class BodyType2D : std::uint8_t {
+        /// @brief Never moves and has infinite mass, used for level geometry
+        Static,
+        Dynamic,
+    };
+
+    struct BodyProps2D {
+        BodyType2D Type            = BodyType2D::Dynamic;
+        Vec2f      Position        = Vec2f(0.0F);
+        /// @brief In radians
+        float      Angle           = 0.0F;
+        Vec2f      Velocity        = Vec2f(0.0F);
+        float      AngularVelocity = 0.0F;
+        float      Density         = 1.0F;
+        float      Friction        = 0.6F;
+        float      Restitution     = 0.0F;
+        /// @brief Bodies that are driven every step, for example by the player, should not be put to sleep
+        bool       AllowSleep      = true;
+    };
+
+    struct PhysicsWorldProps2D {
+        Vec2f         Gravity            = Vec2f(0.0F, -9.81F);
+        std::uint32_t VelocityIterations = 8;
+        bool          EnableSleep        = true;
+        /// @brief How long every body of an island has to be nearly still before the island sleeps, in seconds
+        float TimeToSleep           = 0.5F;
+        float LinearSleepTolerance  = 0.01F;
+        float AngularSleepTolerance = 0.035F;
+    };
+
+    /**
+    * @brief A 2D rigid body simulation
+    * Bodies are stored as structure of arrays and referenced by id. Every step runs a broadphase over a
+    * DynamicAABBTree, the narrow phase for the overlapping pairs, and then splits the awake bodies into islands
+    * of bodies that touch. Each island is solved with sequential impulses, warm started from the previous step,
+    * and goes to sleep once all of its bodies have been still for PhysicsWorldProps2D::TimeToSleep. Sleeping
+    * bodies cost nothing until something touches them or they are changed through the world.
+    *
+    * Islands never share dynamic bodies, so Step can solve them in parallel on the job system, the result is
+    * the same as solving them on one thread.
+    */
+    class PhysicsWorld2D {
+    public:
+        explicit PhysicsWorld2D(const PhysicsWorldProps2D& props = PhysicsWorldProps2D());
+
+        BodyId2D CreateBody(const BodyProps2D& props, const Shape2D& shape);
+        /// @brief Destroys the body and wakes up the bodies that were touching it
+        void     DestroyBody(BodyId2D body);
+        void     Clear();
+
+        /**
+        * @brief Advances the simulation, call it from Layer::OnFixedUpdate with Time::FixedDeltaTime
+        * The solver is tuned for a fixed step, calling it with the frame time makes stacks jitter.
+        */
+        void Step(float deltaTime);
+        /// @brief Step, with the narrow phase and the islands spread over the job system
+        void Step(float deltaTime, JobSystem& jobSystem);
+
+        /// @brief Finds the bodies whose bounds overlap the rectangle, @see DynamicAABBTree::QueryRect
+        std::span<const BodyId2D> QueryRect(
+            const Rect2Df& rect, std::vector<BodyId2D>& results) const;
+
+        /// @brief Teleports the body, waking the bodies it touched before and the bodies it overlaps now
+        void SetTransform(BodyId2D body, Vec2f position, float angle);
+        void SetVelocity(BodyId2D body, Vec2f velocity);
+        void SetAngularVelocity(BodyId2D body, float angularVelocity);
+        /// @brief Applies a force at the centre of mass until the next step
+        void ApplyForce(BodyId2D body, Vec2f force);
+        void ApplyTorque(BodyId2D body, float torque);
+        void ApplyLinearImpulse(BodyId2D body, Vec2f impulse);
+        void WakeUp(BodyId2D body);
+
+        [[nodiscard]] Vec2f GetPosition(BodyId2D body) const {
+            return Vec2f(m_PositionX[body], m_PositionY[body]);
+        }
+
+        [[nodiscard]] float GetAngle(BodyId2D body) const {
+            return m_Angle[body];
+        }
+
+        [[nodiscard]] RigidTransform2D GetTransform(BodyId2D body) const {
+            return RigidTransform2D {
+                m_PositionX[body], m_PositionY[body], m_Cos[body], m_Sin[body]};
+        }
+
+        [[nodiscard]] Vec2f GetVelocity(BodyId2D body) const {
+            return Vec2f(m_VelocityX[body], m_VelocityY[body]);
+        }
+
+        [[nodiscard]] float GetAngularVelocity(BodyId2D body) const {
+            return m_AngularVelocity[body];
+        }
+
+        [[nodiscard]] BodyType2D GetBodyType(BodyId2D body) const {
+            return m_Type[body];
+        }
+
+        [[nodiscard]] const Shape2D& GetShape(BodyId2D body) const {
+            return m_Shapes[body];
+        }
+
+        [[nodiscard]] bool IsAwake(BodyId2D body) const {
+            return m_Awake[body] != 0;
+        }
+
+        [[nodiscard]] std::size_t GetBodyCount() const noexcept {
+            return m_BodyCount;
+        }
+
+        /// @brief The number of touching contacts found by the last step
+        [[nodiscard]] std::size_t GetContactCount() const noexcept {
+            return m_Contacts.size();
+        }
+
+        /// @brief The number of islands solved by the last step, every awake body is part of one
+        [[nodiscard]] std::size_t GetIslandCount() const noexcept {
+            return m_IslandBodyOffsets.empty() ? 0 : m_IslandBodyOffsets.size() - 1;
+        }
+
+        [[nodiscard]] const PhysicsWorldProps2D& GetProps() const noexcept {
+            return m_Props;
+        }
+
+        void SetGravity(Vec2f gravity) {
+            m_Props.Gravity = gravity;
+        }
+    private:
+        struct ContactPointConstraint {
+            float AnchorAX;
+            float AnchorAY;
+            float AnchorBX;
+            float AnchorBY;
+            float NormalMass;
+            float TangentMass;
+            // The normal velocity the solver aims for, from the separation and restitution
+            float TargetVelocity;
+            float NormalImpulse  = 0.0F;
+            float TangentImpulse = 0.0F;
+        };
+
+        struct Contact {
+            // The body ids, the lower one in the high bits, keeps contacts sorted between steps
+            std::uint64_t                         Key;
+            BodyId2D                              BodyA;
+            BodyId2D                              BodyB;
+            Manifold2D                            Manifold;
+            std::array<ContactPointConstraint, 2> Points;
+            float                                 Friction;
+            float                                 Restitution;
+            // Two point contacts solve both normal impulses together, see SolveContact
+            bool  UseBlockSolver;
+            float BlockK11;
+            float BlockK12;
+            float BlockK22;
+            float BlockInverseDeterminant;
+        };
+
+        void StepInternal(float deltaTime, JobSystem* jobSystem);
+        // Wakes the other body of every contact of the body, which static bodies never do by themselves
+        void WakeContacts(BodyId2D body);
+        void FindPairs();
+        void UpdateContacts(JobSystem* jobSystem);
+        void BuildIslands();
+        void SolveIsland(std::size_t island, float deltaTime);
+        void Synchronize(float deltaTime);
+
+        void PrepareContact(Contact& contact, float inverseDeltaTime) const;
+        void WarmStartContact(const Contact& contact);
+        void SolveContact(Contact& contact);
+
+        PhysicsWorldProps2D m_Props;
+        DynamicAABBTree     m_Tree;
+
+        // Bodies
+        std::vector<float>         m_PositionX;
+        std::vector<float>         m_PositionY;
+        std::vector<float>         m_Angle;
+        std::vector<float>         m_Cos;
+        std::vector<float>         m_Sin;
+        std::vector<float>         m_VelocityX;
+        std::vector<float>         m_VelocityY;
+        std::vector<float>         m_AngularVelocity;
+        std::vector<float>         m_ForceX;
+        std::vector<float>         m_ForceY;
+        std::vector<float>         m_Torque;
+        std::vector<float>         m_InverseMass;
+        std::vector<float>         m_InverseInertia;
+        std::vector<float>         m_Friction;
+        std::vector<float>         m_Restitution;
+        std::vector<float>         m_SleepTime;
+        std::vector<BodyType2D>    m_Type;
+        std::vector<std::uint8_t>  m_Awake;
+        std::vector<std::uint8_t>  m_AllowSleep;
+        std::vector<std::uint8_t>  m_Alive;
+        std::vector<std::uint32_t> m_Proxies;
+        std::vector<Rect2Df>       m_Bounds;
+        std::vector<Shape2D>       m_Shapes;
+        std::vector<BodyId2D>      m_FreeBodies;
+        std::size_t                m_BodyCount = 0;
+
+        // Per step
+        std::vector<BodyId2D>      m_AwakeBodies;
+        std::vector<std::uint64_t> m_Pairs;
+        std::vector<Contact>       m_Contacts;
+        std::vector<Contact>       m_PreviousContacts;
+        std::vector<std::uint32_t> m_QueryResults;
+        CirclePairs2D              m_CirclePairs;
+        std::vector<std::uint32_t> m_CircleContacts;
+        std::vector<Manifold2D>    m_CircleManifolds;
+        std::vector<std::uint32_t> m_IslandParent;
+        std::vector<std::uint32_t> m_IslandOf;
+        std::vector<std::uint32_t> m_IslandBodies;
+        std::vector<std::uint32_t> m_IslandBodyOffsets;
+        std::vector<std::uint32_t> m_IslandContacts;
+        std::vector<std::uint32_t> m_IslandContactOffsets;
+    };
+} // namespace Astrelis
@@ -32,20 +32,20 @@ namespace Astrelis {
 
         /// @brief A uniform descriptor, used to describe a uniform in a descriptor set.
         struct Uniform {
-            RawRef<UniformBuffer*> Buffer;
+            UniformBufferHandle Buffer;
 
             // NOLINTNEXTLINE(hicpp-explicit-conversions, google-explicit-constructor)
-            Uniform(RawRef<UniformBuffer*> buffer) : Buffer(std::move(buffer)) {
+            Uniform(UniformBufferHandle buffer) : Buffer(buffer) {
             }
         };
 
         /// @brief A texture sampler descriptor, used to describe a texture sampler in a descriptor set.
         struct TextureSampler {
-            RawRef<TextureImage*>             Image;
-            RawRef<Astrelis::TextureSampler*> Sampler;
+            TextureImageHandle   Image;
+            TextureSamplerHandle Sampler;
 
-            TextureSampler(RawRef<TextureImage*> image, RawRef<Astrelis::TextureSampler*> sampler)
-                : Image(std::move(image)), Sampler(std::move(sampler)) {
+            TextureSampler(TextureImageHandle image, TextureSamplerHandle sampler)
+                : Image(image), Sampler(sampler) {
             }
         };
 
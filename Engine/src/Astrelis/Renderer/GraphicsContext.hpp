@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Astrelis/Core/Geometry.hpp"
 #include "Astrelis/Core/Pointer.hpp"
 #include "Astrelis/Core/Result.hpp"
 
@@ -19,7 +20,7 @@ namespace Astrelis {
     /**
     * @brief Per window graphics context, contains per window rendering state and resources.
     */
-    class GraphicsContext {
+    class GraphicsContext : public RefCounted {
     public:
         GraphicsContext()                                  = default;
         virtual ~GraphicsContext()                         = default;
@@ -40,6 +41,9 @@ namespace Astrelis {
         virtual void EndFrame() = 0;
         /// @brief Whether or not the current frame should be skipped (e.g. minimized window or swapchain recreation).
         virtual bool SkipFrame() = 0;
+        /// @brief Set the size of the window framebuffer, which the swapchain is recreated with.
+        /// @note The window system can only be queried on the main thread, so the size is passed in with every frame.
+        virtual void SetFramebufferSize(Dimension2Du size) = 0;
 
         /// @brief Whether or not VSync is enabled.
         virtual bool IsVSync() const = 0;
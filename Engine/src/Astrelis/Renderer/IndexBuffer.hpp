@@ -1,11 +1,14 @@
 #pragma once
 
+#include "Astrelis/Core/Handle.hpp"
+
 #include <cstdint>
 
 #include "GraphicsContext.hpp"
 
 namespace Astrelis {
     // uint32_t is used
+    /// @brief An index buffer that is rewritten every frame it is drawn in, @see VertexBuffer
     class IndexBuffer {
     public:
         IndexBuffer()                              = default;
@@ -17,8 +20,13 @@ namespace Astrelis {
 
         virtual bool Init(RefPtr<GraphicsContext>& context, std::uint32_t count) = 0;
         virtual void Destroy(RefPtr<GraphicsContext>& context)                   = 0;
-        virtual bool SetData(
-            RefPtr<GraphicsContext>& context, const std::uint32_t* data, std::uint32_t count) = 0;
-        virtual void Bind(RefPtr<GraphicsContext>& buffer) const                              = 0;
+        /// @brief Grows the copy of the current frame to at least count indices, discarding its contents
+        /// @note Has to be called before the buffer is bound in the frame
+        virtual bool Reserve(RefPtr<GraphicsContext>& context, std::uint32_t count) = 0;
+        virtual bool SetData(RefPtr<GraphicsContext>& context, const std::uint32_t* data,
+            std::uint32_t count, std::uint32_t firstIndex)                          = 0;
+        virtual void Bind(RefPtr<GraphicsContext>& buffer) const                    = 0;
     };
+
+    using IndexBufferHandle = Handle<IndexBuffer>;
 } // namespace Astrelis
@@ -0,0 +1,137 @@
+#pragma once
+
+#include "Astrelis/Core/Allocator.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Astrelis {
+    /// @brief A recorded list of render commands for a single frame
+    /// The game thread fills the packet with commands (callables) and copies of the data they need,
+    /// after which the packet is handed to the render thread and treated as immutable, @see RenderThread.
+    /// Memory is allocated in blocks that are kept between frames, so a warmed up packet does not allocate.
+    class RenderPacket {
+    public:
+        static constexpr std::size_t BLOCK_SIZE = 64 * 1024;
+
+        RenderPacket() = default;
+
+        ~RenderPacket() {
+            Reset();
+        }
+
+        RenderPacket(const RenderPacket&)            = delete;
+        RenderPacket& operator=(const RenderPacket&) = delete;
+        RenderPacket(RenderPacket&&)                 = delete;
+        RenderPacket& operator=(RenderPacket&&)      = delete;
+
+        /// @brief Records a command, which is executed when the packet is executed
+        /// @note The callable is stored by value, it should not capture references to game state
+        template<typename Fn> void Submit(Fn&& command) {
+            using CommandType = std::decay_t<Fn>;
+            void* storage     = Allocate(sizeof(CommandType), alignof(CommandType));
+            new (storage) CommandType(std::forward<Fn>(command));
+
+            m_Commands.push_back(Command {
+                [](void* ptr) { (*static_cast<CommandType*>(ptr))(); },
+                [](void* ptr) { static_cast<CommandType*>(ptr)->~CommandType(); },
+                storage,
+            });
+        }
+
+        /// @brief Copies the data into the packet, the returned span is valid until the packet is reset
+        template<typename T> std::span<const T> Copy(std::span<const T> data) {
+            static_assert(
+                std::is_trivially_copyable_v<T>, "Only trivially copyable data can be copied");
+            if (data.empty()) {
+                return {};
+            }
+
+            void* storage = Allocate(data.size_bytes(), alignof(T));
+            std::memcpy(storage, data.data(), data.size_bytes());
+            return {static_cast<const T*>(storage), data.size()};
+        }
+
+        /// @brief Uninitialized space for count values, for data that is written in place instead of copied
+        /// The span is valid until the packet is reset, and has to be filled before the packet is kicked.
+        template<typename T> std::span<T> AllocateArray(std::size_t count) {
+            static_assert(
+                std::is_trivially_copyable_v<T>, "Only trivially copyable data can be stored");
+            if (count == 0) {
+                return {};
+            }
+
+            return {static_cast<T*>(Allocate(sizeof(T) * count, alignof(T))), count};
+        }
+
+        /// @brief Executes all of the commands in submission order, and resets the packet
+        void Execute() {
+            for (auto& command : m_Commands) {
+                command.Execute(command.Storage);
+                command.Destroy(command.Storage);
+            }
+            m_Commands.clear();
+            Reset();
+        }
+
+        /// @brief Discards all of the commands, keeping the memory blocks for the next frame
+        void Reset() {
+            for (auto& command : m_Commands) {
+                command.Destroy(command.Storage);
+            }
+            m_Commands.clear();
+            m_BlockIndex  = 0;
+            m_BlockOffset = 0;
+        }
+
+        [[nodiscard]] std::size_t GetCommandCount() const noexcept {
+            return m_Commands.size();
+        }
+
+        [[nodiscard]] bool IsEmpty() const noexcept {
+            return m_Commands.empty();
+        }
+    private:
+        struct Command {
+            void (*Execute)(void*);
+            void (*Destroy)(void*);
+            void* Storage;
+        };
+
+        void* Allocate(std::size_t size, std::size_t alignment) {
+            while (m_BlockIndex < m_Blocks.size()) {
+                auto& block = m_Blocks[m_BlockIndex];
+                auto  address =
+                    reinterpret_cast<std::uintptr_t>(block.data()) + m_BlockOffset;
+                std::size_t padding = (alignment - (address % alignment)) % alignment;
+                if (m_BlockOffset + padding + size <= block.size()) {
+                    m_BlockOffset += padding + size;
+                    return reinterpret_cast<void*>(address + padding);
+                }
+                m_BlockIndex++;
+                m_BlockOffset = 0;
+            }
+
+            // Blocks are never resized, so previously returned pointers stay valid
+            m_Blocks.emplace_back(
+                std::max(BLOCK_SIZE, size + alignment), Block::allocator_type(MemoryTag::Renderer));
+            m_BlockIndex = m_Blocks.size() - 1;
+            return Allocate(size, alignment);
+        }
+
+        using Block = std::vector<std::byte, StlAllocator<std::byte>>;
+
+        std::vector<Command, StlAllocator<Command>> m_Commands {
+            StlAllocator<Command>(MemoryTag::Renderer)};
+        std::vector<Block, StlAllocator<Block>> m_Blocks {StlAllocator<Block>(MemoryTag::Renderer)};
+        std::size_t                             m_BlockIndex  = 0;
+        std::size_t                             m_BlockOffset = 0;
+    };
+} // namespace Astrelis
@@ -13,7 +13,7 @@ namespace Astrelis {
         std::uint32_t Height;
     };
 
-    class RenderSystem {
+    class RenderSystem : public RefCounted {
     public:
         RenderSystem()                               = default;
         virtual ~RenderSystem()                      = default;
@@ -0,0 +1,111 @@
+#include "RenderThread.hpp"
+
+#include "Astrelis/Core/Base.hpp"
+
+namespace Astrelis {
+    RenderThread* RenderThread::s_Instance = nullptr;
+
+    RenderThread::~RenderThread() {
+        Shutdown();
+    }
+
+    void RenderThread::Init(std::uint32_t packetCount) {
+        ASTRELIS_PROFILE_FUNCTION();
+        ASTRELIS_CORE_ASSERT(!IsRunning(), "RenderThread is already running");
+        ASTRELIS_CORE_ASSERT(s_Instance == nullptr, "Only one RenderThread can be running");
+        ASTRELIS_CORE_ASSERT(packetCount >= 2, "Pipelined rendering needs at least two packets");
+
+        m_Packets.clear();
+        for (std::uint32_t i = 0; i < packetCount; i++) {
+            m_Packets.emplace_back(ScopedPtr<RenderPacket>::Create());
+        }
+
+        m_SubmitIndex   = 0;
+        m_ExecutedIndex = 0;
+        m_Running       = true;
+        s_Instance      = this;
+        m_Thread        = std::thread([this]() { ThreadLoop(); });
+    }
+
+    void RenderThread::Shutdown() {
+        ASTRELIS_PROFILE_FUNCTION();
+        if (!IsRunning()) {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Running = false;
+        }
+        m_PacketKicked.notify_one();
+        m_Thread.join();
+
+        // Commands recorded after the last kick reference objects that may be destroyed
+        GetSubmitPacket().Reset();
+        s_Instance = nullptr;
+    }
+
+    void RenderThread::Kick() {
+        ASTRELIS_PROFILE_FUNCTION();
+        ASTRELIS_CORE_ASSERT(IsRunning(), "RenderThread is not running");
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_SubmitIndex++;
+        m_PacketKicked.notify_one();
+
+        // The next packet is free once the render thread is less than packetCount frames behind
+        ASTRELIS_PROFILE_SCOPE("Wait for RenderThread");
+        m_PacketExecuted.wait(
+            lock, [this]() { return m_SubmitIndex - m_ExecutedIndex < m_Packets.size(); });
+    }
+
+    void RenderThread::WaitIdle() {
+        ASTRELIS_PROFILE_FUNCTION();
+        if (!IsRunning()) {
+            return;
+        }
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_PacketExecuted.wait(lock, [this]() { return m_ExecutedIndex == m_SubmitIndex; });
+    }
+
+    bool RenderThread::IsIdle() {
+        if (s_Instance == nullptr) {
+            return true;
+        }
+        if (s_Instance->IsRenderThread()) {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(s_Instance->m_Mutex);
+        return s_Instance->m_ExecutedIndex == s_Instance->m_SubmitIndex;
+    }
+
+    void RenderThread::ThreadLoop() {
+        ASTRELIS_PROFILE_THREAD("Render Thread");
+        while (true) {
+            RenderPacket* packet = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(m_Mutex);
+                m_PacketKicked.wait(
+                    lock, [this]() { return !m_Running || m_ExecutedIndex < m_SubmitIndex; });
+                if (m_ExecutedIndex == m_SubmitIndex) {
+                    // Stopped, and every kicked packet has been executed
+                    return;
+                }
+                packet = m_Packets[m_ExecutedIndex % m_Packets.size()].Get();
+            }
+
+            {
+                ASTRELIS_PROFILE_SCOPE("Execute RenderPacket");
+                packet->Execute();
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                m_ExecutedIndex++;
+            }
+            m_PacketExecuted.notify_all();
+        }
+    }
+} // namespace Astrelis
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "Astrelis/Core/Pointer.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "RenderPacket.hpp"
+
+namespace Astrelis {
+    /// @brief Consumes render packets on a dedicated thread
+    /// The game thread records a RenderPacket each frame and kicks it, then starts simulating the next frame
+    /// while the render thread records and submits the previous one. The number of packets (frames) in flight is
+    /// bounded by the packet count, which the application takes from RendererAPI::GetBufferingCount.
+    class RenderThread {
+    public:
+        RenderThread() = default;
+        ~RenderThread();
+        RenderThread(const RenderThread&)            = delete;
+        RenderThread& operator=(const RenderThread&) = delete;
+        RenderThread(RenderThread&&)                 = delete;
+        RenderThread& operator=(RenderThread&&)      = delete;
+
+        /// @brief Starts the render thread
+        /// @param packetCount The number of packets that can be in flight, must be at least 2 for any overlap
+        void Init(std::uint32_t packetCount);
+        /// @brief Executes the packets that were already kicked, and joins the render thread
+        void Shutdown();
+
+        /// @brief Hands the current packet to the render thread, and moves on to the next packet
+        /// This blocks if the render thread is already packetCount - 1 frames behind.
+        void Kick();
+        /// @brief Blocks until the render thread has executed all kicked packets
+        void WaitIdle();
+
+        /// @brief The packet that is currently recorded by the game thread
+        RenderPacket& GetSubmitPacket() {
+            return *m_Packets[m_SubmitIndex % m_Packets.size()];
+        }
+
+        [[nodiscard]] bool IsRunning() const noexcept {
+            return m_Thread.joinable();
+        }
+
+        [[nodiscard]] bool IsRenderThread() const noexcept {
+            return std::this_thread::get_id() == m_Thread.get_id();
+        }
+
+        /// @brief Whether render commands are currently deferred to a render thread
+        static bool IsPipelined() {
+            return s_Instance != nullptr && !s_Instance->IsRenderThread();
+        }
+
+        /// @brief Whether no kicked packet is waiting or executing, always false on the render thread itself
+        static bool IsIdle();
+
+        /// @brief Records a render command into the current packet, or executes it immediately if rendering is not pipelined
+        template<typename Fn> static void Submit(Fn&& command) {
+            if (IsPipelined()) {
+                s_Instance->GetSubmitPacket().Submit(std::forward<Fn>(command));
+            }
+            else {
+                command();
+            }
+        }
+
+        /// @brief Copies data that a render command needs into the current packet
+        /// If rendering is not pipelined the data is not copied, as the command executes immediately
+        template<typename T> static std::span<const T> Copy(std::span<const T> data) {
+            if (IsPipelined()) {
+                return s_Instance->GetSubmitPacket().Copy(data);
+            }
+            return data;
+        }
+
+        /// @brief Space in the current packet that a render command can read from, filled in place by the caller
+        /// If rendering is not pipelined nothing is allocated and the span is empty, the caller keeps the data
+        /// itself then, as the command executes immediately.
+        template<typename T> static std::span<T> Allocate(std::size_t count) {
+            if (IsPipelined()) {
+                return s_Instance->GetSubmitPacket().AllocateArray<T>(count);
+            }
+            return {};
+        }
+    private:
+        void ThreadLoop();
+
+        static RenderThread* s_Instance;
+
+        std::vector<ScopedPtr<RenderPacket>> m_Packets;
+        std::thread                          m_Thread;
+        std::mutex                           m_Mutex;
+        std::condition_variable              m_PacketKicked;
+        std::condition_variable              m_PacketExecuted;
+        bool                                 m_Running = false;
+        // Packet indices increase forever, the slot is the index modulo the packet count
+        std::uint64_t m_SubmitIndex   = 0;
+        std::uint64_t m_ExecutedIndex = 0;
+    };
+} // namespace Astrelis
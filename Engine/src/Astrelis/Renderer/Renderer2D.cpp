@@ -2,23 +2,44 @@
 
 #include "Astrelis/Core/Base.hpp"
 
+#include "Astrelis/Core/Application.hpp"
 #include "Astrelis/Core/GlobalConfig.hpp"
 #include "Astrelis/Renderer/BindingDescriptor.hpp"
 #include "Astrelis/Renderer/ShaderFormat.hpp"
 
+#include <cstring>
+#include <optional>
+
 #include "GraphicsPipeline.hpp"
+#include "RenderThread.hpp"
 
 namespace Astrelis {
-    static constexpr std::uint32_t MAX_INSTANCE_COUNT = 1'000;
+    // The buffers start at this size, and grow when a frame needs more
+    static constexpr std::uint32_t INITIAL_VERTEX_COUNT   = 1'024;
+    static constexpr std::uint32_t INITIAL_INDEX_COUNT    = 1'536;
+    static constexpr std::uint32_t INITIAL_INSTANCE_COUNT = 16'384;
 
     Renderer2D::Renderer2D(RefPtr<Window> window, Rect2Di viewport)
         : BaseRenderer(std::move(window), viewport) {
         ASTRELIS_PROFILE_FUNCTION();
-        m_Instances.reserve(MAX_INSTANCE_COUNT);
     }
 
     bool Renderer2D::InitComponents() {
         ASTRELIS_PROFILE_FUNCTION();
+        File shader("resources/shaders/Basic.astshader");
+        ASTRELIS_VERIFY(shader.Exists(), "Shader file does not exist!");
+
+        // Reading and deserializing the shader overlaps with creating the buffers
+        JobSystem& jobSystem = Application::Get().GetJobSystem();
+        JobCounter shaderLoad;
+        std::optional<Result<ShaderFormat, std::string>> shaderResult;
+        jobSystem.Schedule(
+            [&shader, &shaderResult]() {
+                ASTRELIS_PROFILE_SCOPE("Load Renderer2D Shader");
+                shaderResult.emplace(shader.ReadBinaryStructure<ShaderFormat>());
+            },
+            &shaderLoad);
+
         std::vector<BufferBinding> vertexInputs(2);
         vertexInputs[0].Binding   = 0;
         vertexInputs[0].Stride    = sizeof(Vertex2D);
@@ -36,12 +57,23 @@ namespace Astrelis {
             {VertexInput::VertexType::Float, 8 * sizeof(float), 4, 4},
             {VertexInput::VertexType::Float, 12 * sizeof(float), 4, 5},
             {VertexInput::VertexType::Float, offsetof(InstanceData, Color), 3, 6},
+            {VertexInput::VertexType::Float, offsetof(InstanceData, TexCoords), 4, 7},
         };
 
+        m_VertexBuffer = m_RendererAPI->CreateVertexBuffer();
+        m_RendererAPI->Get(m_VertexBuffer)
+            ->Init(m_Context, sizeof(Vertex2D) * INITIAL_VERTEX_COUNT);
+        m_InstanceBuffer = m_RendererAPI->CreateVertexBuffer();
+        m_RendererAPI->Get(m_InstanceBuffer)
+            ->Init(m_Context, sizeof(InstanceData) * INITIAL_INSTANCE_COUNT);
+        m_IndexBuffer = m_RendererAPI->CreateIndexBuffer();
+        m_RendererAPI->Get(m_IndexBuffer)->Init(m_Context, INITIAL_INDEX_COUNT);
 
-        File shader("resources/shaders/Basic.astshader");
-        ASTRELIS_VERIFY(shader.Exists(), "Shader file does not exist!");
-        auto res = shader.ReadBinaryStructure<ShaderFormat>();
+        m_UniformBuffer = m_RendererAPI->CreateUniformBuffer();
+        m_RendererAPI->Get(m_UniformBuffer)->Init(m_Context, sizeof(CameraUniformData));
+
+        jobSystem.Wait(shaderLoad);
+        auto& res = *shaderResult;
         if (res.IsErr()) {
             ASTRELIS_CORE_LOG_ERROR("Failed to read shader file: {0}", res.UnwrapErr());
             return false;
@@ -81,21 +113,10 @@ namespace Astrelis {
 
         PipelineShaders shaders(vertexCompiled, fragmentCompiled);
 
-        m_VertexBuffer        = m_RendererAPI->CreateVertexBuffer();
-        auto vertexBufferSize = sizeof(Vertex2D) * 1000;
-        m_VertexBuffer->Init(m_Context, vertexBufferSize);
-        m_InstanceBuffer = m_RendererAPI->CreateVertexBuffer();
-        m_InstanceBuffer->Init(m_Context, sizeof(InstanceData) * MAX_INSTANCE_COUNT);
-        m_IndexBuffer = m_RendererAPI->CreateIndexBuffer();
-        m_IndexBuffer->Init(m_Context, 1000);
-
-        m_UniformBuffer = m_RendererAPI->CreateUniformBuffer();
-        m_UniformBuffer->Init(m_Context, sizeof(CameraUniformData));
-
         const std::vector<DescriptorSetBinding> bindings = {
             DescriptorSetBinding("MVP", DescriptorType::Uniform, 0,
                 DescriptorSetBinding::StageFlags::Vertex, sizeof(CameraUniformData),
-                {{m_UniformBuffer.Raw()}}),
+                {{m_UniformBuffer}}),
         };
 
 
@@ -118,11 +139,11 @@ namespace Astrelis {
         ASTRELIS_PROFILE_FUNCTION();
         m_RendererAPI->WaitDeviceIdle();
 
-        m_VertexBuffer->Destroy(m_Context);
-        m_IndexBuffer->Destroy(m_Context);
-        m_InstanceBuffer->Destroy(m_Context);
+        m_RendererAPI->Destroy(m_VertexBuffer);
+        m_RendererAPI->Destroy(m_IndexBuffer);
+        m_RendererAPI->Destroy(m_InstanceBuffer);
 
-        m_UniformBuffer->Destroy(m_Context);
+        m_RendererAPI->Destroy(m_UniformBuffer);
         m_Bindings->Destroy(m_Context);
         m_Pipeline->Destroy(m_Context);
 
@@ -131,30 +152,118 @@ namespace Astrelis {
 
     void Renderer2D::BeginFrame() {
         ASTRELIS_PROFILE_SCOPE("Astrelis::Renderer2D::BeginFrame");
-        InternalBeginFrame();
-
-        m_VertexBuffer->Bind(m_Context, 0);
-        m_InstanceBuffer->Bind(m_Context, 1);
-        m_IndexBuffer->Bind(m_Context);
-        m_UniformBuffer->SetData(m_Context, &m_UBO, sizeof(CameraUniformData), 0);
-        m_Bindings->Bind(m_Context, m_Pipeline);
+        // The camera is copied, so the game thread can keep updating it while the frame is recorded
+        RenderThread::Submit([this, ubo = m_UBO]() {
+            InternalBeginFrame();
+
+            m_RendererAPI->Get(m_UniformBuffer)
+                ->SetData(m_Context, &ubo, sizeof(CameraUniformData), 0);
+            m_Bindings->Bind(m_Context, m_Pipeline);
+        });
     }
 
     void Renderer2D::SubmitInstanced(
         const Mesh2D& mesh, const std::vector<InstanceData>& instances) {
         ASTRELIS_PROFILE_SCOPE("Astrelis::Renderer2D::Submit");
+        AddBatch(mesh, Retain(std::span<const InstanceData>(instances)));
+    }
 
-        m_VertexBuffer->SetData(m_Context, mesh.Vertices.data(),
-            static_cast<std::uint32_t>(mesh.Vertices.size() * sizeof(Vertex2D)));
-        m_IndexBuffer->SetData(m_Context, mesh.Indices.data(),
-            static_cast<std::uint32_t>(mesh.Indices.size() * sizeof(Mesh2D::IndicesType)));
-        m_InstanceBuffer->SetData(m_Context, instances.data(),
-            static_cast<std::uint32_t>(instances.size() * sizeof(InstanceData)));
+    std::span<InstanceData> Renderer2D::AllocateInstances(std::size_t count) {
+        ASTRELIS_PROFILE_FUNCTION();
+        if (RenderThread::IsPipelined()) {
+            return RenderThread::Allocate<InstanceData>(count);
+        }
+        // The frame arena keeps the instances until the frame is flushed
+        void* instances =
+            FrameAllocator::Allocate(sizeof(InstanceData) * count, alignof(InstanceData));
+        return {static_cast<InstanceData*>(instances), count};
+    }
+
+    void Renderer2D::SubmitAllocatedInstances(
+        const Mesh2D& mesh, std::span<const InstanceData> instances) {
+        ASTRELIS_PROFILE_SCOPE("Astrelis::Renderer2D::Submit");
+        AddBatch(mesh, instances);
+    }
+
+    template<typename T> std::span<const T> Renderer2D::Retain(std::span<const T> data) {
+        if (RenderThread::IsPipelined() || data.empty()) {
+            return RenderThread::Copy(data);
+        }
+
+        void* storage = FrameAllocator::Allocate(data.size_bytes(), alignof(T));
+        std::memcpy(storage, data.data(), data.size_bytes());
+        return {static_cast<const T*>(storage), data.size()};
+    }
 
-        m_RendererAPI->DrawInstancedIndexed(mesh.Indices.size(), instances.size(), 0, 0, 0);
+    void Renderer2D::AddBatch(const Mesh2D& mesh, std::span<const InstanceData> instances) {
+        if (instances.empty()) {
+            return;
+        }
+
+        // Each draw gets its own range of the buffers, so the meshes do not overwrite each other
+        m_Batches.push_back(DrawBatch {
+            Retain(std::span<const Vertex2D>(mesh.Vertices)),
+            Retain(std::span<const Mesh2D::IndicesType>(mesh.Indices)),
+            instances,
+        });
+        m_VertexCount += mesh.Vertices.size();
+        m_IndexCount += mesh.Indices.size();
+        m_InstanceCount += instances.size();
     }
 
     void Renderer2D::EndFrame() {
         ASTRELIS_PROFILE_SCOPE("Astrelis::Renderer2D::EndFrame");
+        if (m_Batches.empty()) {
+            return;
+        }
+
+        RenderThread::Submit([this, batches = Retain(std::span<const DrawBatch>(m_Batches)),
+                                 vertexCount = m_VertexCount, indexCount = m_IndexCount,
+                                 instanceCount = m_InstanceCount]() {
+            Flush(batches, vertexCount, indexCount, instanceCount);
+        });
+        m_Batches.clear();
+        m_VertexCount   = 0;
+        m_IndexCount    = 0;
+        m_InstanceCount = 0;
+    }
+
+    void Renderer2D::Flush(std::span<const DrawBatch> batches, std::size_t vertexCount,
+        std::size_t indexCount, std::size_t instanceCount) {
+        ASTRELIS_PROFILE_FUNCTION();
+        VertexBuffer* vertexBuffer   = m_RendererAPI->Get(m_VertexBuffer);
+        VertexBuffer* instanceBuffer = m_RendererAPI->Get(m_InstanceBuffer);
+        IndexBuffer*  indexBuffer    = m_RendererAPI->Get(m_IndexBuffer);
+
+        // Nothing of this frame is bound yet, so the buffers of the frame can still grow
+        if (!vertexBuffer->Reserve(m_Context, sizeof(Vertex2D) * vertexCount)
+            || !instanceBuffer->Reserve(m_Context, sizeof(InstanceData) * instanceCount)
+            || !indexBuffer->Reserve(m_Context, static_cast<std::uint32_t>(indexCount))) {
+            ASTRELIS_CORE_LOG_ERROR("Failed to grow the Renderer2D buffers to {0} instances",
+                instanceCount);
+            return;
+        }
+        vertexBuffer->Bind(m_Context, 0);
+        instanceBuffer->Bind(m_Context, 1);
+        indexBuffer->Bind(m_Context);
+
+        std::uint32_t firstVertex   = 0;
+        std::uint32_t firstIndex    = 0;
+        std::uint32_t firstInstance = 0;
+        for (const DrawBatch& batch : batches) {
+            const auto batchIndices   = static_cast<std::uint32_t>(batch.Indices.size());
+            const auto batchInstances = static_cast<std::uint32_t>(batch.Instances.size());
+            vertexBuffer->SetData(m_Context, batch.Vertices.data(), batch.Vertices.size_bytes(),
+                sizeof(Vertex2D) * firstVertex);
+            indexBuffer->SetData(m_Context, batch.Indices.data(), batchIndices, firstIndex);
+            instanceBuffer->SetData(m_Context, batch.Instances.data(),
+                batch.Instances.size_bytes(), sizeof(InstanceData) * firstInstance);
+
+            m_RendererAPI->DrawInstancedIndexed(
+                batchIndices, batchInstances, firstIndex, firstVertex, firstInstance);
+            firstVertex += static_cast<std::uint32_t>(batch.Vertices.size());
+            firstIndex += batchIndices;
+            firstInstance += batchInstances;
+        }
     }
 } // namespace Astrelis
@@ -5,6 +5,10 @@
 #include "Astrelis/Core/Pointer.hpp"
 #include "Astrelis/Core/Window.hpp"
 
+#include <cstddef>
+#include <span>
+#include <vector>
+
 #include "BaseRenderer.hpp"
 #include "BindingDescriptor.hpp"
 #include "Mesh.hpp"
@@ -20,6 +24,9 @@ namespace Astrelis {
     struct InstanceData {
         Mat4f Transform;
         Vec3f Color;
+        /// @brief Maps the texture coordinates of the mesh to a part of the texture, like a frame of a sprite sheet
+        /// The offset is in XY and the scale in ZW, so the default covers the whole texture.
+        Vec4f TexCoords = Vec4f(0.0F, 0.0F, 1.0F, 1.0F);
     };
 
     class Renderer2D : public BaseRenderer {
@@ -37,24 +44,49 @@ namespace Astrelis {
         void BeginFrame() override;
         void EndFrame() override;
 
+        /// @brief Draws the instances of the mesh, each submit in a frame is one draw call
         void SubmitInstanced(const Mesh2D& mesh, const std::vector<InstanceData>& instance);
+
+        /**
+        * @brief Space for count instances, filled in place and drawn with SubmitAllocatedInstances
+        * Lets large batches, like particles, skip building an instance list that SubmitInstanced then copies. The span
+        * stays valid until the end of the frame.
+        */
+        std::span<InstanceData> AllocateInstances(std::size_t count);
+        void SubmitAllocatedInstances(const Mesh2D& mesh, std::span<const InstanceData> instances);
     private:
+        struct DrawBatch {
+            std::span<const Vertex2D>            Vertices;
+            std::span<const Mesh2D::IndicesType> Indices;
+            std::span<const InstanceData>        Instances;
+        };
+
+        // Keeps the data until the frame is flushed, in the render packet or the frame arena
+        template<typename T> static std::span<const T> Retain(std::span<const T> data);
+        void AddBatch(const Mesh2D& mesh, std::span<const InstanceData> instances);
+        void Flush(std::span<const DrawBatch> batches, std::size_t vertexCount,
+            std::size_t indexCount, std::size_t instanceCount);
+
         // ========================
         // Rendering States
         // ========================
-        RefPtr<VertexBuffer>         m_VertexBuffer;
-        RefPtr<VertexBuffer>         m_InstanceBuffer;
-        RefPtr<IndexBuffer>          m_IndexBuffer;
+        VertexBufferHandle           m_VertexBuffer;
+        VertexBufferHandle           m_InstanceBuffer;
+        IndexBufferHandle            m_IndexBuffer;
         CameraUniformData            m_UBO;
         RefPtr<BindingDescriptorSet> m_Bindings;
-        RefPtr<UniformBuffer>        m_UniformBuffer;
+        UniformBufferHandle          m_UniformBuffer;
 
         // ========================
         // Rendering Data
         // ========================
 
-        // For now everything is a quad
-        std::vector<InstanceData> m_Instances;
+        // The draws of the frame, they are uploaded and recorded together in EndFrame, as the buffers can only
+        // grow before they are bound
+        std::vector<DrawBatch> m_Batches;
+        std::size_t            m_VertexCount   = 0;
+        std::size_t            m_IndexCount    = 0;
+        std::size_t            m_InstanceCount = 0;
     };
 
 } // namespace Astrelis
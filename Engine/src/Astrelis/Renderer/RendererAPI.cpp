@@ -4,6 +4,8 @@
 
 #include "Astrelis/Core/Application.hpp"
 
+#include "RenderThread.hpp"
+
 #ifdef ASTRELIS_RENDERER_VULKAN
     #include "Platform/Vulkan/VulkanRendererHelper.hpp"
 #endif
@@ -28,6 +30,11 @@ namespace Astrelis {
         s_BufferingMode = mode;
     }
 
+    void RendererAPI::AssertResourcesUnused() {
+        ASTRELIS_CORE_ASSERT(RenderThread::IsIdle(),
+            "Renderer resources can only be created or destroyed while the render thread is idle");
+    }
+
 
 #ifdef ASTRELIS_RENDERER_VULKAN
     RendererAPI::API RendererAPI::s_API = RendererAPI::API::Vulkan;
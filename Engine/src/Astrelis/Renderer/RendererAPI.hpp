@@ -14,7 +14,7 @@
 #include "VertexBuffer.hpp"
 
 namespace Astrelis {
-    class RendererAPI {
+    class RendererAPI : public RefCounted {
     public:
         enum class API : std::uint8_t {
             None   = 0,
@@ -77,16 +77,42 @@ namespace Astrelis {
             std::uint32_t firstIndex, std::uint32_t vertexOffset, std::uint32_t firstInstance) = 0;
 
         virtual RefPtr<GraphicsPipeline>     CreateGraphicsPipeline() = 0;
-        virtual RefPtr<VertexBuffer>         CreateVertexBuffer()     = 0;
-        virtual RefPtr<IndexBuffer>          CreateIndexBuffer()      = 0;
         virtual RefPtr<BindingDescriptorSet> CreateBindingDescriptorSet(
-            BindingDescriptorSet::Mode mode)                  = 0;
-        virtual RefPtr<UniformBuffer>  CreateUniformBuffer()  = 0;
-        virtual RefPtr<TextureImage>   CreateTextureImage()   = 0;
-        virtual RefPtr<TextureSampler> CreateTextureSampler() = 0;
+            BindingDescriptorSet::Mode mode) = 0;
+
+        // ========================
+        // Handle based resources
+        // ========================
+        // Buffers and textures are owned by the API and stored densely per type, so they are referenced by
+        // generational handles, a handle to a destroyed resource resolves to nullptr. The pointers returned by Get
+        // are only valid until the next resource of the same type is created or destroyed, so they should not be
+        // kept. Resources are created and destroyed on the game thread while the render thread is idle, which the
+        // implementations assert, as the render thread resolves handles while it executes a packet.
+
+        virtual VertexBufferHandle   CreateVertexBuffer()   = 0;
+        virtual IndexBufferHandle    CreateIndexBuffer()    = 0;
+        virtual UniformBufferHandle  CreateUniformBuffer()  = 0;
+        virtual TextureImageHandle   CreateTextureImage()   = 0;
+        virtual TextureSamplerHandle CreateTextureSampler() = 0;
+
+        [[nodiscard]] virtual VertexBuffer*   Get(VertexBufferHandle handle)   = 0;
+        [[nodiscard]] virtual IndexBuffer*    Get(IndexBufferHandle handle)    = 0;
+        [[nodiscard]] virtual UniformBuffer*  Get(UniformBufferHandle handle)  = 0;
+        [[nodiscard]] virtual TextureImage*   Get(TextureImageHandle handle)   = 0;
+        [[nodiscard]] virtual TextureSampler* Get(TextureSamplerHandle handle) = 0;
+
+        /// @brief Destroys the GPU resource and frees its slot, stale handles are ignored
+        virtual void Destroy(VertexBufferHandle handle)   = 0;
+        virtual void Destroy(IndexBufferHandle handle)    = 0;
+        virtual void Destroy(UniformBufferHandle handle)  = 0;
+        virtual void Destroy(TextureImageHandle handle)   = 0;
+        virtual void Destroy(TextureSamplerHandle handle) = 0;
 
         static RefPtr<RendererAPI> Create(
             RefPtr<GraphicsContext> context, Type type = Type::Renderer2D);
+    protected:
+        /// @brief Asserts that no packet is being executed, called before a resource is created or destroyed
+        static void AssertResourcesUnused();
     private:
         static API           s_API;
         static BufferingMode s_BufferingMode;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Astrelis/Core/Handle.hpp"
 #include "Astrelis/IO/Image.hpp"
 #include "Astrelis/Renderer/GraphicsContext.hpp"
 
@@ -16,4 +17,6 @@ namespace Astrelis {
         virtual bool LoadTexture(RefPtr<GraphicsContext>& context, InMemoryImage& image) = 0;
         virtual void Destroy(RefPtr<GraphicsContext>& context)                           = 0;
     };
+
+    using TextureImageHandle = Handle<TextureImage>;
 } // namespace Astrelis
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Astrelis/Core/Handle.hpp"
 #include "Astrelis/Core/Pointer.hpp"
 
 #include "GraphicsContext.hpp"
@@ -17,4 +18,6 @@ namespace Astrelis {
         virtual bool Init(RefPtr<GraphicsContext>& context)    = 0;
         virtual void Destroy(RefPtr<GraphicsContext>& context) = 0;
     };
+
+    using TextureSamplerHandle = Handle<TextureSampler>;
 } // namespace Astrelis
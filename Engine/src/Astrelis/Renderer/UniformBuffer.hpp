@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Astrelis/Core/Handle.hpp"
+
 #include <cstdint>
 
 #include "GraphicsContext.hpp"
@@ -19,4 +21,6 @@ namespace Astrelis {
         virtual void SetData(
             RefPtr<GraphicsContext>& context, const void* data, uint32_t size, uint32_t offset) = 0;
     };
+
+    using UniformBufferHandle = Handle<UniformBuffer>;
 } // namespace Astrelis
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Astrelis/Core/Handle.hpp"
 #include "Astrelis/Core/Pointer.hpp"
 
 #include <cstddef>
@@ -7,6 +8,9 @@
 #include "GraphicsContext.hpp"
 
 namespace Astrelis {
+    /// @brief A vertex buffer that is rewritten every frame it is drawn in
+    /// Each frame in flight has its own copy, so the data written while recording a frame does not affect frames
+    /// that the GPU is still rendering.
     class VertexBuffer {
     public:
         VertexBuffer()                               = default;
@@ -19,8 +23,14 @@ namespace Astrelis {
         virtual bool Init(RefPtr<GraphicsContext>& context, std::size_t size) = 0;
         virtual void Destroy(RefPtr<GraphicsContext>& context)                = 0;
 
-        virtual bool SetData(
-            RefPtr<GraphicsContext>& context, const void* data, std::size_t size)        = 0;
+        /// @brief Grows the copy of the current frame to at least size bytes, discarding its contents
+        /// @note Has to be called before the buffer is bound in the frame
+        virtual bool Reserve(RefPtr<GraphicsContext>& context, std::size_t size) = 0;
+        /// @param offset Where the data is written to in the buffer, in bytes
+        virtual bool SetData(RefPtr<GraphicsContext>& context, const void* data, std::size_t size,
+            std::size_t offset)                                                          = 0;
         virtual void Bind(RefPtr<GraphicsContext>& context, std::uint32_t binding) const = 0;
     };
+
+    using VertexBufferHandle = Handle<VertexBuffer>;
 } // namespace Astrelis
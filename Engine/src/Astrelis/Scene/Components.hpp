@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Astrelis/Core/Math.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+namespace Astrelis {
+    /// @brief The display name of an entity, every entity created by a scene has one
+    struct Tag {
+        std::string Name;
+
+        explicit Tag(std::string name = "Entity") : Name(std::move(name)) {
+        }
+    };
+
+    /// @brief Position, rotation and scale on the XY plane, the depth orders sprites that overlap
+    struct Transform2D {
+        Vec2f Position = Vec2f(0.0F);
+        /// @brief Rotation around the Z axis, in radians
+        float Rotation = 0.0F;
+        Vec2f Scale    = Vec2f(1.0F);
+        float Depth    = 0.0F;
+
+        /// @brief The matrix of translate * rotate * scale, built directly since the rotation is around Z
+        [[nodiscard]] Mat4f GetTransform() const {
+            const float cos = std::cos(Rotation);
+            const float sin = std::sin(Rotation);
+
+            glm::mat4 transform(1.0F);
+            transform[0][0] = cos * Scale[0];
+            transform[0][1] = sin * Scale[0];
+            transform[1][0] = -sin * Scale[1];
+            transform[1][1] = cos * Scale[1];
+            transform[3][0] = Position[0];
+            transform[3][1] = Position[1];
+            transform[3][2] = Depth;
+            return transform;
+        }
+    };
+
+    /// @brief Draws the entity as a colored quad, @see SpriteRenderSystem
+    struct SpriteRenderer {
+        Vec3f Color     = Vec3f(1.0F);
+        /// @brief The part of the texture that is drawn, the offset in XY and the scale in ZW, @see InstanceData
+        Vec4f TexCoords = Vec4f(0.0F, 0.0F, 1.0F, 1.0F);
+    };
+
+    /// @brief The index of a clip added to a SpriteAnimationSystem
+    using SpriteClipId = std::uint32_t;
+
+    /// @brief Plays a clip on the SpriteRenderer of the entity, @see SpriteAnimationSystem
+    struct SpriteAnimator {
+        SpriteClipId Clip    = 0;
+        /// @brief How far into the clip the animation is, in seconds
+        float        Time    = 0.0F;
+        /// @brief Negative speeds play the clip backwards
+        float        Speed   = 1.0F;
+        bool         Playing = true;
+    };
+} // namespace Astrelis
@@ -0,0 +1,391 @@
+#include "DynamicAABBTree.hpp"
+
+#include "Astrelis/Core/Base.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace Astrelis {
+    namespace {
+        /// A traversal stack that lives on the call stack, and only allocates for unusually deep trees
+        class NodeStack {
+        public:
+            void Push(std::uint32_t node) {
+                if (m_Size < m_Inline.size()) {
+                    m_Inline[m_Size++] = node;
+                    return;
+                }
+                m_Overflow.push_back(node);
+            }
+
+            std::uint32_t Pop() {
+                if (!m_Overflow.empty()) {
+                    const std::uint32_t node = m_Overflow.back();
+                    m_Overflow.pop_back();
+                    return node;
+                }
+                return m_Inline[--m_Size];
+            }
+
+            [[nodiscard]] bool IsEmpty() const noexcept {
+                return m_Size == 0 && m_Overflow.empty();
+            }
+        private:
+            std::array<std::uint32_t, 128> m_Inline;
+            std::size_t                    m_Size = 0;
+            std::vector<std::uint32_t>     m_Overflow;
+        };
+
+        template<typename B> B Union(const B& lhs, const B& rhs) noexcept {
+            return B {std::min(lhs.MinX, rhs.MinX), std::min(lhs.MinY, rhs.MinY),
+                std::max(lhs.MaxX, rhs.MaxX), std::max(lhs.MaxY, rhs.MaxY)};
+        }
+
+        template<typename B> float Perimeter(const B& bounds) noexcept {
+            return 2.0F * ((bounds.MaxX - bounds.MinX) + (bounds.MaxY - bounds.MinY));
+        }
+
+        template<typename B> bool Contains(const B& outer, const B& inner) noexcept {
+            return outer.MinX <= inner.MinX && outer.MinY <= inner.MinY
+                && inner.MaxX <= outer.MaxX && inner.MaxY <= outer.MaxY;
+        }
+
+        template<typename B> bool Overlaps(const B& lhs, const B& rhs) noexcept {
+            return lhs.MinX <= rhs.MaxX && rhs.MinX <= lhs.MaxX && lhs.MinY <= rhs.MaxY
+                && rhs.MinY <= lhs.MaxY;
+        }
+
+        /// The fraction of the segment where it enters the bounds, if it does before maxFraction
+        template<typename B>
+        std::optional<float> Intersect(
+            const B& bounds, Point2Df origin, Point2Df direction, float maxFraction) noexcept {
+            float       enter    = 0.0F;
+            float       exit     = maxFraction;
+            const float min[2]   = {bounds.MinX, bounds.MinY};
+            const float max[2]   = {bounds.MaxX, bounds.MaxY};
+            const float from[2]  = {origin.X, origin.Y};
+            const float delta[2] = {direction.X, direction.Y};
+            for (int axis = 0; axis < 2; axis++) {
+                if (delta[axis] == 0.0F) {
+                    // Parallel to the slab, it either always or never overlaps on this axis
+                    if (from[axis] < min[axis] || from[axis] > max[axis]) {
+                        return std::nullopt;
+                    }
+                    continue;
+                }
+
+                const float inverse = 1.0F / delta[axis];
+                float       near    = (min[axis] - from[axis]) * inverse;
+                float       far     = (max[axis] - from[axis]) * inverse;
+                if (near > far) {
+                    std::swap(near, far);
+                }
+                enter = std::max(enter, near);
+                exit  = std::min(exit, far);
+                if (enter > exit) {
+                    return std::nullopt;
+                }
+            }
+            return enter;
+        }
+    } // namespace
+
+    std::uint32_t DynamicAABBTree::CreateProxy(const Rect2Df& bounds, std::uint32_t userData) {
+        const std::uint32_t proxy = AllocateNode();
+        Node&               node  = m_Nodes[proxy];
+        node.Tight                = Bounds::FromRect(bounds);
+        node.Fat                  = Fatten(node.Tight);
+        node.UserData             = userData;
+        InsertLeaf(proxy);
+        m_ProxyCount++;
+        return proxy;
+    }
+
+    void DynamicAABBTree::DestroyProxy(std::uint32_t proxy) {
+        ASTRELIS_CORE_ASSERT(
+            proxy < m_Nodes.size() && m_Nodes[proxy].Height == 0, "Invalid proxy");
+        RemoveLeaf(proxy);
+        FreeNode(proxy);
+        m_ProxyCount--;
+    }
+
+    bool DynamicAABBTree::MoveProxy(
+        std::uint32_t proxy, const Rect2Df& bounds, Vec2f displacement) {
+        ASTRELIS_CORE_ASSERT(
+            proxy < m_Nodes.size() && m_Nodes[proxy].Height == 0, "Invalid proxy");
+        Node& node = m_Nodes[proxy];
+        node.Tight = Bounds::FromRect(bounds);
+        if (Contains(node.Fat, node.Tight)) {
+            return false;
+        }
+
+        RemoveLeaf(proxy);
+
+        // Extending in the direction of motion predicts where the object will be in the next updates
+        constexpr float DISPLACEMENT_MULTIPLIER = 2.0F;
+        const float     moveX                   = displacement[0] * DISPLACEMENT_MULTIPLIER;
+        const float     moveY                   = displacement[1] * DISPLACEMENT_MULTIPLIER;
+        node.Fat = Fatten(node.Tight);
+        if (moveX < 0.0F) {
+            node.Fat.MinX += moveX;
+        }
+        else {
+            node.Fat.MaxX += moveX;
+        }
+        if (moveY < 0.0F) {
+            node.Fat.MinY += moveY;
+        }
+        else {
+            node.Fat.MaxY += moveY;
+        }
+
+        InsertLeaf(proxy);
+        return true;
+    }
+
+    void DynamicAABBTree::Clear() {
+        m_Nodes.clear();
+        m_Root       = NULL_NODE;
+        m_FreeList   = NULL_NODE;
+        m_ProxyCount = 0;
+    }
+
+    std::span<const std::uint32_t> DynamicAABBTree::QueryRect(
+        const Rect2Df& rect, std::vector<std::uint32_t>& results) const {
+        results.clear();
+        const Bounds query = Bounds::FromRect(rect);
+        NodeStack    stack;
+        stack.Push(m_Root);
+        while (!stack.IsEmpty()) {
+            const std::uint32_t index = stack.Pop();
+            if (index == NULL_NODE || !Overlaps(m_Nodes[index].Fat, query)) {
+                continue;
+            }
+
+            const Node& node = m_Nodes[index];
+            if (node.IsLeaf()) {
+                if (Overlaps(node.Tight, query)) {
+                    results.push_back(index);
+                }
+                continue;
+            }
+
+            stack.Push(node.Child1);
+            stack.Push(node.Child2);
+        }
+        return results;
+    }
+
+    std::span<const std::uint32_t> DynamicAABBTree::QueryPoint(
+        Point2Df point, std::vector<std::uint32_t>& results) const {
+        return QueryRect(Rect2Df(point, Dimension2Df(0.0F, 0.0F)), results);
+    }
+
+    std::optional<RayCastHit> DynamicAABBTree::RayCast(Point2Df origin, Point2Df target) const {
+        const Point2Df            direction(target.X - origin.X, target.Y - origin.Y);
+        std::optional<RayCastHit> closest;
+        float                     maxFraction = 1.0F;
+
+        NodeStack stack;
+        stack.Push(m_Root);
+        while (!stack.IsEmpty()) {
+            const std::uint32_t index = stack.Pop();
+            if (index == NULL_NODE
+                || !Intersect(m_Nodes[index].Fat, origin, direction, maxFraction)) {
+                continue;
+            }
+
+            const Node& node = m_Nodes[index];
+            if (node.IsLeaf()) {
+                // Hits further away than the closest one are already rejected by maxFraction
+                if (auto fraction = Intersect(node.Tight, origin, direction, maxFraction)) {
+                    maxFraction = *fraction;
+                    closest     = RayCastHit {index, *fraction};
+                }
+                continue;
+            }
+
+            stack.Push(node.Child1);
+            stack.Push(node.Child2);
+        }
+        return closest;
+    }
+
+    DynamicAABBTree::Bounds DynamicAABBTree::Fatten(const Bounds& bounds) const noexcept {
+        return Bounds {bounds.MinX - m_Margin, bounds.MinY - m_Margin, bounds.MaxX + m_Margin,
+            bounds.MaxY + m_Margin};
+    }
+
+    std::uint32_t DynamicAABBTree::AllocateNode() {
+        if (m_FreeList == NULL_NODE) {
+            m_Nodes.emplace_back();
+            return static_cast<std::uint32_t>(m_Nodes.size() - 1);
+        }
+
+        const std::uint32_t node = m_FreeList;
+        m_FreeList               = m_Nodes[node].Parent;
+        m_Nodes[node]            = Node {};
+        return node;
+    }
+
+    void DynamicAABBTree::FreeNode(std::uint32_t node) {
+        m_Nodes[node].Parent = m_FreeList;
+        m_Nodes[node].Height = -1;
+        m_FreeList           = node;
+    }
+
+    void DynamicAABBTree::InsertLeaf(std::uint32_t leaf) {
+        if (m_Root == NULL_NODE) {
+            m_Root               = leaf;
+            m_Nodes[leaf].Parent = NULL_NODE;
+            return;
+        }
+
+        // Descends towards the sibling with the lowest surface area heuristic cost, the cost of a node is
+        // the perimeter of the new parent plus the growth it causes in every ancestor
+        const Bounds  leafBounds = m_Nodes[leaf].Fat;
+        std::uint32_t index      = m_Root;
+        while (!m_Nodes[index].IsLeaf()) {
+            const Node& node        = m_Nodes[index];
+            const float area        = Perimeter(node.Fat);
+            const float combined    = Perimeter(Union(node.Fat, leafBounds));
+            const float cost        = 2.0F * combined;
+            const float inheritance = 2.0F * (combined - area);
+
+            const auto descendCost = [this, &leafBounds, inheritance](std::uint32_t child) {
+                const Node& childNode = m_Nodes[child];
+                const float perimeter = Perimeter(Union(childNode.Fat, leafBounds));
+                return (childNode.IsLeaf() ? perimeter : perimeter - Perimeter(childNode.Fat))
+                    + inheritance;
+            };
+            const float cost1 = descendCost(node.Child1);
+            const float cost2 = descendCost(node.Child2);
+            if (cost < cost1 && cost < cost2) {
+                break;
+            }
+            index = cost1 < cost2 ? node.Child1 : node.Child2;
+        }
+
+        const std::uint32_t sibling   = index;
+        const std::uint32_t oldParent = m_Nodes[sibling].Parent;
+        const std::uint32_t newParent = AllocateNode();
+        Node&               parent    = m_Nodes[newParent];
+        parent.Parent                 = oldParent;
+        parent.Fat                    = Union(leafBounds, m_Nodes[sibling].Fat);
+        parent.Height                 = m_Nodes[sibling].Height + 1;
+        parent.Child1                 = sibling;
+        parent.Child2                 = leaf;
+        m_Nodes[sibling].Parent       = newParent;
+        m_Nodes[leaf].Parent          = newParent;
+
+        if (oldParent == NULL_NODE) {
+            m_Root = newParent;
+        }
+        else {
+            ReplaceChild(oldParent, sibling, newParent);
+        }
+
+        Refit(m_Nodes[leaf].Parent);
+    }
+
+    void DynamicAABBTree::RemoveLeaf(std::uint32_t leaf) {
+        if (leaf == m_Root) {
+            m_Root = NULL_NODE;
+            return;
+        }
+
+        const std::uint32_t parent      = m_Nodes[leaf].Parent;
+        const std::uint32_t grandParent = m_Nodes[parent].Parent;
+        const std::uint32_t sibling =
+            m_Nodes[parent].Child1 == leaf ? m_Nodes[parent].Child2 : m_Nodes[parent].Child1;
+        FreeNode(parent);
+
+        m_Nodes[sibling].Parent = grandParent;
+        if (grandParent == NULL_NODE) {
+            m_Root = sibling;
+            return;
+        }
+
+        ReplaceChild(grandParent, parent, sibling);
+        Refit(grandParent);
+    }
+
+    void DynamicAABBTree::Refit(std::uint32_t node) {
+        std::uint32_t index = node;
+        while (index != NULL_NODE) {
+            index      = Balance(index);
+            Node& self = m_Nodes[index];
+            self.Height =
+                1 + std::max(m_Nodes[self.Child1].Height, m_Nodes[self.Child2].Height);
+            self.Fat = Union(m_Nodes[self.Child1].Fat, m_Nodes[self.Child2].Fat);
+            index    = self.Parent;
+        }
+    }
+
+    std::uint32_t DynamicAABBTree::Balance(std::uint32_t node) {
+        const Node& self = m_Nodes[node];
+        if (self.IsLeaf() || self.Height < 2) {
+            return node;
+        }
+
+        // Rotates the taller child up, which takes the place of the node, and the node takes the shorter
+        // grandchild of that child. This is the rotation of an AVL tree, applied while refitting.
+        const auto rotateUp = [this, node](std::uint32_t up, std::uint32_t other, bool upIsChild1) {
+            Node&               lowered = m_Nodes[node];
+            Node&               raised  = m_Nodes[up];
+            const std::uint32_t first   = raised.Child1;
+            const std::uint32_t second  = raised.Child2;
+
+            raised.Child1  = node;
+            raised.Parent  = lowered.Parent;
+            lowered.Parent = up;
+            if (raised.Parent == NULL_NODE) {
+                m_Root = up;
+            }
+            else {
+                ReplaceChild(raised.Parent, node, up);
+            }
+
+            const bool          keepFirst = m_Nodes[first].Height > m_Nodes[second].Height;
+            const std::uint32_t kept      = keepFirst ? first : second;
+            const std::uint32_t moved     = keepFirst ? second : first;
+            raised.Child2                 = kept;
+            if (upIsChild1) {
+                lowered.Child1 = moved;
+            }
+            else {
+                lowered.Child2 = moved;
+            }
+            m_Nodes[moved].Parent = node;
+
+            lowered.Fat    = Union(m_Nodes[other].Fat, m_Nodes[moved].Fat);
+            lowered.Height = 1 + std::max(m_Nodes[other].Height, m_Nodes[moved].Height);
+            raised.Fat     = Union(lowered.Fat, m_Nodes[kept].Fat);
+            raised.Height  = 1 + std::max(lowered.Height, m_Nodes[kept].Height);
+            return up;
+        };
+
+        const std::uint32_t child1  = self.Child1;
+        const std::uint32_t child2  = self.Child2;
+        const std::int32_t  balance = m_Nodes[child2].Height - m_Nodes[child1].Height;
+        if (balance > 1) {
+            return rotateUp(child2, child1, false);
+        }
+        if (balance < -1) {
+            return rotateUp(child1, child2, true);
+        }
+        return node;
+    }
+
+    void DynamicAABBTree::ReplaceChild(
+        std::uint32_t parent, std::uint32_t oldChild, std::uint32_t newChild) {
+        Node& node = m_Nodes[parent];
+        if (node.Child1 == oldChild) {
+            node.Child1 = newChild;
+        }
+        else {
+            node.Child2 = newChild;
+        }
+    }
+} // namespace Astrelis
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "Astrelis/Core/Geometry.hpp"
+#include "Astrelis/Core/Math.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace Astrelis {
+    /// @brief The closest proxy hit by DynamicAABBTree::RayCast
+    struct RayCastHit {
+        std::uint32_t Proxy;
+        /// @brief Where along the ray the bounds are entered, 0 at the origin and 1 at the target
+        float Fraction;
+    };
+
+    /**
+    * @brief A bounding volume hierarchy over rectangles that can be updated incrementally
+    * Every proxy is a leaf, inner nodes hold the union of their children. Leaves store fat bounds, the bounds
+    * enlarged by a margin and the last displacement, so objects that move a little do not change the tree at all.
+    * Inserting picks the sibling with the lowest surface area cost, and the tree is kept balanced with AVL style
+    * rotations on the way back up. Unlike SpatialHashGrid this does not depend on a cell size, so it handles sparse
+    * worlds and objects of very different sizes.
+    *
+    * Queries test the exact bounds at the leaves, they are used for viewport culling, picking and overlap tests.
+    */
+    class DynamicAABBTree {
+    public:
+        static constexpr std::uint32_t NULL_NODE = std::numeric_limits<std::uint32_t>::max();
+
+        /// @param margin How much the fat bounds extend past the bounds on every side
+        explicit DynamicAABBTree(float margin = 0.1F) : m_Margin(margin) {
+        }
+
+        /// @return The proxy id, which stays the same until the proxy is destroyed
+        std::uint32_t CreateProxy(const Rect2Df& bounds, std::uint32_t userData);
+        void          DestroyProxy(std::uint32_t proxy);
+        /**
+        * @brief Updates the bounds of a proxy, which is only reinserted if they left its fat bounds
+        * @param displacement The movement since the last update, the fat bounds are extended in that direction
+        * @return true if the proxy was reinserted
+        */
+        bool MoveProxy(
+            std::uint32_t proxy, const Rect2Df& bounds, Vec2f displacement = Vec2f(0.0F));
+        void Clear();
+
+        [[nodiscard]] std::uint32_t GetUserData(std::uint32_t proxy) const {
+            return m_Nodes[proxy].UserData;
+        }
+
+        [[nodiscard]] Rect2Df GetFatBounds(std::uint32_t proxy) const {
+            return m_Nodes[proxy].Fat.ToRect();
+        }
+
+        [[nodiscard]] std::size_t GetProxyCount() const noexcept {
+            return m_ProxyCount;
+        }
+
+        /// @brief The number of edges from the root to the deepest leaf, 0 for a single proxy
+        [[nodiscard]] std::int32_t GetHeight() const noexcept {
+            return m_Root == NULL_NODE ? 0 : m_Nodes[m_Root].Height;
+        }
+
+        /**
+        * @brief Finds the proxies whose bounds overlap the rectangle, touching edges count as overlapping
+        * The proxy ids are written to the results buffer, which is cleared first and keeps its capacity.
+        */
+        std::span<const std::uint32_t> QueryRect(
+            const Rect2Df& rect, std::vector<std::uint32_t>& results) const;
+        /// @brief Finds the proxies whose bounds contain the point, @see QueryRect
+        std::span<const std::uint32_t> QueryPoint(
+            Point2Df point, std::vector<std::uint32_t>& results) const;
+        /// @brief Finds the first proxy hit by the segment from the origin to the target
+        [[nodiscard]] std::optional<RayCastHit> RayCast(Point2Df origin, Point2Df target) const;
+    private:
+        struct Bounds {
+            float MinX;
+            float MinY;
+            float MaxX;
+            float MaxY;
+
+            static Bounds FromRect(const Rect2Df& rect) noexcept {
+                return Bounds {
+                    rect.X(), rect.Y(), rect.X() + rect.Width(), rect.Y() + rect.Height()};
+            }
+
+            [[nodiscard]] Rect2Df ToRect() const noexcept {
+                return Rect2Df(MinX, MinY, MaxX - MinX, MaxY - MinY);
+            }
+        };
+
+        struct Node {
+            Bounds Fat;
+            // The exact bounds, only used by leaves
+            Bounds Tight;
+            // The next free node while the node is on the free list
+            std::uint32_t Parent   = NULL_NODE;
+            std::uint32_t Child1   = NULL_NODE;
+            std::uint32_t Child2   = NULL_NODE;
+            std::uint32_t UserData = 0;
+            // 0 for leaves, -1 for free nodes
+            std::int32_t Height = 0;
+
+            [[nodiscard]] bool IsLeaf() const noexcept {
+                return Child1 == NULL_NODE;
+            }
+        };
+
+        [[nodiscard]] Bounds Fatten(const Bounds& bounds) const noexcept;
+
+        std::uint32_t AllocateNode();
+        void          FreeNode(std::uint32_t node);
+        void          InsertLeaf(std::uint32_t leaf);
+        void          RemoveLeaf(std::uint32_t leaf);
+        /// @brief Walks from the node to the root, rebalancing and refitting every ancestor
+        void          Refit(std::uint32_t node);
+        std::uint32_t Balance(std::uint32_t node);
+        void ReplaceChild(std::uint32_t parent, std::uint32_t oldChild, std::uint32_t newChild);
+
+        std::vector<Node> m_Nodes;
+        std::uint32_t     m_Root       = NULL_NODE;
+        std::uint32_t     m_FreeList   = NULL_NODE;
+        std::size_t       m_ProxyCount = 0;
+        float             m_Margin;
+    };
+} // namespace Astrelis
@@ -0,0 +1,198 @@
+#include "ParticleEmitter.hpp"
+
+#include "Astrelis/Core/Base.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define ASTRELIS_PARTICLE_SSE 1
+    #include <xmmintrin.h>
+#else
+    #define ASTRELIS_PARTICLE_SSE 0
+#endif
+
+namespace Astrelis {
+    namespace {
+        // Keeps particles with a lifetime of zero from dividing by zero, they die in their first update
+        constexpr float MIN_LIFETIME = 1.0e-4F;
+    } // namespace
+
+    ParticleEmitter::ParticleEmitter(const ParticleEmitterProps& props)
+        : m_Props(props), m_Random(props.Seed) {
+        m_PositionX.reserve(props.MaxParticles);
+        m_PositionY.reserve(props.MaxParticles);
+        m_VelocityX.reserve(props.MaxParticles);
+        m_VelocityY.reserve(props.MaxParticles);
+        m_Age.reserve(props.MaxParticles);
+        m_AgeRate.reserve(props.MaxParticles);
+    }
+
+    void ParticleEmitter::Emit(std::uint32_t count) {
+        ASTRELIS_PROFILE_FUNCTION();
+        const std::size_t emitted =
+            std::min<std::size_t>(count, m_Props.MaxParticles - GetParticleCount());
+
+        std::uniform_real_distribution<float> unit(0.0F, 1.0F);
+        const auto random = [this, &unit](float min, float max) {
+            return min + (max - min) * unit(m_Random);
+        };
+        for (std::size_t i = 0; i < emitted; i++) {
+            const float lifetime = random(m_Props.MinLifetime, m_Props.MaxLifetime);
+            m_PositionX.push_back(m_Props.Position[0]);
+            m_PositionY.push_back(m_Props.Position[1]);
+            m_VelocityX.push_back(random(m_Props.MinVelocity[0], m_Props.MaxVelocity[0]));
+            m_VelocityY.push_back(random(m_Props.MinVelocity[1], m_Props.MaxVelocity[1]));
+            m_Age.push_back(0.0F);
+            m_AgeRate.push_back(1.0F / std::max(lifetime, MIN_LIFETIME));
+        }
+    }
+
+    void ParticleEmitter::Update(float deltaTime) {
+        ASTRELIS_PROFILE_FUNCTION();
+        const std::size_t count = GetParticleCount();
+        // Implicit drag, which cannot overshoot and reverse the velocity at large time steps
+        const float damping       = 1.0F / (1.0F + m_Props.Drag * deltaTime);
+        const float accelerationX = m_Props.Acceleration[0] * deltaTime;
+        const float accelerationY = m_Props.Acceleration[1] * deltaTime;
+
+        bool        anyDead  = false;
+        std::size_t particle = 0;
+#if ASTRELIS_PARTICLE_SSE
+        const __m128 dampingX4      = _mm_set1_ps(damping);
+        const __m128 accelerationX4 = _mm_set1_ps(accelerationX);
+        const __m128 accelerationY4 = _mm_set1_ps(accelerationY);
+        const __m128 deltaTimeX4    = _mm_set1_ps(deltaTime);
+        const __m128 one            = _mm_set1_ps(1.0F);
+        int          deadLanes      = 0;
+        for (; particle + 4 <= count; particle += 4) {
+            const __m128 velocityX = _mm_mul_ps(
+                _mm_add_ps(_mm_loadu_ps(&m_VelocityX[particle]), accelerationX4), dampingX4);
+            const __m128 velocityY = _mm_mul_ps(
+                _mm_add_ps(_mm_loadu_ps(&m_VelocityY[particle]), accelerationY4), dampingX4);
+            const __m128 positionX = _mm_add_ps(
+                _mm_loadu_ps(&m_PositionX[particle]), _mm_mul_ps(velocityX, deltaTimeX4));
+            const __m128 positionY = _mm_add_ps(
+                _mm_loadu_ps(&m_PositionY[particle]), _mm_mul_ps(velocityY, deltaTimeX4));
+            const __m128 age = _mm_add_ps(_mm_loadu_ps(&m_Age[particle]),
+                _mm_mul_ps(_mm_loadu_ps(&m_AgeRate[particle]), deltaTimeX4));
+
+            _mm_storeu_ps(&m_VelocityX[particle], velocityX);
+            _mm_storeu_ps(&m_VelocityY[particle], velocityY);
+            _mm_storeu_ps(&m_PositionX[particle], positionX);
+            _mm_storeu_ps(&m_PositionY[particle], positionY);
+            _mm_storeu_ps(&m_Age[particle], age);
+            deadLanes |= _mm_movemask_ps(_mm_cmpge_ps(age, one));
+        }
+        anyDead = deadLanes != 0;
+#endif
+
+        // The particles that do not fill a batch
+        for (; particle < count; particle++) {
+            m_VelocityX[particle] = (m_VelocityX[particle] + accelerationX) * damping;
+            m_VelocityY[particle] = (m_VelocityY[particle] + accelerationY) * damping;
+            m_PositionX[particle] += m_VelocityX[particle] * deltaTime;
+            m_PositionY[particle] += m_VelocityY[particle] * deltaTime;
+            m_Age[particle] += m_AgeRate[particle] * deltaTime;
+            anyDead = anyDead || m_Age[particle] >= 1.0F;
+        }
+
+        if (anyDead) {
+            RemoveDead();
+        }
+
+        if (!m_Emitting) {
+            m_EmitRemainder = 0.0F;
+            return;
+        }
+        m_EmitRemainder += m_Props.EmissionRate * deltaTime;
+        const float emitted = std::floor(m_EmitRemainder);
+        m_EmitRemainder -= emitted;
+        Emit(static_cast<std::uint32_t>(emitted));
+    }
+
+    void ParticleEmitter::RemoveDead() {
+        ASTRELIS_PROFILE_FUNCTION();
+        std::size_t count = GetParticleCount();
+        for (std::size_t particle = 0; particle < count;) {
+            if (m_Age[particle] < 1.0F) {
+                particle++;
+                continue;
+            }
+
+            // The last particle is checked again in its new slot
+            count--;
+            m_PositionX[particle] = m_PositionX[count];
+            m_PositionY[particle] = m_PositionY[count];
+            m_VelocityX[particle] = m_VelocityX[count];
+            m_VelocityY[particle] = m_VelocityY[count];
+            m_Age[particle]       = m_Age[count];
+            m_AgeRate[particle]   = m_AgeRate[count];
+        }
+
+        m_PositionX.resize(count);
+        m_PositionY.resize(count);
+        m_VelocityX.resize(count);
+        m_VelocityY.resize(count);
+        m_Age.resize(count);
+        m_AgeRate.resize(count);
+    }
+
+    void ParticleEmitter::Clear() {
+        m_PositionX.clear();
+        m_PositionY.clear();
+        m_VelocityX.clear();
+        m_VelocityY.clear();
+        m_Age.clear();
+        m_AgeRate.clear();
+        m_EmitRemainder = 0.0F;
+    }
+
+    std::size_t ParticleEmitter::WriteInstances(std::span<InstanceData> instances) const {
+        ASTRELIS_PROFILE_FUNCTION();
+        const std::size_t count = std::min(instances.size(), GetParticleCount());
+
+        const float sizeChange = m_Props.EndSize - m_Props.StartSize;
+        const Vec3f colorChange(m_Props.EndColor[0] - m_Props.StartColor[0],
+            m_Props.EndColor[1] - m_Props.StartColor[1],
+            m_Props.EndColor[2] - m_Props.StartColor[2]);
+        for (std::size_t particle = 0; particle < count; particle++) {
+            const float age  = m_Age[particle];
+            const float size = m_Props.StartSize + sizeChange * age;
+
+            // Every element is written, the matrix is only scale and translation
+            InstanceData& instance = instances[particle];
+            float*        matrix   = &instance.Transform.GetGLMMatrix()[0][0];
+#if ASTRELIS_PARTICLE_SSE
+            _mm_storeu_ps(matrix, _mm_set_ps(0.0F, 0.0F, 0.0F, size));
+            _mm_storeu_ps(matrix + 4, _mm_set_ps(0.0F, 0.0F, size, 0.0F));
+            _mm_storeu_ps(matrix + 8, _mm_set_ps(0.0F, 1.0F, 0.0F, 0.0F));
+            _mm_storeu_ps(matrix + 12,
+                _mm_set_ps(1.0F, m_Props.Depth, m_PositionY[particle], m_PositionX[particle]));
+#else
+            instance.Transform.GetGLMMatrix() = glm::mat4(1.0F);
+            matrix[0]                         = size;
+            matrix[5]                         = size;
+            matrix[12]                        = m_PositionX[particle];
+            matrix[13]                        = m_PositionY[particle];
+            matrix[14]                        = m_Props.Depth;
+#endif
+            instance.Color     = Vec3f(m_Props.StartColor[0] + colorChange[0] * age,
+                m_Props.StartColor[1] + colorChange[1] * age,
+                m_Props.StartColor[2] + colorChange[2] * age);
+            instance.TexCoords = Vec4f(0.0F, 0.0F, 1.0F, 1.0F);
+        }
+        return count;
+    }
+
+    void ParticleEmitter::Render(Renderer2D& renderer, const Mesh2D& quad) const {
+        ASTRELIS_PROFILE_FUNCTION();
+        if (m_PositionX.empty()) {
+            return;
+        }
+
+        // The renderer grows its instance buffer to fit, so every particle is drawn
+        std::span<InstanceData> instances = renderer.AllocateInstances(GetParticleCount());
+        renderer.SubmitAllocatedInstances(quad, instances.first(WriteInstances(instances)));
+    }
+} // namespace Astrelis
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Astrelis/Core/Math.hpp"
+#include "Astrelis/Renderer/Mesh.hpp"
+#include "Astrelis/Renderer/Renderer2D.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace Astrelis {
+    struct ParticleEmitterProps {
+        std::uint32_t MaxParticles = 10'000;
+        /// @brief Particles emitted per second while the emitter is emitting
+        float         EmissionRate = 1'000.0F;
+        Vec2f         Position     = Vec2f(0.0F);
+        /// @brief Every particle starts with a random velocity between the two
+        Vec2f MinVelocity  = Vec2f(-1.0F, 1.0F);
+        Vec2f MaxVelocity  = Vec2f(1.0F, 3.0F);
+        Vec2f Acceleration = Vec2f(0.0F, -9.81F);
+        /// @brief The fraction of the velocity that is lost every second
+        float Drag        = 0.0F;
+        float MinLifetime = 1.0F;
+        float MaxLifetime = 2.0F;
+        /// @brief The size and color are interpolated over the lifetime of a particle
+        float         StartSize  = 0.1F;
+        float         EndSize    = 0.0F;
+        Vec3f         StartColor = Vec3f(1.0F);
+        Vec3f         EndColor   = Vec3f(1.0F);
+        float         Depth      = 0.0F;
+        std::uint32_t Seed       = 1;
+    };
+
+    /**
+    * @brief Simulates particles on the CPU and draws them as instances of a quad
+    * The particles are stored as structure of arrays and Update moves four of them at a time with SSE. Dead
+    * particles are removed by moving the last particle into their slot, so the live particles always fill the
+    * front of the arrays and the order of particles is not stable.
+    *
+    * Render writes the live particles straight into the instance memory of the renderer, one draw call per
+    * emitter, so no instance list is built in between.
+    */
+    class ParticleEmitter {
+    public:
+        explicit ParticleEmitter(const ParticleEmitterProps& props = ParticleEmitterProps());
+
+        /// @brief Emits count particles at once, as many as fit below MaxParticles
+        void Emit(std::uint32_t count);
+        /// @brief Moves and ages the particles, removes the dead ones and emits new ones at the emission rate
+        void Update(float deltaTime);
+        void Clear();
+
+        /// @brief Writes one instance per live particle, until the instances are full
+        /// @return The number of instances written
+        std::size_t WriteInstances(std::span<InstanceData> instances) const;
+        void Render(Renderer2D& renderer, const Mesh2D& quad) const;
+
+        void SetPosition(Vec2f position) {
+            m_Props.Position = position;
+        }
+
+        void SetEmitting(bool emitting) {
+            m_Emitting = emitting;
+        }
+
+        [[nodiscard]] bool IsEmitting() const noexcept {
+            return m_Emitting;
+        }
+
+        [[nodiscard]] std::size_t GetParticleCount() const noexcept {
+            return m_PositionX.size();
+        }
+
+        [[nodiscard]] Vec2f GetParticlePosition(std::size_t particle) const {
+            return Vec2f(m_PositionX[particle], m_PositionY[particle]);
+        }
+
+        [[nodiscard]] Vec2f GetParticleVelocity(std::size_t particle) const {
+            return Vec2f(m_VelocityX[particle], m_VelocityY[particle]);
+        }
+
+        /// @brief How far the particle is through its lifetime, from 0 to 1
+        [[nodiscard]] float GetParticleAge(std::size_t particle) const {
+            return m_Age[particle];
+        }
+
+        [[nodiscard]] const ParticleEmitterProps& GetProps() const noexcept {
+            return m_Props;
+        }
+    private:
+        void RemoveDead();
+
+        ParticleEmitterProps m_Props;
+        std::minstd_rand     m_Random;
+        bool                 m_Emitting = true;
+        // The fraction of a particle that the emission rate did not emit yet
+        float m_EmitRemainder = 0.0F;
+
+        std::vector<float> m_PositionX;
+        std::vector<float> m_PositionY;
+        std::vector<float> m_VelocityX;
+        std::vector<float> m_VelocityY;
+        std::vector<float> m_Age;
+        // The inverse of the lifetime, the age advances by it every second
+        std::vector<float> m_AgeRate;
+    };
+} // namespace Astrelis
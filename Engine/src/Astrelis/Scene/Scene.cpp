@@ -0,0 +1,70 @@
+#include "Scene.hpp"
+
+#include "Astrelis/Core/Base.hpp"
+
+namespace Astrelis {
+    Entity Scene::CreateEntity(std::string name) {
+        Entity entity(m_Registry.create(), this);
+        entity.AddComponent<Tag>(std::move(name));
+        entity.AddComponent<Transform2D>();
+        return entity;
+    }
+
+    void Scene::DestroyEntity(Entity entity) {
+        ASTRELIS_CORE_ASSERT(entity.IsValid(), "Destroying an entity that does not exist");
+        RemoveFromSpatialGrid(entity.GetHandle());
+        m_Registry.destroy(entity.GetHandle());
+    }
+
+    void Scene::Clear() {
+        m_Registry.clear();
+        m_SpatialGrid.Clear();
+        m_SpatialEntities.clear();
+    }
+
+    std::size_t Scene::GetEntityCount() const {
+        // Every entity created through the scene has a tag
+        return m_Registry.view<const Tag>().size();
+    }
+
+    void Scene::UpdateSpatialGrid() {
+        ASTRELIS_PROFILE_FUNCTION();
+        // Entities destroyed through the registry or without a transform anymore leave the grid first,
+        // so a recycled index is inserted again for its new entity
+        for (entt::entity handle : m_SpatialEntities) {
+            if (handle != entt::null
+                && !(m_Registry.valid(handle) && m_Registry.all_of<Transform2D>(handle))) {
+                RemoveFromSpatialGrid(handle);
+            }
+        }
+
+        m_Registry.view<const Transform2D>().each(
+            [this](entt::entity handle, const Transform2D& transform) {
+                const auto     id = static_cast<std::uint32_t>(entt::to_entity(handle));
+                const Point2Df position(transform.Position[0], transform.Position[1]);
+                if (m_SpatialGrid.Contains(id)) {
+                    m_SpatialGrid.Move(id, position);
+                    return;
+                }
+
+                if (id >= m_SpatialEntities.size()) {
+                    m_SpatialEntities.resize(id + 1, entt::null);
+                }
+                m_SpatialEntities[id] = handle;
+                m_SpatialGrid.Insert(id, position);
+            });
+    }
+
+    Entity Scene::GetSpatialEntity(std::uint32_t id) {
+        ASTRELIS_CORE_ASSERT(m_SpatialGrid.Contains(id), "The id is not in the spatial grid");
+        return Entity(m_SpatialEntities[id], this);
+    }
+
+    void Scene::RemoveFromSpatialGrid(entt::entity handle) {
+        const auto id = static_cast<std::uint32_t>(entt::to_entity(handle));
+        if (id < m_SpatialEntities.size() && m_SpatialEntities[id] == handle) {
+            m_SpatialGrid.Remove(id);
+            m_SpatialEntities[id] = entt::null;
+        }
+    }
+} // namespace Astrelis
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <entt/entt.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Components.hpp"
+#include "SpatialHashGrid.hpp"
+
+namespace Astrelis {
+    class Entity;
+
+    /**
+    * @brief A set of entities and their components, stored in an EnTT registry
+    * Components are kept in contiguous pools per type, so systems iterate them through views instead of visiting
+    * entities one by one, @see SpriteRenderSystem.
+    *
+    * The scene also keeps a spatial grid of the Transform2D positions, for finding the entities near a point. It
+    * is brought up to date by UpdateSpatialGrid, and the query results are entity indices, @see GetSpatialEntity.
+    */
+    class Scene {
+    public:
+        Scene()                        = default;
+        ~Scene()                       = default;
+        Scene(const Scene&)            = delete;
+        Scene& operator=(const Scene&) = delete;
+        Scene(Scene&&)                 = default;
+        Scene& operator=(Scene&&)      = default;
+
+        /// @brief Creates an entity with a Tag and a Transform2D
+        Entity CreateEntity(std::string name = "Entity");
+        void   DestroyEntity(Entity entity);
+        void   Clear();
+
+        [[nodiscard]] std::size_t GetEntityCount() const;
+
+        /**
+        * @brief Brings the spatial grid up to date with the Transform2D positions
+        * Entities are only relinked when they crossed into another cell, and entities that were destroyed or lost
+        * their transform leave the grid. Call it after the systems that move entities and before querying.
+        */
+        void UpdateSpatialGrid();
+
+        [[nodiscard]] const SpatialHashGrid& GetSpatialGrid() const noexcept {
+            return m_SpatialGrid;
+        }
+
+        /// @brief The entity of an id returned by a spatial grid query
+        [[nodiscard]] Entity GetSpatialEntity(std::uint32_t id);
+
+        template<typename... Components> [[nodiscard]] auto View() {
+            return m_Registry.view<Components...>();
+        }
+
+        [[nodiscard]] entt::registry& GetRegistry() {
+            return m_Registry;
+        }
+
+        [[nodiscard]] const entt::registry& GetRegistry() const {
+            return m_Registry;
+        }
+    private:
+        void RemoveFromSpatialGrid(entt::entity handle);
+
+        entt::registry  m_Registry;
+        SpatialHashGrid m_SpatialGrid;
+        // The entity in the spatial grid for each entity index, null for indices not in the grid
+        std::vector<entt::entity> m_SpatialEntities;
+    };
+
+    /// @brief A lightweight reference to an entity of a scene, it does not own the entity
+    class Entity {
+    public:
+        Entity() = default;
+
+        Entity(entt::entity handle, Scene* scene) : m_Handle(handle), m_Scene(scene) {
+        }
+
+        template<typename T, typename... Args> T& AddComponent(Args&&... args) {
+            return m_Scene->GetRegistry().emplace<T>(m_Handle, std::forward<Args>(args)...);
+        }
+
+        template<typename T> [[nodiscard]] T& GetComponent() const {
+            return m_Scene->GetRegistry().get<T>(m_Handle);
+        }
+
+        template<typename T> [[nodiscard]] bool HasComponent() const {
+            return m_Scene->GetRegistry().all_of<T>(m_Handle);
+        }
+
+        template<typename T> void RemoveComponent() {
+            m_Scene->GetRegistry().remove<T>(m_Handle);
+        }
+
+        /// @brief Whether the entity exists, false for default constructed and destroyed entities
+        [[nodiscard]] bool IsValid() const {
+            return m_Scene != nullptr && m_Scene->GetRegistry().valid(m_Handle);
+        }
+
+        [[nodiscard]] entt::entity GetHandle() const noexcept {
+            return m_Handle;
+        }
+
+        bool operator==(const Entity& other) const noexcept = default;
+    private:
+        entt::entity m_Handle = entt::null;
+        Scene*       m_Scene  = nullptr;
+    };
+} // namespace Astrelis
@@ -0,0 +1,177 @@
+#include "SpatialHashGrid.hpp"
+
+#include "Astrelis/Core/Base.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace Astrelis {
+    namespace {
+        // Cell coordinates are clamped well inside the int32 range, so the cell loops can step past
+        // the last cell without overflowing
+        constexpr float MAX_CELL = 1'073'741'824.0F;
+
+        std::int32_t ToCellCoordinate(float value) noexcept {
+            // Casting infinity, NaN or a float past the int32 range is undefined, NaN goes to cell 0
+            if (std::isnan(value)) {
+                return 0;
+            }
+            return static_cast<std::int32_t>(std::clamp(std::floor(value), -MAX_CELL, MAX_CELL));
+        }
+    } // namespace
+
+    SpatialHashGrid::SpatialHashGrid(float cellSize, std::size_t bucketCount)
+        : m_CellSize(cellSize), m_InverseCellSize(1.0F / cellSize),
+          m_BucketObjects(std::bit_ceil(std::max<std::size_t>(bucketCount, 1))) {
+        ASTRELIS_CORE_ASSERT(cellSize > 0.0F, "Cell size has to be positive");
+    }
+
+    void SpatialHashGrid::Insert(std::uint32_t id, Point2Df position) {
+        ASTRELIS_CORE_ASSERT(!Contains(id), "Object is already in the grid");
+        if (id >= m_Buckets.size()) {
+            m_Positions.resize(id + 1);
+            m_Cells.resize(id + 1);
+            m_Buckets.resize(id + 1, INVALID_BUCKET);
+            m_Slots.resize(id + 1);
+        }
+
+        m_Positions[id] = position;
+        Link(id, GetCell(position));
+        m_ObjectCount++;
+    }
+
+    void SpatialHashGrid::Move(std::uint32_t id, Point2Df position) {
+        ASTRELIS_CORE_ASSERT(Contains(id), "Object is not in the grid");
+        m_Positions[id] = position;
+        const Cell cell = GetCell(position);
+        if (cell == m_Cells[id]) {
+            return;
+        }
+
+        Unlink(id);
+        Link(id, cell);
+    }
+
+    void SpatialHashGrid::Remove(std::uint32_t id) {
+        if (!Contains(id)) {
+            return;
+        }
+
+        Unlink(id);
+        m_Buckets[id] = INVALID_BUCKET;
+        m_ObjectCount--;
+    }
+
+    void SpatialHashGrid::Clear() {
+        for (auto& objects : m_BucketObjects) {
+            objects.clear();
+        }
+        m_Positions.clear();
+        m_Cells.clear();
+        m_Buckets.clear();
+        m_Slots.clear();
+        m_ObjectCount = 0;
+    }
+
+    template<typename Fn>
+    void SpatialHashGrid::ForEachInCells(
+        Cell min, Cell max, std::vector<std::uint32_t>& results, Fn&& accept) const {
+        results.clear();
+        const std::int64_t cellCount = (std::int64_t {max.X} - min.X + 1)
+            * (std::int64_t {max.Y} - min.Y + 1);
+
+        if (cellCount >= static_cast<std::int64_t>(m_BucketObjects.size())) {
+            // Every bucket would be visited anyway, so each object is tested once instead
+            for (const auto& objects : m_BucketObjects) {
+                for (std::uint32_t id : objects) {
+                    if (accept(m_Positions[id])) {
+                        results.push_back(id);
+                    }
+                }
+            }
+            return;
+        }
+
+        for (std::int32_t y = min.Y; y <= max.Y; y++) {
+            for (std::int32_t x = min.X; x <= max.X; x++) {
+                const Cell cell {x, y};
+                // Other cells can share the bucket, checking the cell reports every object once
+                for (std::uint32_t id : m_BucketObjects[GetBucket(cell)]) {
+                    if (m_Cells[id] == cell && accept(m_Positions[id])) {
+                        results.push_back(id);
+                    }
+                }
+            }
+        }
+    }
+
+    std::span<const std::uint32_t> SpatialHashGrid::QueryRadius(
+        Point2Df center, float radius, std::vector<std::uint32_t>& results) const {
+        const float radiusSquared = radius * radius;
+        ForEachInCells(GetCell(Point2Df(center.X - radius, center.Y - radius)),
+            GetCell(Point2Df(center.X + radius, center.Y + radius)), results,
+            [center, radiusSquared](Point2Df position) {
+                const float x = position.X - center.X;
+                const float y = position.Y - center.Y;
+                return x * x + y * y <= radiusSquared;
+            });
+        return results;
+    }
+
+    std::span<const std::uint32_t> SpatialHashGrid::QueryRect(
+        const Rect2Df& rect, std::vector<std::uint32_t>& results) const {
+        const Point2Df max(rect.X() + rect.Width(), rect.Y() + rect.Height());
+        ForEachInCells(GetCell(rect.Position), GetCell(max), results,
+            [&rect, max](Point2Df position) {
+                return position.X >= rect.X() && position.Y >= rect.Y() && position.X <= max.X
+                    && position.Y <= max.Y;
+            });
+        return results;
+    }
+
+    void SpatialHashGrid::QueryRadiusBatch(std::span<const Point2Df> centers, float radius,
+        SpatialQueryBatch& batch, JobSystem& jobSystem) const {
+        ASTRELIS_PROFILE_FUNCTION();
+        if (batch.m_Results.size() < centers.size()) {
+            batch.m_Results.resize(centers.size());
+        }
+        batch.m_QueryCount = centers.size();
+
+        jobSystem.ParallelFor(centers.size(), 0,
+            [this, centers, radius, &batch](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; i++) {
+                    QueryRadius(centers[i], radius, batch.m_Results[i]);
+                }
+            });
+    }
+
+    SpatialHashGrid::Cell SpatialHashGrid::GetCell(Point2Df position) const noexcept {
+        return Cell {ToCellCoordinate(position.X * m_InverseCellSize),
+            ToCellCoordinate(position.Y * m_InverseCellSize)};
+    }
+
+    std::uint32_t SpatialHashGrid::GetBucket(Cell cell) const noexcept {
+        // Large primes from the classic spatial hashing paper, the bucket count is a power of two
+        const std::uint32_t hash = (static_cast<std::uint32_t>(cell.X) * 73'856'093U)
+            ^ (static_cast<std::uint32_t>(cell.Y) * 19'349'663U);
+        return hash & static_cast<std::uint32_t>(m_BucketObjects.size() - 1);
+    }
+
+    void SpatialHashGrid::Link(std::uint32_t id, Cell cell) {
+        const std::uint32_t bucket  = GetBucket(cell);
+        auto&               objects = m_BucketObjects[bucket];
+        m_Cells[id]                 = cell;
+        m_Buckets[id]               = bucket;
+        m_Slots[id]                 = static_cast<std::uint32_t>(objects.size());
+        objects.push_back(id);
+    }
+
+    void SpatialHashGrid::Unlink(std::uint32_t id) {
+        auto&               objects = m_BucketObjects[m_Buckets[id]];
+        const std::uint32_t slot    = m_Slots[id];
+        objects[slot]               = objects.back();
+        m_Slots[objects[slot]]      = slot;
+        objects.pop_back();
+    }
+} // namespace Astrelis
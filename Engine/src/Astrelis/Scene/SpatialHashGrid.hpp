@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Astrelis/Core/Geometry.hpp"
+#include "Astrelis/Core/Jobs/JobSystem.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace Astrelis {
+    /// @brief The results of SpatialHashGrid::QueryRadiusBatch, one list of objects per query
+    /// The lists keep their capacity, so reusing the same batch every frame stops allocating once it is warm.
+    class SpatialQueryBatch {
+    public:
+        [[nodiscard]] std::size_t GetQueryCount() const noexcept {
+            return m_QueryCount;
+        }
+
+        [[nodiscard]] std::span<const std::uint32_t> Get(std::size_t query) const {
+            return m_Results[query];
+        }
+    private:
+        friend class SpatialHashGrid;
+
+        std::vector<std::vector<std::uint32_t>> m_Results;
+        std::size_t                             m_QueryCount = 0;
+    };
+
+    /**
+    * @brief A uniform grid over 2D positions, for finding the objects near a point without visiting every object
+    * Cells are not stored, the cell coordinates are hashed into a fixed number of buckets, so the grid covers an
+    * unbounded world with memory proportional to the object count. Objects are identified by an id chosen by the
+    * caller, ids index flat arrays so they should be small and dense, like entity indices.
+    *
+    * Moving an object only touches the buckets when it crosses into another cell. Queries are const, so any number
+    * of threads can query at the same time as long as nothing is inserted, moved or removed.
+    */
+    class SpatialHashGrid {
+    public:
+        static constexpr std::uint32_t INVALID_BUCKET = std::numeric_limits<std::uint32_t>::max();
+
+        /// @param cellSize The width and height of a cell, about the radius of the common queries
+        /// @param bucketCount The number of buckets, rounded up to a power of two
+        explicit SpatialHashGrid(float cellSize = 1.0F, std::size_t bucketCount = 4096);
+
+        void Insert(std::uint32_t id, Point2Df position);
+        /// @brief Updates the position of an object, which is only relinked if it changed cells
+        void Move(std::uint32_t id, Point2Df position);
+        void Remove(std::uint32_t id);
+        void Clear();
+
+        [[nodiscard]] bool Contains(std::uint32_t id) const noexcept {
+            return id < m_Buckets.size() && m_Buckets[id] != INVALID_BUCKET;
+        }
+
+        [[nodiscard]] Point2Df GetPosition(std::uint32_t id) const {
+            return m_Positions[id];
+        }
+
+        [[nodiscard]] std::size_t GetObjectCount() const noexcept {
+            return m_ObjectCount;
+        }
+
+        [[nodiscard]] float GetCellSize() const noexcept {
+            return m_CellSize;
+        }
+
+        /**
+        * @brief Finds the objects within the radius of the center, including objects exactly on the circle
+        * The ids are written to the results buffer, which is cleared first and keeps its capacity between queries.
+        * @return The ids in the results buffer, in no particular order
+        */
+        std::span<const std::uint32_t> QueryRadius(
+            Point2Df center, float radius, std::vector<std::uint32_t>& results) const;
+        /// @brief Finds the objects inside the rectangle, including its edges, @see QueryRadius
+        std::span<const std::uint32_t> QueryRect(
+            const Rect2Df& rect, std::vector<std::uint32_t>& results) const;
+
+        /// @brief Runs a radius query for every center in parallel on the job system, @see QueryRadius
+        void QueryRadiusBatch(std::span<const Point2Df> centers, float radius,
+            SpatialQueryBatch& batch, JobSystem& jobSystem) const;
+    private:
+        struct Cell {
+            std::int32_t X;
+            std::int32_t Y;
+
+            bool operator==(const Cell& other) const noexcept = default;
+        };
+
+        [[nodiscard]] Cell          GetCell(Point2Df position) const noexcept;
+        [[nodiscard]] std::uint32_t GetBucket(Cell cell) const noexcept;
+
+        void Link(std::uint32_t id, Cell cell);
+        void Unlink(std::uint32_t id);
+
+        template<typename Fn>
+        void ForEachInCells(Cell min, Cell max, std::vector<std::uint32_t>& results,
+            Fn&& accept) const;
+
+        float                                   m_CellSize;
+        float                                   m_InverseCellSize;
+        std::vector<std::vector<std::uint32_t>> m_BucketObjects;
+        std::size_t                             m_ObjectCount = 0;
+
+        // Indexed by object id
+        std::vector<Point2Df>      m_Positions;
+        std::vector<Cell>          m_Cells;
+        std::vector<std::uint32_t> m_Buckets;
+        // The index of the object in its bucket, for removing it without a search
+        std::vector<std::uint32_t> m_Slots;
+    };
+} // namespace Astrelis
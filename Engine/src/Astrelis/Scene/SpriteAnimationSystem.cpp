@@ -0,0 +1,80 @@
+#include "SpriteAnimationSystem.hpp"
+
+#include "Astrelis/Core/Base.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Astrelis {
+    Vec4f SpriteSheet::GetFrame(const Rect2Du& pixels) const {
+        const auto width  = static_cast<float>(m_AtlasSize.Width);
+        const auto height = static_cast<float>(m_AtlasSize.Height);
+        return Vec4f(static_cast<float>(pixels.X()) / width,
+            static_cast<float>(pixels.Y()) / height, static_cast<float>(pixels.Width()) / width,
+            static_cast<float>(pixels.Height()) / height);
+    }
+
+    std::vector<Vec4f> SpriteSheet::GetGridFrames(
+        Dimension2Du cellSize, std::uint32_t firstCell, std::uint32_t count) const {
+        const std::uint32_t columns = m_AtlasSize.Width / cellSize.Width;
+        ASTRELIS_CORE_ASSERT(columns > 0, "The cells are wider than the atlas");
+
+        std::vector<Vec4f> frames;
+        frames.reserve(count);
+        for (std::uint32_t cell = firstCell; cell < firstCell + count; cell++) {
+            frames.push_back(GetFrame(Rect2Du((cell % columns) * cellSize.Width,
+                (cell / columns) * cellSize.Height, cellSize.Width, cellSize.Height)));
+        }
+        return frames;
+    }
+
+    SpriteClipId SpriteAnimationSystem::AddClip(const SpriteAnimationClip& clip) {
+        ASTRELIS_CORE_ASSERT(!clip.Frames.empty(), "A clip needs at least one frame");
+        ASTRELIS_CORE_ASSERT(clip.FrameDuration > 0.0F, "The frame duration has to be positive");
+
+        m_Clips.push_back(Clip {
+            static_cast<std::uint32_t>(m_Frames.size()),
+            static_cast<std::uint32_t>(clip.Frames.size()),
+            1.0F / clip.FrameDuration,
+            clip.FrameDuration * static_cast<float>(clip.Frames.size()),
+            clip.Loop,
+        });
+        m_Frames.insert(m_Frames.end(), clip.Frames.begin(), clip.Frames.end());
+        return static_cast<SpriteClipId>(m_Clips.size() - 1);
+    }
+
+    void SpriteAnimationSystem::Update(Scene& scene, float deltaTime) {
+        ASTRELIS_PROFILE_FUNCTION();
+        scene.View<SpriteAnimator, SpriteRenderer>().each(
+            [this, deltaTime](SpriteAnimator& animator, SpriteRenderer& sprite) {
+                const Clip& clip = m_Clips[animator.Clip];
+                if (animator.Playing) {
+                    float time = animator.Time + deltaTime * animator.Speed;
+                    if (clip.Loop) {
+                        time -= std::floor(time / clip.Duration) * clip.Duration;
+                    }
+                    else if (time < 0.0F || time >= clip.Duration) {
+                        time             = std::clamp(time, 0.0F, clip.Duration);
+                        animator.Playing = false;
+                    }
+                    animator.Time = time;
+                }
+                sprite.TexCoords = m_Frames[clip.FirstFrame + GetFrameIndex(clip, animator.Time)];
+            });
+    }
+
+    Vec4f SpriteAnimationSystem::GetFrame(SpriteClipId clip, float time) const {
+        const Clip& data = m_Clips[clip];
+        if (data.Loop) {
+            time -= std::floor(time / data.Duration) * data.Duration;
+        }
+        return m_Frames[data.FirstFrame + GetFrameIndex(data, time)];
+    }
+
+    std::uint32_t SpriteAnimationSystem::GetFrameIndex(const Clip& clip, float time) {
+        // Clamped, as the end of the clip and rounding in the loop can land exactly on Duration
+        const float frame = std::clamp(
+            time * clip.InverseFrameDuration, 0.0F, static_cast<float>(clip.FrameCount - 1));
+        return static_cast<std::uint32_t>(frame);
+    }
+} // namespace Astrelis
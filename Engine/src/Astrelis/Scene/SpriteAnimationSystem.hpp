@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Astrelis/Core/Geometry.hpp"
+#include "Astrelis/Core/Math.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Scene.hpp"
+
+namespace Astrelis {
+    /// @brief Converts frames of an atlas texture from pixels to texture coordinates, with the origin at the top left
+    class SpriteSheet {
+    public:
+        explicit SpriteSheet(Dimension2Du atlasSize) : m_AtlasSize(atlasSize) {
+        }
+
+        /// @brief The frame as the offset and scale stored in SpriteRenderer::TexCoords
+        [[nodiscard]] Vec4f GetFrame(const Rect2Du& pixels) const;
+        /// @brief The frames of a grid of equally sized cells, counted row by row from the top left cell
+        [[nodiscard]] std::vector<Vec4f> GetGridFrames(
+            Dimension2Du cellSize, std::uint32_t firstCell, std::uint32_t count) const;
+
+        [[nodiscard]] Dimension2Du GetAtlasSize() const noexcept {
+            return m_AtlasSize;
+        }
+    private:
+        Dimension2Du m_AtlasSize;
+    };
+
+    struct SpriteAnimationClip {
+        /// @brief The frames in texture coordinates, @see SpriteSheet
+        std::vector<Vec4f> Frames;
+        /// @brief How long each frame is shown, in seconds
+        float              FrameDuration = 0.1F;
+        /// @brief Clips that do not loop stop the animator on their last frame
+        bool               Loop          = true;
+    };
+
+    /**
+    * @brief Advances every SpriteAnimator and writes its current frame to the SpriteRenderer of the entity
+    * The frames of all clips are kept in one array, so an update is one pass over the animators that only looks
+    * up a frame, and the sprites keep sharing a single mesh and instanced draw in SpriteRenderSystem.
+    */
+    class SpriteAnimationSystem {
+    public:
+        /// @brief Adds a clip, its id is the number of clips that were added before it
+        SpriteClipId AddClip(const SpriteAnimationClip& clip);
+        void         Update(Scene& scene, float deltaTime);
+
+        /// @brief The frame that is shown at the time, with the clip looping or clamped like in Update
+        [[nodiscard]] Vec4f GetFrame(SpriteClipId clip, float time) const;
+
+        [[nodiscard]] std::size_t GetClipCount() const noexcept {
+            return m_Clips.size();
+        }
+    private:
+        struct Clip {
+            std::uint32_t FirstFrame;
+            std::uint32_t FrameCount;
+            float         InverseFrameDuration;
+            // The length of all frames together, in seconds
+            float Duration;
+            bool  Loop;
+        };
+
+        static std::uint32_t GetFrameIndex(const Clip& clip, float time);
+
+        std::vector<Clip>  m_Clips;
+        std::vector<Vec4f> m_Frames;
+    };
+} // namespace Astrelis
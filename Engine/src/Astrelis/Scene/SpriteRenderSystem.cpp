@@ -0,0 +1,25 @@
+#include "SpriteRenderSystem.hpp"
+
+#include "Astrelis/Core/Base.hpp"
+
+namespace Astrelis {
+    std::span<const InstanceData> SpriteRenderSystem::Collect(Scene& scene) {
+        ASTRELIS_PROFILE_FUNCTION();
+        auto view = scene.View<const Transform2D, const SpriteRenderer>();
+        m_Instances.clear();
+        m_Instances.reserve(view.size_hint());
+        view.each([this](const Transform2D& transform, const SpriteRenderer& sprite) {
+            m_Instances.push_back(
+                InstanceData {transform.GetTransform(), sprite.Color, sprite.TexCoords});
+        });
+        return m_Instances;
+    }
+
+    void SpriteRenderSystem::Render(Scene& scene, Renderer2D& renderer, const Mesh2D& quad) {
+        ASTRELIS_PROFILE_FUNCTION();
+        Collect(scene);
+        if (!m_Instances.empty()) {
+            renderer.SubmitInstanced(quad, m_Instances);
+        }
+    }
+} // namespace Astrelis
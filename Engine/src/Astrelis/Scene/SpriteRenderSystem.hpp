@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Astrelis/Renderer/Mesh.hpp"
+#include "Astrelis/Renderer/Renderer2D.hpp"
+
+#include <span>
+#include <vector>
+
+#include "Scene.hpp"
+
+namespace Astrelis {
+    /**
+    * @brief Draws every entity with a Transform2D and a SpriteRenderer as an instance of a single quad
+    * The sprite view is walked once per frame to fill one contiguous instance batch, which is submitted with a
+    * single instanced draw. The batch is kept between frames, so it only allocates when the sprite count grows.
+    */
+    class SpriteRenderSystem {
+    public:
+        /// @brief Fills the instance batch from the scene, without submitting it
+        std::span<const InstanceData> Collect(Scene& scene);
+        /// @brief Collects the batch and submits it as instances of the quad
+        void Render(Scene& scene, Renderer2D& renderer, const Mesh2D& quad);
+    private:
+        std::vector<InstanceData> m_Instances;
+    };
+} // namespace Astrelis
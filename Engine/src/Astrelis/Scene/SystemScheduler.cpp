@@ -0,0 +1,112 @@
+#include "SystemScheduler.hpp"
+
+#include "Astrelis/Core/Base.hpp"
+
+#include <algorithm>
+
+namespace Astrelis {
+    namespace {
+        bool Contains(const std::vector<entt::id_type>& components, entt::id_type component) {
+            return std::find(components.begin(), components.end(), component) != components.end();
+        }
+
+        bool Intersects(
+            const std::vector<entt::id_type>& lhs, const std::vector<entt::id_type>& rhs) {
+            return std::any_of(lhs.begin(), lhs.end(),
+                [&rhs](entt::id_type component) { return Contains(rhs, component); });
+        }
+    } // namespace
+
+    bool SystemAccess::ConflictsWith(const SystemAccess& other) const noexcept {
+        if (!IsDeclared() || !other.IsDeclared()) {
+            return true;
+        }
+
+        return Intersects(Writes, other.Writes) || Intersects(Writes, other.Reads)
+            || Intersects(Reads, other.Writes);
+    }
+
+    bool SystemAccess::CanRead(entt::id_type component) const noexcept {
+        return Contains(Reads, component) || Contains(Writes, component);
+    }
+
+    bool SystemAccess::CanWrite(entt::id_type component) const noexcept {
+        return Contains(Writes, component);
+    }
+
+    void SystemContext::CheckAccess(entt::id_type component, bool write) const {
+        // Undeclared systems run alone, so they can touch anything
+        if (!m_Access->IsDeclared()) {
+            return;
+        }
+
+        ASTRELIS_CORE_ASSERT(write ? m_Access->CanWrite(component) : m_Access->CanRead(component),
+            "System accesses a component it did not declare");
+    }
+
+    void SystemScheduler::AddSystem(
+        std::string name, SystemAccess access, SystemFunction function) {
+        System& system  = m_Systems.emplace_back();
+        system.Name     = std::move(name);
+        system.Access   = std::move(access);
+        system.Function = std::move(function);
+
+        // A system goes after every earlier system it conflicts with
+        for (std::size_t i = 0; i + 1 < m_Systems.size(); i++) {
+            if (m_Systems[i].Stage >= system.Stage
+                && system.Access.ConflictsWith(m_Systems[i].Access)) {
+                system.Stage = m_Systems[i].Stage + 1;
+            }
+        }
+
+        BuildStages();
+    }
+
+    void SystemScheduler::BuildStages() {
+        std::uint32_t stageCount = 0;
+        for (const System& system : m_Systems) {
+            stageCount = std::max(stageCount, system.Stage + 1);
+        }
+
+        // Counting sort by stage, which keeps the order the systems were added within a stage
+        m_StageOffsets.assign(stageCount + 1, 0);
+        for (const System& system : m_Systems) {
+            m_StageOffsets[system.Stage + 1]++;
+        }
+        for (std::size_t stage = 1; stage < m_StageOffsets.size(); stage++) {
+            m_StageOffsets[stage] += m_StageOffsets[stage - 1];
+        }
+
+        std::vector<std::size_t> cursors(m_StageOffsets.begin(), m_StageOffsets.end() - 1);
+        m_Order.resize(m_Systems.size());
+        for (std::size_t i = 0; i < m_Systems.size(); i++) {
+            m_Order[cursors[m_Systems[i].Stage]++] = static_cast<std::uint32_t>(i);
+        }
+    }
+
+    void SystemScheduler::Run(Scene& scene, JobSystem& jobSystem) {
+        ASTRELIS_PROFILE_FUNCTION();
+        for (std::size_t stage = 0; stage < GetStageCount(); stage++) {
+            std::span<const std::uint32_t> systems = GetStage(stage);
+            if (systems.size() == 1) {
+                RunSystem(m_Systems[systems[0]], scene, jobSystem);
+                continue;
+            }
+
+            jobSystem.ParallelFor(systems.size(), 1,
+                [this, systems, &scene, &jobSystem](std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i < end; i++) {
+                        RunSystem(m_Systems[systems[i]], scene, jobSystem);
+                    }
+                });
+        }
+    }
+
+    void SystemScheduler::RunSystem(System& system, Scene& scene, JobSystem& jobSystem) {
+        ASTRELIS_PROFILE_SCOPE("System Update");
+        system.Context.m_Scene     = &scene;
+        system.Context.m_JobSystem = &jobSystem;
+        system.Context.m_Access    = &system.Access;
+        system.Function(system.Context);
+    }
+} // namespace Astrelis
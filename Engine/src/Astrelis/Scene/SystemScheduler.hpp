@@ -0,0 +1,166 @@
+#pragma once
+
+#include "Astrelis/Core/Jobs/JobSystem.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <entt/entt.hpp>
+#include <functional>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Scene.hpp"
+
+namespace Astrelis {
+    /**
+    * @brief The component types that a system reads and writes
+    * Only used to find systems that can run in parallel, @see SystemScheduler. Like LayerAccess, a system that
+    * does not declare anything is assumed to access everything, and always runs on its own.
+    */
+    struct SystemAccess {
+        std::vector<entt::id_type> Reads;
+        std::vector<entt::id_type> Writes;
+
+        template<typename... Components> SystemAccess& Read() {
+            (Reads.push_back(GetComponentId<Components>()), ...);
+            return *this;
+        }
+
+        template<typename... Components> SystemAccess& Write() {
+            (Writes.push_back(GetComponentId<Components>()), ...);
+            return *this;
+        }
+
+        [[nodiscard]] bool IsDeclared() const noexcept {
+            return !Reads.empty() || !Writes.empty();
+        }
+
+        /// @brief Whether the two systems have to run one after the other
+        [[nodiscard]] bool ConflictsWith(const SystemAccess& other) const noexcept;
+        /// @brief Whether the component is declared as read or written, writing implies reading
+        [[nodiscard]] bool CanRead(entt::id_type component) const noexcept;
+        [[nodiscard]] bool CanWrite(entt::id_type component) const noexcept;
+
+        template<typename Component> static entt::id_type GetComponentId() noexcept {
+            return entt::type_hash<std::remove_cvref_t<Component>>::value();
+        }
+    };
+
+    /// @brief What a system is given when it runs, the scene and helpers to spread its work over the workers
+    class SystemContext {
+    public:
+        [[nodiscard]] Scene& GetScene() const noexcept {
+            return *m_Scene;
+        }
+
+        [[nodiscard]] JobSystem& GetJobSystem() const noexcept {
+            return *m_JobSystem;
+        }
+
+        /**
+        * @brief Calls function for every entity of the view, in batches that are processed in parallel
+        * The function is called as function(components&...), or function(entity, components&...), and may run on
+        * any worker, so it must only touch the components it is given. Components that are only read should be
+        * const, non const components have to be declared as written.
+        * @param batchSize The number of entities per job, 0 picks a batch size based on the worker count
+        */
+        template<typename... Components, typename Fn>
+        void ParallelEach(Fn&& function, std::size_t batchSize = 0) {
+            (CheckAccess(SystemAccess::GetComponentId<Components>(), !std::is_const_v<Components>),
+                ...);
+
+            // The entities are gathered first, views only have forward iterators, and the handles are cheap
+            // to copy compared to the work done per entity
+            auto view = m_Scene->View<Components...>();
+            m_Entities.clear();
+            m_Entities.reserve(view.size_hint());
+            for (entt::entity entity : view) {
+                m_Entities.push_back(entity);
+            }
+
+            std::span<const entt::entity> entities = m_Entities;
+            m_JobSystem->ParallelFor(entities.size(), batchSize,
+                [&view, &function, entities](std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i < end; i++) {
+                        const entt::entity entity = entities[i];
+                        if constexpr (std::is_invocable_v<Fn&, entt::entity, Components&...>) {
+                            function(entity, view.template get<Components>(entity)...);
+                        }
+                        else {
+                            function(view.template get<Components>(entity)...);
+                        }
+                    }
+                });
+        }
+    private:
+        friend class SystemScheduler;
+
+        void CheckAccess(entt::id_type component, bool write) const;
+
+        Scene*                    m_Scene     = nullptr;
+        JobSystem*                m_JobSystem = nullptr;
+        const SystemAccess*       m_Access    = nullptr;
+        std::vector<entt::entity> m_Entities;
+    };
+
+    using SystemFunction = std::function<void(SystemContext&)>;
+
+    /**
+    * @brief Runs the systems of a scene, in parallel where their component access allows it
+    * Systems are grouped into stages the same way as layers, @see LayerScheduler. The systems of a stage run in
+    * parallel on the job system, and stages run in the order the systems were added. Systems can split their own
+    * views into batches with SystemContext::ParallelEach, so even a single heavy system uses every worker.
+    * @note Systems may run on worker threads, they must not submit render commands
+    */
+    class SystemScheduler {
+    public:
+        SystemScheduler()                                  = default;
+        ~SystemScheduler()                                 = default;
+        SystemScheduler(const SystemScheduler&)            = delete;
+        SystemScheduler& operator=(const SystemScheduler&) = delete;
+        SystemScheduler(SystemScheduler&&)                 = default;
+        SystemScheduler& operator=(SystemScheduler&&)      = default;
+
+        void AddSystem(std::string name, SystemAccess access, SystemFunction function);
+        /// @brief Runs every system once, stage by stage, and waits for all of them to finish
+        void Run(Scene& scene, JobSystem& jobSystem);
+
+        [[nodiscard]] std::size_t GetSystemCount() const noexcept {
+            return m_Systems.size();
+        }
+
+        [[nodiscard]] std::size_t GetStageCount() const noexcept {
+            return m_StageOffsets.empty() ? 0 : m_StageOffsets.size() - 1;
+        }
+
+        /// @brief The indices of the systems in the stage, in the order they were added
+        [[nodiscard]] std::span<const std::uint32_t> GetStage(std::size_t index) const {
+            return std::span<const std::uint32_t>(m_Order).subspan(
+                m_StageOffsets[index], m_StageOffsets[index + 1] - m_StageOffsets[index]);
+        }
+
+        [[nodiscard]] const std::string& GetSystemName(std::size_t index) const {
+            return m_Systems[index].Name;
+        }
+    private:
+        struct System {
+            std::string    Name;
+            SystemAccess   Access;
+            SystemFunction Function;
+            SystemContext  Context;
+            std::uint32_t  Stage = 0;
+        };
+
+        // Stages only change when systems are added, so they are not rebuilt every frame
+        void BuildStages();
+        static void RunSystem(System& system, Scene& scene, JobSystem& jobSystem);
+
+        std::vector<System>        m_Systems;
+        // Indices of the systems sorted by stage, keeping the order they were added within a stage
+        std::vector<std::uint32_t> m_Order;
+        std::vector<std::size_t>   m_StageOffsets;
+    };
+} // namespace Astrelis
@@ -0,0 +1,399 @@
+#include "TransformHierarchy.hpp"
+
+#include "Astrelis/Core/Base.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define ASTRELIS_TRANSFORM_SSE 1
+    #include <xmmintrin.h>
+#else
+    #define ASTRELIS_TRANSFORM_SSE 0
+#endif
+
+namespace Astrelis {
+    namespace {
+#if ASTRELIS_TRANSFORM_SSE
+        constexpr std::size_t BATCH_SIZE = 4;
+#endif
+
+        template<typename T>
+        void Permute(std::vector<T>& values, std::span<const std::uint32_t> order) {
+            std::vector<T> permuted(values.size());
+            for (std::size_t i = 0; i < order.size(); i++) {
+                permuted[i] = values[order[i]];
+            }
+            values = std::move(permuted);
+        }
+
+        void WriteInstance(InstanceData& instance, float a, float b, float c, float d, float x,
+            float y, float z) {
+            glm::mat4& matrix = instance.Transform.GetGLMMatrix();
+            matrix            = glm::mat4(1.0F);
+            matrix[0][0]      = a;
+            matrix[0][1]      = b;
+            matrix[1][0]      = c;
+            matrix[1][1]      = d;
+            matrix[3][0]      = x;
+            matrix[3][1]      = y;
+            matrix[3][2]      = z;
+        }
+    } // namespace
+
+    TransformNodeId TransformHierarchy::AddNode(TransformNodeId parent) {
+        ASTRELIS_CORE_ASSERT(
+            parent == NO_PARENT || parent < m_Indices.size(), "Unknown parent node");
+        const auto node = static_cast<TransformNodeId>(m_Indices.size());
+        m_Indices.push_back(static_cast<std::uint32_t>(m_Nodes.size()));
+        m_Nodes.push_back(node);
+        m_Parent.push_back(parent);
+        m_PositionX.push_back(0.0F);
+        m_PositionY.push_back(0.0F);
+        m_Rotation.push_back(0.0F);
+        m_ScaleX.push_back(1.0F);
+        m_ScaleY.push_back(1.0F);
+        m_Depth.push_back(0.0F);
+        m_Dirty.push_back(1);
+        m_WorldA.push_back(1.0F);
+        m_WorldB.push_back(0.0F);
+        m_WorldC.push_back(0.0F);
+        m_WorldD.push_back(1.0F);
+        m_WorldX.push_back(0.0F);
+        m_WorldY.push_back(0.0F);
+        m_WorldZ.push_back(0.0F);
+
+        // The node has to be moved to the level below its parent
+        m_NeedsSort = true;
+        return node;
+    }
+
+    bool TransformHierarchy::SetParent(TransformNodeId node, TransformNodeId parent) {
+        const std::size_t index = GetIndex(node);
+        for (TransformNodeId ancestor = parent; ancestor != NO_PARENT;
+            ancestor                  = m_Parent[GetIndex(ancestor)]) {
+            if (ancestor == node) {
+                return false;
+            }
+        }
+
+        m_Parent[index] = parent;
+        m_Dirty[index]  = 1;
+        m_NeedsSort     = true;
+        return true;
+    }
+
+    void TransformHierarchy::Clear() {
+        for (auto* values : {&m_PositionX, &m_PositionY, &m_Rotation, &m_ScaleX, &m_ScaleY,
+                 &m_Depth, &m_WorldA, &m_WorldB, &m_WorldC, &m_WorldD, &m_WorldX, &m_WorldY,
+                 &m_WorldZ}) {
+            values->clear();
+        }
+        m_Parent.clear();
+        m_Dirty.clear();
+        m_Nodes.clear();
+        m_Indices.clear();
+        m_LevelOffsets.clear();
+        m_UpdatedCount = 0;
+        m_NeedsSort    = false;
+    }
+
+    void TransformHierarchy::SetPosition(TransformNodeId node, Vec2f position) {
+        const std::size_t index = GetIndex(node);
+        m_PositionX[index]      = position[0];
+        m_PositionY[index]      = position[1];
+        m_Dirty[index]          = 1;
+    }
+
+    void TransformHierarchy::SetRotation(TransformNodeId node, float rotation) {
+        const std::size_t index = GetIndex(node);
+        m_Rotation[index]       = rotation;
+        m_Dirty[index]          = 1;
+    }
+
+    void TransformHierarchy::SetScale(TransformNodeId node, Vec2f scale) {
+        const std::size_t index = GetIndex(node);
+        m_ScaleX[index]         = scale[0];
+        m_ScaleY[index]         = scale[1];
+        m_Dirty[index]          = 1;
+    }
+
+    void TransformHierarchy::SetDepth(TransformNodeId node, float depth) {
+        const std::size_t index = GetIndex(node);
+        m_Depth[index]          = depth;
+        m_Dirty[index]          = 1;
+    }
+
+    Vec2f TransformHierarchy::GetPosition(TransformNodeId node) const {
+        const std::size_t index = GetIndex(node);
+        return Vec2f(m_PositionX[index], m_PositionY[index]);
+    }
+
+    float TransformHierarchy::GetRotation(TransformNodeId node) const {
+        return m_Rotation[GetIndex(node)];
+    }
+
+    Vec2f TransformHierarchy::GetScale(TransformNodeId node) const {
+        const std::size_t index = GetIndex(node);
+        return Vec2f(m_ScaleX[index], m_ScaleY[index]);
+    }
+
+    float TransformHierarchy::GetDepth(TransformNodeId node) const {
+        return m_Depth[GetIndex(node)];
+    }
+
+    TransformNodeId TransformHierarchy::GetParent(TransformNodeId node) const {
+        return m_Parent[GetIndex(node)];
+    }
+
+    void TransformHierarchy::MarkAllDirty() {
+        std::fill(m_Dirty.begin(), m_Dirty.end(), 1);
+    }
+
+    Mat4f TransformHierarchy::GetWorldTransform(TransformNodeId node) const {
+        const std::size_t index = GetIndex(node);
+        InstanceData      instance;
+        WriteInstance(instance, m_WorldA[index], m_WorldB[index], m_WorldC[index],
+            m_WorldD[index], m_WorldX[index], m_WorldY[index], m_WorldZ[index]);
+        return instance.Transform;
+    }
+
+    std::size_t TransformHierarchy::GetIndex(TransformNodeId node) const {
+        ASTRELIS_CORE_ASSERT(node < m_Indices.size(), "Unknown transform node");
+        return m_Indices[node];
+    }
+
+    void TransformHierarchy::Sort() {
+        ASTRELIS_PROFILE_FUNCTION();
+        const std::size_t nodeCount = m_Nodes.size();
+
+        // Children of every node id, grouped with a counting sort, the last slot holds the roots
+        m_ChildOffsets.assign(nodeCount + 2, 0);
+        for (std::size_t index = 0; index < nodeCount; index++) {
+            const TransformNodeId parent = m_Parent[index];
+            m_ChildOffsets[(parent == NO_PARENT ? nodeCount : parent) + 1]++;
+        }
+        for (std::size_t i = 1; i < m_ChildOffsets.size(); i++) {
+            m_ChildOffsets[i] += m_ChildOffsets[i - 1];
+        }
+
+        // Filling by node id keeps the children of a node in the order they were added
+        m_Children.resize(nodeCount);
+        m_Order.assign(m_ChildOffsets.begin(), m_ChildOffsets.end() - 1);
+        for (TransformNodeId node = 0; node < nodeCount; node++) {
+            const TransformNodeId parent = m_Parent[m_Indices[node]];
+            m_Children[m_Order[parent == NO_PARENT ? nodeCount : parent]++] = node;
+        }
+
+        // A breadth first walk from the roots visits the nodes level by level
+        m_Order.clear();
+        m_Order.reserve(nodeCount);
+        m_LevelOffsets.clear();
+        m_Order.insert(m_Order.end(), m_Children.begin() + m_ChildOffsets[nodeCount],
+            m_Children.begin() + m_ChildOffsets[nodeCount + 1]);
+        std::size_t levelBegin = 0;
+        while (levelBegin < m_Order.size()) {
+            m_LevelOffsets.push_back(levelBegin);
+            const std::size_t levelEnd = m_Order.size();
+            for (std::size_t i = levelBegin; i < levelEnd; i++) {
+                const TransformNodeId node = m_Order[i];
+                m_Order.insert(m_Order.end(), m_Children.begin() + m_ChildOffsets[node],
+                    m_Children.begin() + m_ChildOffsets[node + 1]);
+            }
+            levelBegin = levelEnd;
+        }
+        m_LevelOffsets.push_back(m_Order.size());
+        ASTRELIS_CORE_ASSERT(m_Order.size() == nodeCount, "Transform hierarchy has a cycle");
+
+        // From node ids to the previous sorted indices, which is the permutation of the node data
+        for (std::uint32_t& node : m_Order) {
+            node = m_Indices[node];
+        }
+        for (auto* values : {&m_PositionX, &m_PositionY, &m_Rotation, &m_ScaleX, &m_ScaleY,
+                 &m_Depth, &m_WorldA, &m_WorldB, &m_WorldC, &m_WorldD, &m_WorldX, &m_WorldY,
+                 &m_WorldZ}) {
+            Permute(*values, m_Order);
+        }
+        Permute(m_Parent, m_Order);
+        Permute(m_Dirty, m_Order);
+        Permute(m_Nodes, m_Order);
+        for (std::size_t index = 0; index < nodeCount; index++) {
+            m_Indices[m_Nodes[index]] = static_cast<std::uint32_t>(index);
+        }
+
+        m_NeedsSort = false;
+    }
+
+    void TransformHierarchy::Update(std::span<InstanceData> instances) {
+        ASTRELIS_PROFILE_FUNCTION();
+        ASTRELIS_CORE_ASSERT(instances.empty() || instances.size() >= m_Nodes.size(),
+            "Instance buffer is smaller than the transform hierarchy");
+        if (m_NeedsSort) {
+            Sort();
+        }
+
+        m_UpdatedCount = 0;
+        for (std::size_t level = 0; level + 1 < m_LevelOffsets.size(); level++) {
+            UpdateLevel(m_LevelOffsets[level], m_LevelOffsets[level + 1], instances);
+        }
+
+        // Cleared only once every level is done, children read the flags of their parents
+        std::fill(m_Dirty.begin(), m_Dirty.end(), 0);
+    }
+
+    void TransformHierarchy::UpdateLevel(
+        std::size_t begin, std::size_t end, std::span<InstanceData> instances) {
+        // A changed node changes its whole subtree, and the parents were updated by the level above
+        for (std::size_t index = begin; index < end; index++) {
+            const TransformNodeId parent = m_Parent[index];
+            if (parent != NO_PARENT) {
+                m_Dirty[index] |= m_Dirty[m_Indices[parent]];
+            }
+        }
+
+        // The parent transforms are gathered per batch, a root has the identity as parent
+        const auto loadParents = [this](std::size_t index, std::size_t count, float* a, float* b,
+                                     float* c, float* d, float* x, float* y, float* z) {
+            for (std::size_t i = 0; i < count; i++) {
+                const TransformNodeId parent = m_Parent[index + i];
+                if (parent == NO_PARENT) {
+                    a[i] = 1.0F;
+                    b[i] = 0.0F;
+                    c[i] = 0.0F;
+                    d[i] = 1.0F;
+                    x[i] = 0.0F;
+                    y[i] = 0.0F;
+                    z[i] = 0.0F;
+                    continue;
+                }
+
+                const std::uint32_t parentIndex = m_Indices[parent];
+                a[i]                            = m_WorldA[parentIndex];
+                b[i]                            = m_WorldB[parentIndex];
+                c[i]                            = m_WorldC[parentIndex];
+                d[i]                            = m_WorldD[parentIndex];
+                x[i]                            = m_WorldX[parentIndex];
+                y[i]                            = m_WorldY[parentIndex];
+                z[i]                            = m_WorldZ[parentIndex];
+            }
+        };
+
+        std::size_t index = begin;
+#if ASTRELIS_TRANSFORM_SSE
+        for (; index + BATCH_SIZE <= end; index += BATCH_SIZE) {
+            std::uint32_t dirty = 0;
+            std::memcpy(&dirty, &m_Dirty[index], sizeof(dirty));
+            if (dirty == 0) {
+                continue;
+            }
+
+            alignas(16) float cos[BATCH_SIZE];
+            alignas(16) float sin[BATCH_SIZE];
+            for (std::size_t i = 0; i < BATCH_SIZE; i++) {
+                cos[i] = std::cos(m_Rotation[index + i]);
+                sin[i] = std::sin(m_Rotation[index + i]);
+            }
+
+            alignas(16) float parent[7][BATCH_SIZE];
+            loadParents(index, BATCH_SIZE, parent[0], parent[1], parent[2], parent[3], parent[4],
+                parent[5], parent[6]);
+            const __m128 pa = _mm_load_ps(parent[0]);
+            const __m128 pb = _mm_load_ps(parent[1]);
+            const __m128 pc = _mm_load_ps(parent[2]);
+            const __m128 pd = _mm_load_ps(parent[3]);
+
+            // Local matrix of translate * rotate * scale, columns (cos, sin) * sx and (-sin, cos) * sy
+            const __m128 vcos = _mm_load_ps(cos);
+            const __m128 vsin = _mm_load_ps(sin);
+            const __m128 sx   = _mm_loadu_ps(&m_ScaleX[index]);
+            const __m128 sy   = _mm_loadu_ps(&m_ScaleY[index]);
+            const __m128 la   = _mm_mul_ps(vcos, sx);
+            const __m128 lb   = _mm_mul_ps(vsin, sx);
+            const __m128 lc   = _mm_sub_ps(_mm_setzero_ps(), _mm_mul_ps(vsin, sy));
+            const __m128 ld   = _mm_mul_ps(vcos, sy);
+            const __m128 lx   = _mm_loadu_ps(&m_PositionX[index]);
+            const __m128 ly   = _mm_loadu_ps(&m_PositionY[index]);
+
+            __m128 wa = _mm_add_ps(_mm_mul_ps(pa, la), _mm_mul_ps(pc, lb));
+            __m128 wb = _mm_add_ps(_mm_mul_ps(pb, la), _mm_mul_ps(pd, lb));
+            __m128 wc = _mm_add_ps(_mm_mul_ps(pa, lc), _mm_mul_ps(pc, ld));
+            __m128 wd = _mm_add_ps(_mm_mul_ps(pb, lc), _mm_mul_ps(pd, ld));
+            __m128 wx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(pa, lx), _mm_mul_ps(pc, ly)),
+                _mm_load_ps(parent[4]));
+            __m128 wy = _mm_add_ps(_mm_add_ps(_mm_mul_ps(pb, lx), _mm_mul_ps(pd, ly)),
+                _mm_load_ps(parent[5]));
+            __m128 wz = _mm_add_ps(_mm_load_ps(parent[6]), _mm_loadu_ps(&m_Depth[index]));
+
+            _mm_storeu_ps(&m_WorldA[index], wa);
+            _mm_storeu_ps(&m_WorldB[index], wb);
+            _mm_storeu_ps(&m_WorldC[index], wc);
+            _mm_storeu_ps(&m_WorldD[index], wd);
+            _mm_storeu_ps(&m_WorldX[index], wx);
+            _mm_storeu_ps(&m_WorldY[index], wy);
+            _mm_storeu_ps(&m_WorldZ[index], wz);
+            m_UpdatedCount += BATCH_SIZE;
+
+            if (instances.empty()) {
+                continue;
+            }
+
+            // Transposed to one register per node, (a, b, c, d) and (x, y, z, 1), which hold the columns
+            __m128 one = _mm_set1_ps(1.0F);
+            _MM_TRANSPOSE4_PS(wa, wb, wc, wd);
+            _MM_TRANSPOSE4_PS(wx, wy, wz, one);
+            const __m128 zero      = _mm_setzero_ps();
+            const __m128 column2   = _mm_set_ps(0.0F, 1.0F, 0.0F, 0.0F);
+            const __m128 linear[4] = {wa, wb, wc, wd};
+            const __m128 offset[4] = {wx, wy, wz, one};
+            for (std::size_t i = 0; i < BATCH_SIZE; i++) {
+                float* matrix = &instances[m_Nodes[index + i]].Transform.GetGLMMatrix()[0][0];
+                _mm_storeu_ps(matrix, _mm_movelh_ps(linear[i], zero));
+                _mm_storeu_ps(matrix + 4, _mm_movehl_ps(zero, linear[i]));
+                _mm_storeu_ps(matrix + 8, column2);
+                _mm_storeu_ps(matrix + 12, offset[i]);
+            }
+        }
+#endif
+
+        // The nodes that do not fill a batch
+        for (; index < end; index++) {
+            if (m_Dirty[index] == 0) {
+                continue;
+            }
+
+            float pa = 0.0F;
+            float pb = 0.0F;
+            float pc = 0.0F;
+            float pd = 0.0F;
+            float px = 0.0F;
+            float py = 0.0F;
+            float pz = 0.0F;
+            loadParents(index, 1, &pa, &pb, &pc, &pd, &px, &py, &pz);
+
+            const float cos = std::cos(m_Rotation[index]);
+            const float sin = std::sin(m_Rotation[index]);
+            const float la  = cos * m_ScaleX[index];
+            const float lb  = sin * m_ScaleX[index];
+            const float lc  = -sin * m_ScaleY[index];
+            const float ld  = cos * m_ScaleY[index];
+            const float lx  = m_PositionX[index];
+            const float ly  = m_PositionY[index];
+
+            m_WorldA[index] = pa * la + pc * lb;
+            m_WorldB[index] = pb * la + pd * lb;
+            m_WorldC[index] = pa * lc + pc * ld;
+            m_WorldD[index] = pb * lc + pd * ld;
+            m_WorldX[index] = pa * lx + pc * ly + px;
+            m_WorldY[index] = pb * lx + pd * ly + py;
+            m_WorldZ[index] = pz + m_Depth[index];
+            m_UpdatedCount++;
+
+            if (!instances.empty()) {
+                WriteInstance(instances[m_Nodes[index]], m_WorldA[index], m_WorldB[index],
+                    m_WorldC[index], m_WorldD[index], m_WorldX[index], m_WorldY[index],
+                    m_WorldZ[index]);
+            }
+        }
+    }
+} // namespace Astrelis
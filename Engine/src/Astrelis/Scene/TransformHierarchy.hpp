@@ -0,0 +1,107 @@
+#pragma once
+
+#include "Astrelis/Core/Math.hpp"
+#include "Astrelis/Renderer/Renderer2D.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace Astrelis {
+    /// @brief The id of a node of a TransformHierarchy, ids are assigned in order and never change
+    using TransformNodeId = std::uint32_t;
+
+    /**
+    * @brief A parent/child hierarchy of 2D transforms, stored as structure of arrays
+    * Nodes are kept sorted by their level in the tree, so every parent comes before its children and the nodes of
+    * one level only depend on the level above. Update walks the levels in order and computes the world transforms
+    * of four nodes at a time with SSE, skipping batches whose subtrees did not change since the last update.
+    *
+    * The world transforms are written straight into an instance buffer indexed by node id. Only changed nodes are
+    * written, so the caller has to keep that buffer between updates, a buffer that is rebuilt or recycled every
+    * frame (like the per-frame upload of Renderer2D) would hold stale transforms for the unchanged nodes. Call
+    * MarkAllDirty before updating into a different buffer.
+    */
+    class TransformHierarchy {
+    public:
+        static constexpr TransformNodeId NO_PARENT = std::numeric_limits<TransformNodeId>::max();
+
+        /// @brief Adds a node with an identity local transform, the parent has to exist already
+        TransformNodeId AddNode(TransformNodeId parent = NO_PARENT);
+        /// @brief Moves the node and its subtree under a new parent
+        /// @return false if the parent is inside the subtree, in which case nothing changes
+        bool SetParent(TransformNodeId node, TransformNodeId parent);
+        void Clear();
+
+        void SetPosition(TransformNodeId node, Vec2f position);
+        void SetRotation(TransformNodeId node, float rotation);
+        void SetScale(TransformNodeId node, Vec2f scale);
+        void SetDepth(TransformNodeId node, float depth);
+
+        [[nodiscard]] Vec2f GetPosition(TransformNodeId node) const;
+        [[nodiscard]] float GetRotation(TransformNodeId node) const;
+        [[nodiscard]] Vec2f GetScale(TransformNodeId node) const;
+        [[nodiscard]] float GetDepth(TransformNodeId node) const;
+        [[nodiscard]] TransformNodeId GetParent(TransformNodeId node) const;
+
+        /**
+        * @brief Recomputes the world transforms of the changed subtrees
+        * @param instances The instance buffer to write the changed world matrices to, indexed by node id. It has to
+        * hold at least GetNodeCount() instances, or be empty to only update the world transforms. Only the transform
+        * of an instance is written, the color is left to the caller.
+        * @note The instances of unchanged nodes are not written, they keep what the previous update wrote into the
+        * same buffer
+        */
+        void Update(std::span<InstanceData> instances = {});
+        /// @brief Marks every node as changed, for example after the instance buffer was reallocated
+        void MarkAllDirty();
+
+        /// @brief The world matrix computed by the last update
+        [[nodiscard]] Mat4f GetWorldTransform(TransformNodeId node) const;
+
+        [[nodiscard]] std::size_t GetNodeCount() const noexcept {
+            return m_Nodes.size();
+        }
+
+        /// @brief The number of nodes whose world transform was computed by the last update
+        [[nodiscard]] std::size_t GetUpdatedCount() const noexcept {
+            return m_UpdatedCount;
+        }
+    private:
+        void Sort();
+        void UpdateLevel(std::size_t begin, std::size_t end, std::span<InstanceData> instances);
+
+        std::size_t GetIndex(TransformNodeId node) const;
+
+        // Node data, indexed by the sorted index, the vectors are separate so the kernel loads four nodes at once
+        std::vector<float>           m_PositionX;
+        std::vector<float>           m_PositionY;
+        std::vector<float>           m_Rotation;
+        std::vector<float>           m_ScaleX;
+        std::vector<float>           m_ScaleY;
+        std::vector<float>           m_Depth;
+        std::vector<TransformNodeId> m_Parent;
+        std::vector<std::uint8_t>    m_Dirty;
+        std::vector<TransformNodeId> m_Nodes;
+        // The world transform as a 2x3 affine matrix, the columns (A, B) and (C, D) and the translation
+        std::vector<float> m_WorldA;
+        std::vector<float> m_WorldB;
+        std::vector<float> m_WorldC;
+        std::vector<float> m_WorldD;
+        std::vector<float> m_WorldX;
+        std::vector<float> m_WorldY;
+        std::vector<float> m_WorldZ;
+
+        // Sorted index of every node id, and the first index of every level
+        std::vector<std::uint32_t> m_Indices;
+        std::vector<std::size_t>   m_LevelOffsets;
+        // Scratch buffers for sorting
+        std::vector<std::uint32_t> m_ChildOffsets;
+        std::vector<std::uint32_t> m_Children;
+        std::vector<std::uint32_t> m_Order;
+        std::size_t                m_UpdatedCount = 0;
+        bool                       m_NeedsSort    = false;
+    };
+} // namespace Astrelis
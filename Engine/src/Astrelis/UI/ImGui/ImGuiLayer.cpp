@@ -1,6 +1,7 @@
 #include "ImGuiLayer.hpp"
 
 #include "Astrelis/Events/Event.hpp"
+#include "Astrelis/Renderer/RenderThread.hpp"
 
 #include <GLFW/glfw3.h>
 #include <backends/imgui_impl_glfw.h>
@@ -13,7 +14,8 @@ namespace Astrelis {
         : Layer("ImGuiLayer"), m_Backend(std::move(backend)) {
     }
 
-    void ImGuiLayer::OnAttach() {
+    void ImGuiLayer::CreateContext() {
+        ASTRELIS_PROFILE_FUNCTION();
         IMGUI_CHECKVERSION();
         ImGui::CreateContext();
         ImGuiIO& imguiIO = ImGui::GetIO();
@@ -35,6 +37,18 @@ namespace Astrelis {
             imguiIO.ConfigFlags |= ImGuiConfigFlags_IsSRGB;
         }
 
+        // Rasterizing the fonts is the expensive part, the backend only uploads the built atlas
+        unsigned char* pixels = nullptr;
+        int            width  = 0;
+        int            height = 0;
+        imguiIO.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    }
+
+    void ImGuiLayer::OnAttach() {
+        if (ImGui::GetCurrentContext() == nullptr) {
+            CreateContext();
+        }
+
         if (m_Backend != nullptr) {
             m_Backend->Init();
         }
@@ -77,9 +91,9 @@ namespace Astrelis {
     void ImGuiLayer::End() {
         ImGuiIO& imguiIo = ImGui::GetIO();
 
-        // Rendering
+        // Rendering, the draw data is recorded on the render thread if rendering is pipelined
         ImGui::Render();
-        m_Backend->End();
+        RenderThread::Submit([this]() { m_Backend->End(); });
 
         if ((imguiIo.ConfigFlags & ImGuiConfigFlags_ViewportsEnable) != 0) {
             GLFWwindow* backup_current = glfwGetCurrentContext();
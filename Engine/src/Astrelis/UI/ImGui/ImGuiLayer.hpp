@@ -27,6 +27,11 @@ namespace Astrelis {
 
         void SetDarkThemeColors();
 
+        /// @brief Creates and configures the ImGui context, and builds the font atlas
+        /// This does not touch the window or the graphics context, so the application runs it on a worker thread
+        /// while the render system initializes. OnAttach creates the context if this was not called before.
+        static void CreateContext();
+
         void BlockEvents(bool block) {
             m_BlockEvents = block;
         }
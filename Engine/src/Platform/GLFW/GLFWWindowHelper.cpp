@@ -2,9 +2,7 @@
 
 #include "Astrelis/Core/Base.hpp"
 
-#include "Astrelis/Events/KeyEvent.hpp"
-#include "Astrelis/Events/MouseEvent.hpp"
-#include "Astrelis/Events/WindowEvent.hpp"
+#include "Astrelis/Events/EventRecord.hpp"
 
 #include <GLFW/glfw3.h>
 
@@ -104,190 +102,128 @@ namespace Astrelis {
         return glfwGetWindowUserPointer(window);
     }
 
-    // NOLINTNEXTLINE(readability-function-cognitive-complexity)
+    void GLFWWindowHelper::PostEvent(GLFWwindow* window, const EventRecord& record) {
+        auto& data = GetUserData<BaseWindowData>(window);
+        if (data.Events == nullptr) {
+            // Nobody listens to the events of this window
+            return;
+        }
+
+        // A full queue counts the dropped records, the application reports them once per frame
+        data.Events->Post(record);
+    }
+
+    // The callbacks only copy the events into the queue, the application dispatches them later
     void GLFWWindowHelper::SetEventCallbacks(RawRef<GLFWwindow*> window, BaseWindowData& data) {
         glfwSetWindowUserPointer(window, &data);
 
         glfwSetFramebufferSizeCallback(window, [](GLFWwindow* window, int width, int height) {
-            auto& data = GLFWWindowHelper::GetUserData<BaseWindowData>(window);
-            ASTRELIS_CORE_ASSERT(data.EventCallback, "EventCallback is not set");
-            ViewportResizedEvent event(width, height);
-            data.EventCallback(event);
-        });
-
-        glfwSetWindowCloseCallback(window, [](GLFWwindow* window) {
-            auto& data = GLFWWindowHelper::GetUserData<BaseWindowData>(window);
-            ASTRELIS_CORE_ASSERT(data.EventCallback, "EventCallback is not set");
-            WindowCloseEvent event;
-            data.EventCallback(event);
+            PostEvent(window,
+                EventRecord::Create(EventType::ViewportResized, static_cast<std::uint32_t>(width),
+                    static_cast<std::uint32_t>(height)));
         });
 
         glfwSetKeyCallback(window,
             [](GLFWwindow* window, int key, [[maybe_unused]] int scancode, int action,
                 [[maybe_unused]] int mods) {
-                auto& data = GLFWWindowHelper::GetUserData<BaseWindowData>(window);
             // NOLINTNEXTLINE(readability-simplify-boolean-expr)
                 ASTRELIS_CORE_ASSERT(
                     action == GLFW_PRESS || action == GLFW_RELEASE || action == GLFW_REPEAT,
                     "Invalid action type");
-                ASTRELIS_CORE_ASSERT(data.EventCallback, "EventCallback is not set");
 
+                const auto keyCode = static_cast<std::uint32_t>(key);
                 switch (action) {
                 case GLFW_PRESS:
-                    {
-                        KeyPressedEvent event(static_cast<KeyCode>(key), false);
-                        data.EventCallback(event);
-                        break;
-                    }
+                    PostEvent(window, EventRecord::Create(EventType::KeyPressed, keyCode, 0));
+                    break;
                 case GLFW_RELEASE:
-                    {
-                        KeyReleasedEvent event(static_cast<KeyCode>(key));
-                        data.EventCallback(event);
-                        break;
-                    }
+                    PostEvent(window, EventRecord::Create(EventType::KeyReleased, keyCode));
+                    break;
                 case GLFW_REPEAT:
-                    {
-                        KeyPressedEvent event(static_cast<KeyCode>(key), true);
-                        data.EventCallback(event);
-                        break;
-                    }
+                    PostEvent(window, EventRecord::Create(EventType::KeyPressed, keyCode, 1));
+                    break;
                 default:
                     break;
                 }
             });
 
         glfwSetCursorPosCallback(window, [](GLFWwindow* window, double xpos, double ypos) {
-            auto& data = GLFWWindowHelper::GetUserData<BaseWindowData>(window);
-            ASTRELIS_CORE_ASSERT(data.EventCallback, "EventCallback is not set");
-            MouseMovedEvent event(static_cast<float>(xpos), static_cast<float>(ypos));
-            data.EventCallback(event);
+            PostEvent(window, EventRecord::CreateFloat(EventType::MouseMoved,
+                                  static_cast<float>(xpos), static_cast<float>(ypos)));
         });
 
         glfwSetMouseButtonCallback(
             window, [](GLFWwindow* window, int button, int action, [[maybe_unused]] int mods) {
-                auto& data = GLFWWindowHelper::GetUserData<BaseWindowData>(window);
             // NOLINTNEXTLINE(readability-simplify-boolean-expr)
                 ASTRELIS_CORE_ASSERT(
                     action == GLFW_PRESS || action == GLFW_RELEASE, "Invalid action type");
-                ASTRELIS_CORE_ASSERT(data.EventCallback, "EventCallback is not set");
 
+                const auto buttonCode = static_cast<std::uint32_t>(button);
                 switch (action) {
                 case GLFW_PRESS:
-                    {
-                        MouseButtonPressedEvent event(static_cast<MouseCode>(button));
-                        data.EventCallback(event);
-                        break;
-                    }
+                    PostEvent(
+                        window, EventRecord::Create(EventType::MouseButtonPressed, buttonCode));
+                    break;
                 case GLFW_RELEASE:
-                    {
-                        MouseButtonReleasedEvent event(static_cast<MouseCode>(button));
-                        data.EventCallback(event);
-                        break;
-                    }
+                    PostEvent(
+                        window, EventRecord::Create(EventType::MouseButtonReleased, buttonCode));
+                    break;
                 default:
                     break;
                 }
             });
 
         glfwSetScrollCallback(window, [](GLFWwindow* window, double xoffset, double yoffset) {
-            auto& data = GLFWWindowHelper::GetUserData<BaseWindowData>(window);
-            ASTRELIS_CORE_ASSERT(data.EventCallback, "EventCallback is not set");
-            MouseScrolledEvent event(static_cast<float>(xoffset), static_cast<float>(yoffset));
-            data.EventCallback(event);
+            PostEvent(window, EventRecord::CreateFloat(EventType::MouseScrolled,
+                                  static_cast<float>(xoffset), static_cast<float>(yoffset)));
         });
 
         glfwSetWindowFocusCallback(window, [](GLFWwindow* window, int focused) {
-            auto& data = GLFWWindowHelper::GetUserData<BaseWindowData>(window);
-            ASTRELIS_CORE_ASSERT(data.EventCallback, "EventCallback is not set");
-
-            if (focused != 0) {
-                WindowFocusedEvent event;
-                data.EventCallback(event);
-            }
-            else {
-                WindowLostFocusEvent event;
-                data.EventCallback(event);
-            }
+            PostEvent(window, EventRecord::Create(focused != 0 ? EventType::WindowFocused
+                                                               : EventType::WindowLostFocus));
         });
 
         glfwSetWindowIconifyCallback(window, [](GLFWwindow* window, int iconified) {
-            auto& data = GLFWWindowHelper::GetUserData<BaseWindowData>(window);
-            ASTRELIS_CORE_ASSERT(data.EventCallback, "EventCallback is not set");
-
-            if (iconified != 0) {
-                WindowMinimizedEvent event;
-                data.EventCallback(event);
-            }
-            else {
-                WindowRestoredEvent event;
-                data.EventCallback(event);
-            }
+            PostEvent(window, EventRecord::Create(iconified != 0 ? EventType::WindowMinimized
+                                                                 : EventType::WindowRestored));
         });
 
         glfwSetWindowMaximizeCallback(window, [](GLFWwindow* window, int maximized) {
-            auto& data = GLFWWindowHelper::GetUserData<BaseWindowData>(window);
-            ASTRELIS_CORE_ASSERT(data.EventCallback, "EventCallback is not set");
-
-            if (maximized != 0) {
-                WindowMaximizedEvent event;
-                data.EventCallback(event);
-            }
-            else {
-                WindowRestoredEvent event;
-                data.EventCallback(event);
-            }
+            PostEvent(window, EventRecord::Create(maximized != 0 ? EventType::WindowMaximized
+                                                                 : EventType::WindowRestored));
         });
 
         glfwSetWindowRefreshCallback(window, [](GLFWwindow* window) {
-            auto& data = GLFWWindowHelper::GetUserData<BaseWindowData>(window);
-            ASTRELIS_CORE_ASSERT(data.EventCallback, "EventCallback is not set");
-            WindowRefreshEvent event;
-            data.EventCallback(event);
+            PostEvent(window, EventRecord::Create(EventType::WindowRefresh));
         });
 
         glfwSetWindowPosCallback(window, [](GLFWwindow* window, int xpos, int ypos) {
-            auto& data = GLFWWindowHelper::GetUserData<BaseWindowData>(window);
-            ASTRELIS_CORE_ASSERT(data.EventCallback, "EventCallback is not set");
-            WindowMovedEvent event(xpos, ypos);
-            data.EventCallback(event);
+            PostEvent(window,
+                EventRecord::Create(EventType::WindowMoved, static_cast<std::uint32_t>(xpos),
+                    static_cast<std::uint32_t>(ypos)));
         });
 
         glfwSetWindowSizeCallback(window, [](GLFWwindow* window, int width, int height) {
-            auto& data = GLFWWindowHelper::GetUserData<BaseWindowData>(window);
-            ASTRELIS_CORE_ASSERT(data.EventCallback, "EventCallback is not set");
-            WindowResizedEvent event(width, height);
+            auto& data             = GLFWWindowHelper::GetUserData<BaseWindowData>(window);
             data.Dimensions.Width  = width;
             data.Dimensions.Height = height;
-            data.EventCallback(event);
+            PostEvent(window,
+                EventRecord::Create(EventType::WindowResized, static_cast<std::uint32_t>(width),
+                    static_cast<std::uint32_t>(height)));
         });
 
         glfwSetWindowContentScaleCallback(
             window, [](GLFWwindow* window, float xscale, float yscale) {
-                auto& data = GLFWWindowHelper::GetUserData<BaseWindowData>(window);
-                ASTRELIS_CORE_ASSERT(data.EventCallback, "EventCallback is not set");
-                WindowScaleEvent event(xscale, yscale);
-                data.EventCallback(event);
+                PostEvent(window, EventRecord::CreateFloat(EventType::WindowScale, xscale, yscale));
             });
 
         glfwSetWindowCloseCallback(window, [](GLFWwindow* window) {
-            auto& data = GLFWWindowHelper::GetUserData<BaseWindowData>(window);
-            ASTRELIS_CORE_ASSERT(data.EventCallback, "EventCallback is not set");
-            WindowCloseEvent event;
-            data.EventCallback(event);
+            PostEvent(window, EventRecord::Create(EventType::WindowClosed));
         });
 
         glfwSetCursorEnterCallback(window, [](GLFWwindow* window, int entered) {
-            auto& data = GLFWWindowHelper::GetUserData<BaseWindowData>(window);
-            ASTRELIS_CORE_ASSERT(data.EventCallback, "EventCallback is not set");
-
-            if (entered != 0) {
-                MouseEnteredEvent event;
-                data.EventCallback(event);
-            }
-            else {
-                MouseLeftEvent event;
-                data.EventCallback(event);
-            }
+            PostEvent(window, EventRecord::Create(
+                                  entered != 0 ? EventType::MouseEntered : EventType::MouseLeft));
         });
     }
 
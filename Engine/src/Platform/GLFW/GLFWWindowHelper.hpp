@@ -14,6 +14,7 @@ namespace Astrelis {
         static void SetEventCallbacks(RawRef<GLFWwindow*> window, BaseWindowData& data);
     private:
         static void* GetUserData(GLFWwindow* window);
+        static void  PostEvent(GLFWwindow* window, const EventRecord& record);
 
         template<typename T> static T& GetUserData(GLFWwindow* window) {
             return *static_cast<T*>(GetUserData(window));
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Astrelis/Core/Result.hpp"
+#include "Astrelis/Core/Window.hpp"
+
+#include <string>
+#include <utility>
+
+namespace Astrelis {
+    /// @brief A window without a native window, surface or graphics context
+    /// Used by headless applications (CI, soak tests, CPU benchmarks), it never produces any events.
+    class HeadlessWindow : public Window {
+    public:
+        explicit HeadlessWindow(BaseWindowData data) : m_Data(std::move(data)) {
+        }
+
+        ~HeadlessWindow() override                       = default;
+        HeadlessWindow(const HeadlessWindow&)            = delete;
+        HeadlessWindow& operator=(const HeadlessWindow&) = delete;
+        HeadlessWindow(HeadlessWindow&&)                 = delete;
+        HeadlessWindow& operator=(HeadlessWindow&&)      = delete;
+
+        void OnUpdate() override {
+        }
+
+        void WaitForEvents() override {
+        }
+
+        void BeginFrame() override {
+        }
+
+        void EndFrame() override {
+        }
+
+        void SetEventQueue(EventQueue& queue) override {
+            m_Data.Events = &queue;
+        }
+
+        RefPtr<GraphicsContext> GetGraphicsContext() const override {
+            return nullptr;
+        }
+
+        Rect2Di GetViewportBounds() const override {
+            return Rect2Di(0, 0, static_cast<std::int32_t>(m_Data.Dimensions.Width),
+                static_cast<std::int32_t>(m_Data.Dimensions.Height));
+        }
+
+        std::uint32_t GetWidth() const override {
+            return m_Data.Dimensions.Width;
+        }
+
+        std::uint32_t GetHeight() const override {
+            return m_Data.Dimensions.Height;
+        }
+
+        void* GetNativeWindow() const override {
+            return nullptr;
+        }
+
+        // There is nothing to present, so the loop is never capped
+        bool IsVSync() const override {
+            return false;
+        }
+
+        void SetVSync(bool enabled) override {
+            ASTRELIS_UNUSED(enabled);
+        }
+
+        static Result<RefPtr<HeadlessWindow>, std::string> Create(const WindowProps& props) {
+            return RefPtr<HeadlessWindow>::Create(BaseWindowData(props.Title, props.Dimensions));
+        }
+    private:
+        BaseWindowData m_Data;
+    };
+} // namespace Astrelis
@@ -27,8 +27,8 @@ namespace Astrelis {
         void BeginFrame() override;
         void EndFrame() override;
 
-        void SetEventCallback(const WindowEventCallback& callback) override {
-            m_Data.EventCallback = callback;
+        void SetEventQueue(EventQueue& queue) override {
+            m_Data.Events = &queue;
         }
 
         RefPtr<GraphicsContext> GetGraphicsContext() const override {
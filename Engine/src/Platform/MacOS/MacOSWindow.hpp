@@ -27,8 +27,8 @@ namespace Astrelis {
         void OnUpdate() final;
         void WaitForEvents() final;
 
-        void SetEventCallback(const WindowEventCallback& callback) final {
-            m_Data.EventCallback = callback;
+        void SetEventQueue(EventQueue& queue) final {
+            m_Data.Events = &queue;
         }
 
         RefPtr<GraphicsContext> GetGraphicsContext() const final {
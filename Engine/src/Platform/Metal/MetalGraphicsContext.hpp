@@ -18,6 +18,7 @@ namespace Astrelis {
         void                           BeginFrame() final;
         void                           EndFrame() final;
         bool                           SkipFrame() final;
+        void                           SetFramebufferSize(Dimension2Du size) final;
 
         bool IsVSync() const final;
         void SetVSync(bool enabled) final;
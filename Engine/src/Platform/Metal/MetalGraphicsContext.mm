@@ -77,6 +77,9 @@ namespace Astrelis
 
     bool MetalGraphicsContext::SkipFrame() { return m_Impl->SkipFrame(); }
 
+    // The metal layer follows the size of the window on its own
+    void MetalGraphicsContext::SetFramebufferSize(Dimension2Du size) { ASTRELIS_UNUSED(size); }
+
     bool MetalGraphicsContext::IsVSync() const { return m_Impl->IsVSync(); }
 
     void MetalGraphicsContext::SetVSync(bool enabled) { m_Impl->SetVSync(enabled); }
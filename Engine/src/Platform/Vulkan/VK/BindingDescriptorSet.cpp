@@ -7,7 +7,8 @@
 
 namespace Astrelis::Vulkan {
     bool BindingDescriptorSet::Init(LogicalDevice& device, DescriptorPool& descriptorPool,
-        std::uint32_t sets, const std::vector<DescriptorSetBinding>& descriptors) {
+        const ResourceRegistry& resources, std::uint32_t sets,
+        const std::vector<DescriptorSetBinding>& descriptors) {
         if (!m_Layout.Init(device, descriptors)) {
             ASTRELIS_CORE_LOG_ERROR("Failed to create descriptor set layout.");
             return false;
@@ -15,7 +16,8 @@ namespace Astrelis::Vulkan {
 
         m_DescriptorSets.resize(sets);
         for (std::uint32_t i = 0; i < sets; ++i) {
-            if (!m_DescriptorSets[i].Init(device, descriptorPool, m_Layout, descriptors, i)) {
+            if (!m_DescriptorSets[i].Init(
+                    device, descriptorPool, m_Layout, resources, descriptors, i)) {
                 ASTRELIS_CORE_LOG_ERROR("Failed to create descriptor set.");
                 return false;
             }
@@ -28,7 +30,8 @@ namespace Astrelis::Vulkan {
         auto          ctx = context.As<VulkanGraphicsContext>();
         std::uint32_t sets =
             m_Mode == Mode::One ? 1 : static_cast<std::uint32_t>(ctx->m_Frames.size());
-        return Init(ctx->m_LogicalDevice, ctx->m_DescriptorPool, sets, descriptors);
+        return Init(
+            ctx->m_LogicalDevice, ctx->m_DescriptorPool, ctx->m_Resources, sets, descriptors);
     }
 
     void BindingDescriptorSet::Destroy(
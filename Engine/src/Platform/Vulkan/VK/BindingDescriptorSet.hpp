@@ -23,7 +23,8 @@ namespace Astrelis::Vulkan {
         BindingDescriptorSet& operator=(BindingDescriptorSet&& other)      = default;
 
         [[nodiscard]] bool Init(LogicalDevice& device, DescriptorPool& descriptorPool,
-            std::uint32_t frames, const std::vector<DescriptorSetBinding>& descriptors);
+            const ResourceRegistry& resources, std::uint32_t frames,
+            const std::vector<DescriptorSetBinding>& descriptors);
         [[nodiscard]] bool Init(RefPtr<GraphicsContext>& context,
             const std::vector<DescriptorSetBinding>&     descriptors) final;
 
@@ -6,14 +6,11 @@
 
 #include "GraphicsPipeline.hpp"
 #include "Platform/Vulkan/VK/LogicalDevice.hpp"
-#include "TextureImage.hpp"
-#include "TextureSampler.hpp"
-#include "UniformBuffer.hpp"
 
 namespace Astrelis::Vulkan {
     bool DescriptorSet::Init(LogicalDevice& device, DescriptorPool& pool,
-        DescriptorSetLayout& layout, const std::vector<DescriptorSetBinding>& descriptors,
-        std::uint32_t setIndex) {
+        DescriptorSetLayout& layout, const ResourceRegistry& resources,
+        const std::vector<DescriptorSetBinding>& descriptors, std::uint32_t setIndex) {
         std::array<VkDescriptorSetLayout, 1> layouts = {layout.m_Layout};
 
         VkDescriptorSetAllocateInfo allocInfo {};
@@ -51,12 +48,17 @@ namespace Astrelis::Vulkan {
             if (!descriptor.Uniforms.empty()) {
                 ASTRELIS_CORE_ASSERT(descriptor.Uniforms.size() > setIndex,
                     "Uniform buffer descriptor does not have enough elements!");
+                const UniformBuffer* buffer =
+                    resources.UniformBuffers.Get(descriptor.Uniforms[setIndex].Buffer);
+                if (buffer == nullptr) {
+                    ASTRELIS_CORE_LOG_ERROR(
+                        "Uniform buffer descriptor refers to a destroyed buffer!");
+                    return false;
+                }
+
                 VkDescriptorBufferInfo& bufferInfo = bufferInfos[i];
-                bufferInfo.buffer                  = descriptor.Uniforms[setIndex]
-                                        .Buffer.As<UniformBuffer*>()
-                                        ->m_Buffers[0]
-                                        .m_Buffer;
-                bufferInfo.range  = descriptor.Size;
+                bufferInfo.buffer                  = buffer->m_Buffers[0].m_Buffer;
+                bufferInfo.range                   = descriptor.Size;
                 bufferInfo.offset = 0; // TODO: Add offset support
 
                 descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
@@ -65,12 +67,18 @@ namespace Astrelis::Vulkan {
             else if (!descriptor.Textures.empty()) {
                 ASTRELIS_CORE_ASSERT(descriptor.Textures.size() > setIndex,
                     "Texture descriptor does not have enough elements!");
+                const auto&           texture = descriptor.Textures[setIndex];
+                const TextureImage*   image   = resources.TextureImages.Get(texture.Image);
+                const TextureSampler* sampler = resources.TextureSamplers.Get(texture.Sampler);
+                if (image == nullptr || sampler == nullptr) {
+                    ASTRELIS_CORE_LOG_ERROR("Texture descriptor refers to a destroyed texture!");
+                    return false;
+                }
+
                 VkDescriptorImageInfo& imageInfo = imageInfos[i];
                 imageInfo.imageLayout            = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-                imageInfo.imageView =
-                    descriptor.Textures[setIndex].Image.As<TextureImage*>()->GetImageView();
-                imageInfo.sampler =
-                    descriptor.Textures[setIndex].Sampler.As<TextureSampler*>()->m_Sampler;
+                imageInfo.imageView              = image->GetImageView();
+                imageInfo.sampler                = sampler->m_Sampler;
 
                 descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
                 descriptorWrite.pImageInfo     = &imageInfo;
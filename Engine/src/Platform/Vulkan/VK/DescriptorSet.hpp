@@ -6,6 +6,7 @@
 #include "DescriptorPool.hpp"
 #include "DescriptorSetLayout.hpp"
 #include "LogicalDevice.hpp"
+#include "ResourceRegistry.hpp"
 
 namespace Astrelis::Vulkan {
 
@@ -26,9 +27,10 @@ namespace Astrelis::Vulkan {
         DescriptorSet(DescriptorSet&& other)                 = default;
         DescriptorSet& operator=(DescriptorSet&& other)      = default;
 
+        /// @param resources Resolves the buffer and texture handles of the descriptors
         [[nodiscard]] bool Init(LogicalDevice& device, DescriptorPool& pool,
-            DescriptorSetLayout& layout, const std::vector<DescriptorSetBinding>& descriptors,
-            std::uint32_t setIndex);
+            DescriptorSetLayout& layout, const ResourceRegistry& resources,
+            const std::vector<DescriptorSetBinding>& descriptors, std::uint32_t setIndex);
         void Destroy(LogicalDevice& logicalDevice, DescriptorPool& descriptorPool) const;
         void Bind(CommandBuffer& buffer, GraphicsPipeline& pipeline) const;
 
@@ -2,12 +2,10 @@
 
 #include "Astrelis/Renderer/IndexBuffer.hpp"
 
-#include <vulkan/vulkan.h>
-
 #include "CommandBuffer.hpp"
-#include "CommandPool.hpp"
 #include "LogicalDevice.hpp"
 #include "PhysicalDevice.hpp"
+#include "StreamingBuffer.hpp"
 
 namespace Astrelis::Vulkan {
     class IndexBuffer : public Astrelis::IndexBuffer {
@@ -16,22 +14,20 @@ namespace Astrelis::Vulkan {
         ~IndexBuffer() override                    = default;
         IndexBuffer(const IndexBuffer&)            = delete;
         IndexBuffer& operator=(const IndexBuffer&) = delete;
-        IndexBuffer(IndexBuffer&&)                 = delete;
-        IndexBuffer& operator=(IndexBuffer&&)      = delete;
+        IndexBuffer(IndexBuffer&&)                 = default;
+        IndexBuffer& operator=(IndexBuffer&&)      = default;
 
-        [[nodiscard]] bool Init(
-            LogicalDevice& device, PhysicalDevice& physicalDevice, std::uint32_t count);
+        [[nodiscard]] bool Init(LogicalDevice& device, PhysicalDevice& physicalDevice,
+            std::uint32_t count, std::uint32_t frameCount);
         [[nodiscard]] bool Init(RefPtr<GraphicsContext>& context, std::uint32_t count) override;
         void               Destroy(RefPtr<GraphicsContext>& context) override;
 
-        [[nodiscard]] bool SetData(LogicalDevice& device, PhysicalDevice& physicalDevice,
-            CommandPool& commandPool, const std::uint32_t* data, std::uint32_t count);
+        [[nodiscard]] bool Reserve(RefPtr<GraphicsContext>& context, std::uint32_t count) override;
         [[nodiscard]] bool SetData(RefPtr<GraphicsContext>& context, const std::uint32_t* data,
-            std::uint32_t count) override;
-        void               Bind(CommandBuffer& buffer) const;
+            std::uint32_t count, std::uint32_t firstIndex) override;
+        void               Bind(CommandBuffer& buffer, std::uint32_t frame) const;
         void               Bind(RefPtr<Astrelis::GraphicsContext>& context) const override;
     private:
-        VkBuffer       m_Buffer       = VK_NULL_HANDLE;
-        VkDeviceMemory m_BufferMemory = VK_NULL_HANDLE;
+        StreamingBuffer m_Buffer;
     };
 } // namespace Astrelis::Vulkan
@@ -63,7 +63,7 @@ namespace Astrelis::Vulkan {
     }
 
     void RenderPass::Begin(CommandBuffer& commandBuffer, FrameBuffer& frameBuffer,
-        VkExtent2D extent, const std::vector<VkClearValue>& clearValues) {
+        VkExtent2D extent, std::span<const VkClearValue> clearValues) {
         ASTRELIS_CORE_ASSERT(frameBuffer.GetHandle() != VK_NULL_HANDLE,
             "FrameBuffer must be created before calling Begin on RenderPass!");
         VkRenderPassBeginInfo renderPassInfo {};
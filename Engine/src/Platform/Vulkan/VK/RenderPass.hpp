@@ -2,6 +2,8 @@
 
 #include <vulkan/vulkan.h>
 
+#include <span>
+
 #include "CommandBuffer.hpp"
 #include "LogicalDevice.hpp"
 
@@ -51,7 +53,7 @@ namespace Astrelis::Vulkan {
         void               Destroy(LogicalDevice& device);
 
         void Begin(CommandBuffer& commandBuffer, FrameBuffer& frameBuffer, VkExtent2D extent,
-            const std::vector<VkClearValue>& clearValues);
+            std::span<const VkClearValue> clearValues);
         void End(CommandBuffer& buffer);
 
         [[nodiscard]] VkRenderPass GetHandle() const {
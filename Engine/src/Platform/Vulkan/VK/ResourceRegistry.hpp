@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Astrelis/Core/SlotMap.hpp"
+
+#include "IndexBuffer.hpp"
+#include "TextureImage.hpp"
+#include "TextureSampler.hpp"
+#include "UniformBuffer.hpp"
+#include "VertexBuffer.hpp"
+
+namespace Astrelis::Vulkan {
+    /// @brief The buffers and textures created through the renderer API, stored by value and looked up by handle
+    /// Resources are moved when others are destroyed, which is fine since they only hold Vulkan handles.
+    struct ResourceRegistry {
+        SlotMap<VertexBuffer, Astrelis::VertexBuffer>     VertexBuffers;
+        SlotMap<IndexBuffer, Astrelis::IndexBuffer>       IndexBuffers;
+        SlotMap<UniformBuffer, Astrelis::UniformBuffer>   UniformBuffers;
+        SlotMap<TextureImage, Astrelis::TextureImage>     TextureImages;
+        SlotMap<TextureSampler, Astrelis::TextureSampler> TextureSamplers;
+
+        [[nodiscard]] std::size_t GetResourceCount() const noexcept {
+            return VertexBuffers.GetSize() + IndexBuffers.GetSize() + UniformBuffers.GetSize()
+                 + TextureImages.GetSize() + TextureSamplers.GetSize();
+        }
+    };
+} // namespace Astrelis::Vulkan
@@ -0,0 +1,89 @@
+#include "StreamingBuffer.hpp"
+
+#include "Astrelis/Core/Log.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Utils.hpp"
+
+namespace Astrelis::Vulkan {
+    bool StreamingBuffer::Init(LogicalDevice& device, PhysicalDevice& physicalDevice,
+        VkBufferUsageFlags usage, std::size_t size, std::uint32_t frameCount) {
+        m_Usage = usage;
+        m_Frames.resize(frameCount);
+        for (Frame& frame : m_Frames) {
+            if (!CreateFrame(device, physicalDevice, size, frame)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void StreamingBuffer::Destroy(LogicalDevice& device) {
+        for (Frame& frame : m_Frames) {
+            DestroyFrame(device, frame);
+        }
+        m_Frames.clear();
+    }
+
+    bool StreamingBuffer::Reserve(LogicalDevice& device, PhysicalDevice& physicalDevice,
+        std::uint32_t frame, std::size_t size) {
+        Frame& data = m_Frames[frame];
+        if (size <= data.Size) {
+            return true;
+        }
+
+        // Grows geometrically, so a slowly growing load does not recreate the buffer every frame
+        const std::size_t newSize = std::max(size, data.Size * 2);
+        DestroyFrame(device, data);
+        return CreateFrame(device, physicalDevice, newSize, data);
+    }
+
+    bool StreamingBuffer::Write(
+        std::uint32_t frame, const void* data, std::size_t size, std::size_t offset) {
+        Frame& target = m_Frames[frame];
+        if (offset + size > target.Size) {
+            ASTRELIS_CORE_LOG_ERROR("Writing {0} bytes at {1} overflows a buffer of {2} bytes",
+                size, offset, target.Size);
+            return false;
+        }
+
+        // The memory is host coherent, so the write is visible to the next queue submission
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        std::memcpy(static_cast<std::byte*>(target.MappedMemory) + offset, data, size);
+        return true;
+    }
+
+    bool StreamingBuffer::CreateFrame(
+        LogicalDevice& device, PhysicalDevice& physicalDevice, std::size_t size, Frame& frame) {
+        if (!CreateBuffer(physicalDevice.GetHandle(), device.GetHandle(), size, m_Usage,
+                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                frame.Buffer, frame.Memory)) {
+            ASTRELIS_CORE_LOG_ERROR("Failed to create streaming buffer!");
+            return false;
+        }
+
+        vkBindBufferMemory(device.GetHandle(), frame.Buffer, frame.Memory, 0);
+        if (vkMapMemory(device.GetHandle(), frame.Memory, 0, size, 0, &frame.MappedMemory)
+            != VK_SUCCESS) {
+            ASTRELIS_CORE_LOG_ERROR("Failed to map streaming buffer memory!");
+            return false;
+        }
+        frame.Size = size;
+        return true;
+    }
+
+    void StreamingBuffer::DestroyFrame(LogicalDevice& device, Frame& frame) {
+        if (frame.Buffer == VK_NULL_HANDLE) {
+            return;
+        }
+
+        if (frame.MappedMemory != nullptr) {
+            vkUnmapMemory(device.GetHandle(), frame.Memory);
+        }
+        vkDestroyBuffer(device.GetHandle(), frame.Buffer, nullptr);
+        vkFreeMemory(device.GetHandle(), frame.Memory, nullptr);
+        frame = Frame();
+    }
+} // namespace Astrelis::Vulkan
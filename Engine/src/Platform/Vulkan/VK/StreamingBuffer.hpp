@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <vulkan/vulkan.h>
+
+#include "LogicalDevice.hpp"
+#include "PhysicalDevice.hpp"
+
+namespace Astrelis::Vulkan {
+    /**
+    * @brief A buffer that is rewritten every frame, with one persistently mapped copy per frame in flight
+    * Writing is a memcpy into the copy of the frame that is recorded, while the GPU can still read the copies of
+    * the previous frames. Once the fence of a frame has been waited on, its copy can also be grown safely.
+    */
+    class StreamingBuffer {
+    public:
+        StreamingBuffer()                                  = default;
+        ~StreamingBuffer()                                 = default;
+        StreamingBuffer(const StreamingBuffer&)            = delete;
+        StreamingBuffer& operator=(const StreamingBuffer&) = delete;
+        StreamingBuffer(StreamingBuffer&&)                 = default;
+        StreamingBuffer& operator=(StreamingBuffer&&)      = default;
+
+        [[nodiscard]] bool Init(LogicalDevice& device, PhysicalDevice& physicalDevice,
+            VkBufferUsageFlags usage, std::size_t size, std::uint32_t frameCount);
+        void               Destroy(LogicalDevice& device);
+
+        /// @brief Grows the copy of the frame to at least size bytes, discarding its contents
+        /// @note The copy must not be bound in a command buffer of the frame yet
+        [[nodiscard]] bool Reserve(LogicalDevice& device, PhysicalDevice& physicalDevice,
+            std::uint32_t frame, std::size_t size);
+        [[nodiscard]] bool Write(
+            std::uint32_t frame, const void* data, std::size_t size, std::size_t offset);
+
+        [[nodiscard]] VkBuffer GetHandle(std::uint32_t frame) const {
+            return m_Frames[frame].Buffer;
+        }
+    private:
+        struct Frame {
+            VkBuffer       Buffer       = VK_NULL_HANDLE;
+            VkDeviceMemory Memory       = VK_NULL_HANDLE;
+            void*          MappedMemory = nullptr;
+            std::size_t    Size         = 0;
+        };
+
+        [[nodiscard]] bool CreateFrame(
+            LogicalDevice& device, PhysicalDevice& physicalDevice, std::size_t size, Frame& frame);
+        static void DestroyFrame(LogicalDevice& device, Frame& frame);
+
+        std::vector<Frame> m_Frames;
+        VkBufferUsageFlags m_Usage = 0;
+    };
+} // namespace Astrelis::Vulkan
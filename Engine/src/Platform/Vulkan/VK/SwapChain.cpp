@@ -8,7 +8,7 @@
 #include "Utils.hpp"
 
 namespace Astrelis::Vulkan {
-    bool SwapChain::Init(const RawRef<GLFWwindow*>& window, PhysicalDevice& physicalDevice,
+    bool SwapChain::Init(VkExtent2D framebufferSize, PhysicalDevice& physicalDevice,
         LogicalDevice& logicalDevice, Surface& surface, std::uint32_t& imageCount, bool vsync,
         VkSwapchainKHR oldSwapchain) {
         SwapChainSupportDetails swapChainSupport =
@@ -17,7 +17,7 @@ namespace Astrelis::Vulkan {
         VkSurfaceFormatKHR surfaceFormat = swapChainSupport.ChooseSwapSurfaceFormat();
         VkPresentModeKHR   presentMode =
             vsync ? swapChainSupport.ChooseSwapPresentMode() : VK_PRESENT_MODE_IMMEDIATE_KHR;
-        VkExtent2D extent = swapChainSupport.ChooseExtent(window);
+        VkExtent2D extent = swapChainSupport.ChooseExtent(framebufferSize);
 
         if (GlobalConfig::IsDebugMode()) {
             static bool firstInit = true;
@@ -16,7 +16,7 @@ namespace Astrelis::Vulkan {
         SwapChain(SwapChain&&)                 = delete;
         SwapChain& operator=(SwapChain&&)      = delete;
 
-        [[nodiscard]] bool Init(const RawRef<GLFWwindow*>& window, PhysicalDevice& physicalDevice,
+        [[nodiscard]] bool Init(VkExtent2D framebufferSize, PhysicalDevice& physicalDevice,
             LogicalDevice& logicalDevice, Surface& surface, std::uint32_t& imageCount, bool vsync,
             VkSwapchainKHR oldSwapchain = VK_NULL_HANDLE);
         void               Destroy(LogicalDevice& device);
@@ -13,8 +13,8 @@ namespace Astrelis::Vulkan {
         ~UniformBuffer() override                      = default;
         UniformBuffer(const UniformBuffer&)            = delete;
         UniformBuffer& operator=(const UniformBuffer&) = delete;
-        UniformBuffer(UniformBuffer&&)                 = delete;
-        UniformBuffer& operator=(UniformBuffer&&)      = delete;
+        UniformBuffer(UniformBuffer&&)                 = default;
+        UniformBuffer& operator=(UniformBuffer&&)      = default;
 
         [[nodiscard]] bool Init(RefPtr<GraphicsContext>& context, std::uint32_t size) override;
         void               Destroy(RefPtr<GraphicsContext>& context) const override;
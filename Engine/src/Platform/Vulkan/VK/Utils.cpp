@@ -387,19 +387,12 @@ namespace Astrelis::Vulkan {
         return details;
     }
 
-    VkExtent2D SwapChainSupportDetails::ChooseExtent(const RawRef<GLFWwindow*>& window) const {
+    VkExtent2D SwapChainSupportDetails::ChooseExtent(VkExtent2D framebufferSize) const {
         if (capabilities.currentExtent.width != UINT32_MAX) {
             return capabilities.currentExtent;
         }
 
-        int width  = 0;
-        int height = 0;
-        glfwGetFramebufferSize(window, &width, &height);
-
-        VkExtent2D actualExtent = {
-            static_cast<std::uint32_t>(width),
-            static_cast<std::uint32_t>(height),
-        };
+        VkExtent2D actualExtent = framebufferSize;
 
         actualExtent.width  = std::clamp(actualExtent.width, capabilities.minImageExtent.width,
              capabilities.maxImageExtent.width);
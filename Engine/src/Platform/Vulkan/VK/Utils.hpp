@@ -82,7 +82,8 @@ namespace Astrelis::Vulkan {
             return VK_PRESENT_MODE_FIFO_KHR;
         }
 
-        VkExtent2D ChooseExtent(const RawRef<GLFWwindow*>& window) const;
+        /// @param framebufferSize The size of the window framebuffer, only used if the surface does not define the extent
+        VkExtent2D ChooseExtent(VkExtent2D framebufferSize) const;
     };
 
     SwapChainSupportDetails QuerySwapChainSupport(VkPhysicalDevice device, VkSurfaceKHR surface);
@@ -1,85 +1,49 @@
 #include "VertexBuffer.hpp"
 
-#include "Astrelis/Core/Log.hpp"
-
 #include <array>
-#include <cstring>
 #include <vulkan/vulkan.h>
 
 #include "CommandBuffer.hpp"
-#include "CommandPool.hpp"
 #include "Platform/Vulkan/VulkanGraphicsContext.hpp"
-#include "Utils.hpp"
 
 namespace Astrelis::Vulkan {
-    bool VertexBuffer::Init(
-        LogicalDevice& device, PhysicalDevice& physicalDevice, std::size_t size) {
-        VkDeviceSize bufferSize = size;
-        if (!CreateBuffer(physicalDevice.GetHandle(), device.GetHandle(), bufferSize,
-                VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
-                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                m_Buffer, m_BufferMemory)) {
-            ASTRELIS_CORE_LOG_ERROR("Failed to create vertex buffer!");
-            return false;
-        }
-        vkBindBufferMemory(device.GetHandle(), m_Buffer, m_BufferMemory, 0);
-
-        return true;
+    bool VertexBuffer::Init(LogicalDevice& device, PhysicalDevice& physicalDevice,
+        std::size_t size, std::uint32_t frameCount) {
+        return m_Buffer.Init(
+            device, physicalDevice, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, size, frameCount);
     }
 
     bool VertexBuffer::Init(RefPtr<GraphicsContext>& context, std::size_t size) {
         auto ctx = context.As<VulkanGraphicsContext>();
-        return Init(ctx->m_LogicalDevice, ctx->m_PhysicalDevice, size);
+        return Init(ctx->m_LogicalDevice, ctx->m_PhysicalDevice, size,
+            static_cast<std::uint32_t>(ctx->m_Frames.size()));
     }
 
     void VertexBuffer::Destroy(RefPtr<GraphicsContext>& context) {
-        auto ctx = context.As<VulkanGraphicsContext>();
-        vkDestroyBuffer(ctx->m_LogicalDevice.GetHandle(), m_Buffer, nullptr);
-        vkFreeMemory(ctx->m_LogicalDevice.GetHandle(), m_BufferMemory, nullptr);
+        m_Buffer.Destroy(context.As<VulkanGraphicsContext>()->m_LogicalDevice);
     }
 
-    bool VertexBuffer::SetData(LogicalDevice& device, PhysicalDevice& physicalDevice,
-        CommandPool& commandPool, const void* data, std::size_t size) {
-        VkBuffer       stagingBuffer       = VK_NULL_HANDLE;
-        VkDeviceMemory stagingBufferMemory = VK_NULL_HANDLE;
-        if (!CreateBuffer(physicalDevice.GetHandle(), device.GetHandle(), size,
-                VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                stagingBuffer, stagingBufferMemory)) {
-            return false;
-        }
-        vkBindBufferMemory(device.GetHandle(), stagingBuffer, stagingBufferMemory, 0);
-
-        void* mappedData = nullptr;
-        vkMapMemory(device.GetHandle(), stagingBufferMemory, 0, size, 0, &mappedData);
-        memcpy(mappedData, data, size);
-        vkUnmapMemory(device.GetHandle(), stagingBufferMemory);
-
-        if (!CopyBuffer(device.GetHandle(), device.GetGraphicsQueue(), commandPool.GetHandle(),
-                stagingBuffer, m_Buffer, size)) {
-            return false;
-        }
-
-        vkDestroyBuffer(device.GetHandle(), stagingBuffer, nullptr);
-        vkFreeMemory(device.GetHandle(), stagingBufferMemory, nullptr);
-
-        return true;
+    bool VertexBuffer::Reserve(RefPtr<GraphicsContext>& context, std::size_t size) {
+        auto ctx = context.As<VulkanGraphicsContext>();
+        return m_Buffer.Reserve(
+            ctx->m_LogicalDevice, ctx->m_PhysicalDevice, ctx->GetCurrentFrameIndex(), size);
     }
 
-    bool VertexBuffer::SetData(
-        RefPtr<Astrelis::GraphicsContext>& context, const void* data, std::size_t size) {
-        auto ctx = context.As<VulkanGraphicsContext>();
-        return SetData(ctx->m_LogicalDevice, ctx->m_PhysicalDevice, ctx->m_CommandPool, data, size);
+    bool VertexBuffer::SetData(RefPtr<Astrelis::GraphicsContext>& context, const void* data,
+        std::size_t size, std::size_t offset) {
+        return m_Buffer.Write(context->GetCurrentFrameIndex(), data, size, offset);
     }
 
-    void VertexBuffer::Bind(CommandBuffer& buffer, std::uint32_t binding) const {
-        std::array<VkBuffer, 1>     buffers = {m_Buffer};
+    void VertexBuffer::Bind(
+        CommandBuffer& buffer, std::uint32_t frame, std::uint32_t binding) const {
+        std::array<VkBuffer, 1>     buffers = {m_Buffer.GetHandle(frame)};
         std::array<VkDeviceSize, 1> offsets = {0};
         vkCmdBindVertexBuffers(
             buffer.GetHandle(), binding, buffers.size(), buffers.data(), offsets.data());
     }
 
     void VertexBuffer::Bind(RefPtr<GraphicsContext>& context, std::uint32_t binding) const {
-        Bind(context.As<VulkanGraphicsContext>()->GetCurrentFrame().CommandBuffer, binding);
+        auto ctx = context.As<VulkanGraphicsContext>();
+        Bind(ctx->GetCurrentFrame().CommandBuffer, ctx->GetCurrentFrameIndex(), binding);
     }
 } // namespace Astrelis::Vulkan
@@ -3,14 +3,9 @@
 #include "Astrelis/Renderer/VertexBuffer.hpp"
 
 #include "CommandBuffer.hpp"
-#include "CommandPool.hpp"
 #include "LogicalDevice.hpp"
 #include "PhysicalDevice.hpp"
-
-//#include <vulkan/vulkan.h>
-
-typedef struct VkBuffer_T*       VkBuffer;
-typedef struct VkDeviceMemory_T* VkDeviceMemory;
+#include "StreamingBuffer.hpp"
 
 namespace Astrelis::Vulkan {
     class VertexBuffer : public Astrelis::VertexBuffer {
@@ -19,22 +14,20 @@ namespace Astrelis::Vulkan {
         ~VertexBuffer() override                     = default;
         VertexBuffer(const VertexBuffer&)            = delete;
         VertexBuffer& operator=(const VertexBuffer&) = delete;
-        VertexBuffer(VertexBuffer&&)                 = delete;
-        VertexBuffer& operator=(VertexBuffer&&)      = delete;
+        VertexBuffer(VertexBuffer&&)                 = default;
+        VertexBuffer& operator=(VertexBuffer&&)      = default;
 
-        [[nodiscard]] bool Init(
-            LogicalDevice& device, PhysicalDevice& physicalDevice, std::size_t size);
+        [[nodiscard]] bool Init(LogicalDevice& device, PhysicalDevice& physicalDevice,
+            std::size_t size, std::uint32_t frameCount);
         [[nodiscard]] bool Init(RefPtr<GraphicsContext>& context, std::size_t size) override;
         void               Destroy(RefPtr<GraphicsContext>& context) override;
 
-        [[nodiscard]] bool SetData(LogicalDevice& device, PhysicalDevice& physicalDevice,
-            CommandPool& commandPool, const void* data, std::size_t size);
-        [[nodiscard]] bool SetData(
-            RefPtr<GraphicsContext>& context, const void* data, std::size_t size) override;
-        void Bind(CommandBuffer& buffer, std::uint32_t binding) const;
+        [[nodiscard]] bool Reserve(RefPtr<GraphicsContext>& context, std::size_t size) override;
+        [[nodiscard]] bool SetData(RefPtr<GraphicsContext>& context, const void* data,
+            std::size_t size, std::size_t offset) override;
+        void Bind(CommandBuffer& buffer, std::uint32_t frame, std::uint32_t binding) const;
         void Bind(RefPtr<GraphicsContext>& context, std::uint32_t binding) const override;
     private:
-        VkBuffer       m_Buffer       = nullptr;
-        VkDeviceMemory m_BufferMemory = nullptr;
+        StreamingBuffer m_Buffer;
     };
 } // namespace Astrelis::Vulkan
@@ -23,6 +23,30 @@ namespace Astrelis {
     void Vulkan2DRendererAPI::Shutdown() {
         ASTRELIS_CORE_ASSERT(
             m_Context->IsInitialized(), "RendererAPI should be destroyed before GraphicsContext!");
+
+        Vulkan::ResourceRegistry& resources = m_Context->m_Resources;
+        if (resources.GetResourceCount() != 0) {
+            ASTRELIS_CORE_LOG_WARN("Destroying {0} renderer resources that were not destroyed",
+                resources.GetResourceCount());
+        }
+
+        auto context = static_cast<RefPtr<GraphicsContext>>(m_Context);
+        for (auto& buffer : resources.VertexBuffers) {
+            buffer.Destroy(context);
+        }
+        for (auto& buffer : resources.IndexBuffers) {
+            buffer.Destroy(context);
+        }
+        for (auto& buffer : resources.UniformBuffers) {
+            buffer.Destroy(context);
+        }
+        for (auto& image : resources.TextureImages) {
+            image.Destroy(context);
+        }
+        for (auto& sampler : resources.TextureSamplers) {
+            sampler.Destroy(context);
+        }
+        resources = Vulkan::ResourceRegistry();
     }
 
     void Vulkan2DRendererAPI::SetViewport(Rect3Df& viewport) {
@@ -77,30 +101,89 @@ namespace Astrelis {
         return static_cast<RefPtr<GraphicsPipeline>>(RefPtr<Vulkan::GraphicsPipeline>::Create());
     }
 
-    RefPtr<VertexBuffer> Vulkan2DRendererAPI::CreateVertexBuffer() {
-        return static_cast<RefPtr<VertexBuffer>>(RefPtr<Vulkan::VertexBuffer>::Create());
-    }
-
-    RefPtr<IndexBuffer> Vulkan2DRendererAPI::CreateIndexBuffer() {
-        return static_cast<RefPtr<IndexBuffer>>(RefPtr<Vulkan::IndexBuffer>::Create());
-    }
-
     RefPtr<BindingDescriptorSet> Vulkan2DRendererAPI::CreateBindingDescriptorSet(
         BindingDescriptorSet::Mode mode) {
         return static_cast<RefPtr<BindingDescriptorSet>>(
             RefPtr<Vulkan::BindingDescriptorSet>::Create(mode));
     }
 
-    RefPtr<UniformBuffer> Vulkan2DRendererAPI::CreateUniformBuffer() {
-        return static_cast<RefPtr<UniformBuffer>>(RefPtr<Vulkan::UniformBuffer>::Create());
+    VertexBufferHandle Vulkan2DRendererAPI::CreateVertexBuffer() {
+        AssertResourcesUnused();
+        return m_Context->m_Resources.VertexBuffers.Emplace();
+    }
+
+    IndexBufferHandle Vulkan2DRendererAPI::CreateIndexBuffer() {
+        AssertResourcesUnused();
+        return m_Context->m_Resources.IndexBuffers.Emplace();
+    }
+
+    UniformBufferHandle Vulkan2DRendererAPI::CreateUniformBuffer() {
+        AssertResourcesUnused();
+        return m_Context->m_Resources.UniformBuffers.Emplace();
+    }
+
+    TextureImageHandle Vulkan2DRendererAPI::CreateTextureImage() {
+        AssertResourcesUnused();
+        return m_Context->m_Resources.TextureImages.Emplace();
+    }
+
+    TextureSamplerHandle Vulkan2DRendererAPI::CreateTextureSampler() {
+        AssertResourcesUnused();
+        return m_Context->m_Resources.TextureSamplers.Emplace();
+    }
+
+    VertexBuffer* Vulkan2DRendererAPI::Get(VertexBufferHandle handle) {
+        return m_Context->m_Resources.VertexBuffers.Get(handle);
+    }
+
+    IndexBuffer* Vulkan2DRendererAPI::Get(IndexBufferHandle handle) {
+        return m_Context->m_Resources.IndexBuffers.Get(handle);
+    }
+
+    UniformBuffer* Vulkan2DRendererAPI::Get(UniformBufferHandle handle) {
+        return m_Context->m_Resources.UniformBuffers.Get(handle);
+    }
+
+    TextureImage* Vulkan2DRendererAPI::Get(TextureImageHandle handle) {
+        return m_Context->m_Resources.TextureImages.Get(handle);
+    }
+
+    TextureSampler* Vulkan2DRendererAPI::Get(TextureSamplerHandle handle) {
+        return m_Context->m_Resources.TextureSamplers.Get(handle);
+    }
+
+    template<typename T, typename Interface>
+    void Vulkan2DRendererAPI::DestroyResource(
+        SlotMap<T, Interface>& resources, Handle<Interface> handle) {
+        AssertResourcesUnused();
+        T* resource = resources.Get(handle);
+        if (resource == nullptr) {
+            return;
+        }
+
+        auto context = static_cast<RefPtr<GraphicsContext>>(m_Context);
+        resource->Destroy(context);
+        resources.Remove(handle);
+    }
+
+    void Vulkan2DRendererAPI::Destroy(VertexBufferHandle handle) {
+        DestroyResource(m_Context->m_Resources.VertexBuffers, handle);
+    }
+
+    void Vulkan2DRendererAPI::Destroy(IndexBufferHandle handle) {
+        DestroyResource(m_Context->m_Resources.IndexBuffers, handle);
+    }
+
+    void Vulkan2DRendererAPI::Destroy(UniformBufferHandle handle) {
+        DestroyResource(m_Context->m_Resources.UniformBuffers, handle);
     }
 
-    RefPtr<TextureImage> Vulkan2DRendererAPI::CreateTextureImage() {
-        return static_cast<RefPtr<TextureImage>>(RefPtr<Vulkan::TextureImage>::Create());
+    void Vulkan2DRendererAPI::Destroy(TextureImageHandle handle) {
+        DestroyResource(m_Context->m_Resources.TextureImages, handle);
     }
 
-    RefPtr<TextureSampler> Vulkan2DRendererAPI::CreateTextureSampler() {
-        return static_cast<RefPtr<TextureSampler>>(RefPtr<Vulkan::TextureSampler>::Create());
+    void Vulkan2DRendererAPI::Destroy(TextureSamplerHandle handle) {
+        DestroyResource(m_Context->m_Resources.TextureSamplers, handle);
     }
 
     RefPtr<Vulkan2DRendererAPI> Vulkan2DRendererAPI::Create(RefPtr<VulkanGraphicsContext> context) {
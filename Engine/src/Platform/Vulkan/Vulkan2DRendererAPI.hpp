@@ -40,16 +40,32 @@ namespace Astrelis {
         void CorrectProjection(Mat4f& projection) override;
 
         RefPtr<GraphicsPipeline>     CreateGraphicsPipeline() override;
-        RefPtr<VertexBuffer>         CreateVertexBuffer() override;
-        RefPtr<IndexBuffer>          CreateIndexBuffer() override;
         RefPtr<BindingDescriptorSet> CreateBindingDescriptorSet(
             BindingDescriptorSet::Mode mode) override;
-        RefPtr<UniformBuffer>  CreateUniformBuffer() override;
-        RefPtr<TextureImage>   CreateTextureImage() override;
-        RefPtr<TextureSampler> CreateTextureSampler() override;
+
+        VertexBufferHandle   CreateVertexBuffer() override;
+        IndexBufferHandle    CreateIndexBuffer() override;
+        UniformBufferHandle  CreateUniformBuffer() override;
+        TextureImageHandle   CreateTextureImage() override;
+        TextureSamplerHandle CreateTextureSampler() override;
+
+        VertexBuffer*   Get(VertexBufferHandle handle) override;
+        IndexBuffer*    Get(IndexBufferHandle handle) override;
+        UniformBuffer*  Get(UniformBufferHandle handle) override;
+        TextureImage*   Get(TextureImageHandle handle) override;
+        TextureSampler* Get(TextureSamplerHandle handle) override;
+
+        void Destroy(VertexBufferHandle handle) override;
+        void Destroy(IndexBufferHandle handle) override;
+        void Destroy(UniformBufferHandle handle) override;
+        void Destroy(TextureImageHandle handle) override;
+        void Destroy(TextureSamplerHandle handle) override;
 
         static RefPtr<Vulkan2DRendererAPI> Create(RefPtr<VulkanGraphicsContext> context);
     private:
+        template<typename T, typename Interface>
+        void DestroyResource(SlotMap<T, Interface>& resources, Handle<Interface> handle);
+
         RefPtr<VulkanGraphicsContext> m_Context;
     };
 } // namespace Astrelis
@@ -77,6 +77,12 @@ namespace Astrelis {
             return "Failed to initialize Vulkan Command Pool!";
         }
 
+        // Init runs on the main thread, afterwards the size is passed in through SetFramebufferSize
+        int width  = 0;
+        int height = 0;
+        glfwGetFramebufferSize(m_Window, &width, &height);
+        m_FramebufferSize = {static_cast<std::uint32_t>(width), static_cast<std::uint32_t>(height)};
+
         auto result = CreateSwapchain();
         if (result.IsErr()) {
             return result.UnwrapErr();
@@ -258,7 +264,7 @@ namespace Astrelis {
 
     Result<EmptyType, std::string> VulkanGraphicsContext::CreateSwapchain() {
         std::uint32_t swapChainFrameCount = m_MaxFramesInFlight;
-        if (!m_Swapchain.Init(m_Window, m_PhysicalDevice, m_LogicalDevice, m_Surface,
+        if (!m_Swapchain.Init(m_FramebufferSize, m_PhysicalDevice, m_LogicalDevice, m_Surface,
                 swapChainFrameCount, m_VSync)) {
             return "Failed to initialize Vulkan Swap Chain!";
         }
@@ -475,14 +481,21 @@ namespace Astrelis {
         m_CurrentFrame = (m_CurrentFrame + 1) % m_MaxFramesInFlight;
     }
 
+    void VulkanGraphicsContext::SetFramebufferSize(Dimension2Du size) {
+        if (size.Width == m_FramebufferSize.width && size.Height == m_FramebufferSize.height) {
+            return;
+        }
+
+        // Not every surface reports a resize as out of date
+        m_FramebufferSize     = {size.Width, size.Height};
+        m_SwapchainRecreation = true;
+    }
+
     void VulkanGraphicsContext::RecreateSwapChain() {
         ASTRELIS_PROFILE_FUNCTION();
-        int width  = 0;
-        int height = 0;
-        glfwGetFramebufferSize(m_Window, &width, &height);
-        while (width == 0 || height == 0) {
-            glfwGetFramebufferSize(m_Window, &width, &height);
-            glfwWaitEvents();
+        if (m_FramebufferSize.width == 0 || m_FramebufferSize.height == 0) {
+            // Minimized, it stays flagged for recreation until the window is restored
+            return;
         }
 
         vkDeviceWaitIdle(m_LogicalDevice.GetHandle());
@@ -19,6 +19,7 @@
 #include "VK/LogicalDevice.hpp"
 #include "VK/PhysicalDevice.hpp"
 #include "VK/RenderPass.hpp"
+#include "VK/ResourceRegistry.hpp"
 #include "VK/Semaphore.hpp"
 #include "VK/Surface.hpp"
 #include "VK/SwapChain.hpp"
@@ -71,6 +72,7 @@ namespace Astrelis {
             return m_SkipFrame;
         }
 
+        void SetFramebufferSize(Dimension2Du size) override;
         void RecreateSwapChain();
 
         bool IsInitialized() const override {
@@ -110,9 +112,15 @@ namespace Astrelis {
         Vulkan::SwapChain      m_Swapchain;
         Vulkan::DescriptorPool m_DescriptorPool;
 
+        // Resources created through the renderer API, @see Vulkan2DRendererAPI
+        Vulkan::ResourceRegistry m_Resources;
+
         std::vector<SwapChainFrame> m_SwapChainFrames;
         std::vector<FrameData>      m_Frames;
 
+        // The size of the window framebuffer, the window system is only queried on the main thread
+        VkExtent2D m_FramebufferSize {0, 0};
+
         VkOffset2D         m_GraphicsOffset {0, 0};
         VkExtent2D         m_GraphicsExtent {0, 0};
         Vulkan::RenderPass m_GraphicsRenderPass;
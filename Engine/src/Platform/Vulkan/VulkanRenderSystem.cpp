@@ -7,6 +7,8 @@
 
 #include <vulkan/vulkan.h>
 
+#include <array>
+
 #include "Platform/Vulkan/VK/TextureSampler.hpp"
 #include "Platform/Vulkan/VK/Utils.hpp"
 #include "Platform/Vulkan/VK/VulkanExt.hpp"
@@ -53,7 +55,7 @@ namespace Astrelis {
                 frame.CommandBuffer.GetHandle(), "GraphicsRender", {0.0F, 1.0F, 0.0F, 1.0F});
         }
 #endif
-        std::vector<VkClearValue> clearValues(2);
+        std::array<VkClearValue, 2> clearValues {};
         clearValues[0].color = {
             {0.0F, 0.0F, 0.0F, 1.0F}
         };
@@ -80,7 +82,7 @@ namespace Astrelis {
         }
 #endif
 
-        std::vector<VkClearValue> clearValues(2);
+        std::array<VkClearValue, 2> clearValues {};
         clearValues[0].color = {
             {0.0F, 0.0F, 0.0F, 1.0F}
         };
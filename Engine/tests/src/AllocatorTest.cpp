@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include "Astrelis/Core/Allocator.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <vector>
+
+using Astrelis::Allocator, Astrelis::MemoryTag, Astrelis::MemoryTracker, Astrelis::StlAllocator;
+
+TEST(AllocatorTest, TrackingAllocatorCountsLiveAndPeakBytes)
+{
+    // No engine container uses the editor tag, so the counters only change here
+    Astrelis::TrackingAllocator allocator(MemoryTag::Editor);
+    const auto                  before = MemoryTracker::GetStats(MemoryTag::Editor);
+
+    void* first  = allocator.Allocate(100, 8);
+    void* second = allocator.Allocate(300, 64);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(second) % 64, 0);
+    auto stats = MemoryTracker::GetStats(MemoryTag::Editor);
+    EXPECT_EQ(stats.LiveBytes - before.LiveBytes, 400);
+    EXPECT_EQ(stats.LiveAllocations - before.LiveAllocations, 2);
+    EXPECT_GE(stats.PeakBytes, before.LiveBytes + 400);
+
+    allocator.Deallocate(second, 300, 64);
+    allocator.Deallocate(first, 100, 8);
+    stats = MemoryTracker::GetStats(MemoryTag::Editor);
+    EXPECT_EQ(stats.LiveBytes, before.LiveBytes);
+    EXPECT_EQ(stats.LiveAllocations, before.LiveAllocations);
+    EXPECT_EQ(stats.TotalAllocations - before.TotalAllocations, 2);
+    EXPECT_GE(stats.PeakBytes, before.LiveBytes + 400);
+}
+
+TEST(AllocatorTest, TaggedContainers)
+{
+    const auto before = MemoryTracker::GetStats(MemoryTag::Editor);
+    {
+        std::vector<int, StlAllocator<int>> values {StlAllocator<int>(MemoryTag::Editor)};
+        values.resize(1000);
+        EXPECT_GE(MemoryTracker::GetStats(MemoryTag::Editor).LiveBytes - before.LiveBytes,
+            1000 * sizeof(int));
+    }
+    EXPECT_EQ(MemoryTracker::GetStats(MemoryTag::Editor).LiveBytes, before.LiveBytes);
+    EXPECT_EQ(&Allocator::GetTagged(MemoryTag::Editor), &Allocator::GetTagged(MemoryTag::Editor));
+    EXPECT_STREQ(Astrelis::GetMemoryTagName(MemoryTag::Renderer), "Renderer");
+}
+
+TEST(AllocatorTest, PoolReusesBlocks)
+{
+    Astrelis::PoolAllocator pool(24, 4);
+    EXPECT_EQ(pool.GetBlockSize() % alignof(std::max_align_t), 0);
+
+    std::vector<void*> blocks;
+    for (int i = 0; i < 6; i++) {
+        blocks.push_back(pool.Allocate(24, 8));
+    }
+    EXPECT_EQ(pool.GetChunkCount(), 2);
+
+    // Freed blocks are handed out again before the pool grows
+    void* freed = blocks[2];
+    pool.Deallocate(freed, 24, 8);
+    EXPECT_EQ(pool.Allocate(24, 8), freed);
+    for (int i = 0; i < 2; i++) {
+        blocks.push_back(pool.Allocate(24, 8));
+    }
+    EXPECT_EQ(pool.GetChunkCount(), 2);
+    for (void* block : blocks) {
+        pool.Deallocate(block, 24, 8);
+    }
+}
+
+TEST(AllocatorTest, PoolBacksNodeContainers)
+{
+    Astrelis::TrackingAllocator tracking(MemoryTag::Editor);
+    const auto                  before = MemoryTracker::GetStats(MemoryTag::Editor);
+    {
+        Astrelis::PoolAllocator                               pool(64, 16, tracking);
+        std::list<std::uint64_t, StlAllocator<std::uint64_t>> values {
+            StlAllocator<std::uint64_t>(pool)};
+        for (std::uint64_t i = 0; i < 100; i++) {
+            values.push_back(i);
+        }
+        values.clear();
+        for (std::uint64_t i = 0; i < 100; i++) {
+            values.push_back(i);
+        }
+        // Only the chunks reach the upstream allocator
+        const auto stats = MemoryTracker::GetStats(MemoryTag::Editor);
+        EXPECT_EQ(stats.LiveAllocations - before.LiveAllocations, pool.GetChunkCount());
+    }
+    EXPECT_EQ(MemoryTracker::GetStats(MemoryTag::Editor).LiveBytes, before.LiveBytes);
+}
+
+TEST(AllocatorTest, LinearAllocatorUsesTheArena)
+{
+    Astrelis::LinearArena     arena(1024);
+    Astrelis::LinearAllocator allocator(arena);
+    {
+        std::vector<float, StlAllocator<float>> values {StlAllocator<float>(allocator)};
+        values.resize(16);
+    }
+    EXPECT_GE(arena.GetUsedBytes(), 16 * sizeof(float));
+    arena.Reset();
+    EXPECT_EQ(arena.GetUsedBytes(), 0);
+}
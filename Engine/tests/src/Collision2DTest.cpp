@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include "Astrelis/Physics2D/Collision2D.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using Astrelis::Manifold2D, Astrelis::RigidTransform2D, Astrelis::Shape2D;
+
+TEST(Collision2DTest, CircleBatchMatchesSingle)
+{
+    std::mt19937                          random(3);
+    std::uniform_real_distribution<float> coordinate(-2.0F, 2.0F);
+    std::uniform_real_distribution<float> radius(0.1F, 1.0F);
+
+    // Not a multiple of four, so the scalar tail runs as well
+    Astrelis::CirclePairs2D pairs;
+    for (int i = 0; i < 37; i++) {
+        pairs.Add(coordinate(random), coordinate(random), radius(random), coordinate(random),
+            coordinate(random), radius(random));
+    }
+    // Coincident centres
+    pairs.Add(1.0F, 1.0F, 0.5F, 1.0F, 1.0F, 0.5F);
+
+    std::vector<Manifold2D> manifolds(pairs.GetCount());
+    Astrelis::CollideCircles(pairs, 0.02F, manifolds);
+
+    std::size_t touching = 0;
+    for (std::size_t i = 0; i < pairs.GetCount(); i++) {
+        Manifold2D expected;
+        const bool hit = Astrelis::Collide(Shape2D::Circle(pairs.RadiusA[i]),
+            RigidTransform2D {pairs.AX[i], pairs.AY[i]}, Shape2D::Circle(pairs.RadiusB[i]),
+            RigidTransform2D {pairs.BX[i], pairs.BY[i]}, 0.02F, expected);
+        ASSERT_EQ(manifolds[i].PointCount, hit ? 1 : 0);
+        if (hit) {
+            touching++;
+            EXPECT_NEAR(manifolds[i].NormalX, expected.NormalX, 1.0e-5F);
+            EXPECT_NEAR(manifolds[i].NormalY, expected.NormalY, 1.0e-5F);
+            EXPECT_NEAR(manifolds[i].Points[0].X, expected.Points[0].X, 1.0e-5F);
+            EXPECT_NEAR(manifolds[i].Points[0].Y, expected.Points[0].Y, 1.0e-5F);
+            EXPECT_NEAR(manifolds[i].Points[0].Separation, expected.Points[0].Separation, 1.0e-5F);
+        }
+    }
+    EXPECT_GT(touching, 0);
+    EXPECT_LT(touching, pairs.GetCount());
+    EXPECT_FLOAT_EQ(manifolds.back().NormalY, 1.0F);
+    EXPECT_FLOAT_EQ(manifolds.back().Points[0].Separation, -1.0F);
+}
+
+TEST(Collision2DTest, BoxOnBoxHasTwoPoints)
+{
+    const Shape2D ground = Shape2D::Box(2.0F, 0.5F);
+    const Shape2D box    = Shape2D::Box(0.5F, 0.5F);
+
+    Manifold2D manifold;
+    ASSERT_TRUE(Astrelis::Collide(ground, RigidTransform2D {}, box,
+        RigidTransform2D {0.25F, 0.99F}, 0.02F, manifold));
+    EXPECT_NEAR(manifold.NormalX, 0.0F, 1.0e-6F);
+    EXPECT_NEAR(manifold.NormalY, 1.0F, 1.0e-6F);
+    ASSERT_EQ(manifold.PointCount, 2);
+    std::array<float, 2> pointX {manifold.Points[0].X, manifold.Points[1].X};
+    std::sort(pointX.begin(), pointX.end());
+    EXPECT_NEAR(pointX[0], -0.25F, 1.0e-5F);
+    EXPECT_NEAR(pointX[1], 0.75F, 1.0e-5F);
+    for (std::uint32_t i = 0; i < manifold.PointCount; i++) {
+        EXPECT_NEAR(manifold.Points[i].Separation, -0.01F, 1.0e-5F);
+        EXPECT_NEAR(manifold.Points[i].Y, 0.495F, 1.0e-5F);
+    }
+    EXPECT_NE(manifold.Points[0].Id, manifold.Points[1].Id);
+
+    // Swapping the shapes flips the normal
+    ASSERT_TRUE(Astrelis::Collide(box, RigidTransform2D {0.25F, 0.99F}, ground,
+        RigidTransform2D {}, 0.02F, manifold));
+    EXPECT_NEAR(manifold.NormalY, -1.0F, 1.0e-6F);
+
+    // A box standing on its corner, just above the margin
+    const auto corner = RigidTransform2D::FromAngle(0.0F, 0.5F + 0.7072F + 0.03F, 0.785398F);
+    EXPECT_FALSE(
+        Astrelis::Collide(ground, RigidTransform2D {}, box, corner, 0.02F, manifold));
+    const auto touching = RigidTransform2D::FromAngle(0.0F, 0.5F + 0.7F, 0.785398F);
+    ASSERT_TRUE(
+        Astrelis::Collide(ground, RigidTransform2D {}, box, touching, 0.02F, manifold));
+    EXPECT_EQ(manifold.PointCount, 1);
+    EXPECT_NEAR(manifold.Points[0].X, 0.0F, 1.0e-4F);
+}
+
+TEST(Collision2DTest, CircleAgainstPolygon)
+{
+    const Shape2D box    = Shape2D::Box(1.0F, 1.0F);
+    const Shape2D circle = Shape2D::Circle(0.5F);
+
+    // Against the face
+    Manifold2D manifold;
+    ASSERT_TRUE(Astrelis::Collide(
+        box, RigidTransform2D {}, circle, RigidTransform2D {1.4F, 0.2F}, 0.0F, manifold));
+    EXPECT_NEAR(manifold.NormalX, 1.0F, 1.0e-6F);
+    EXPECT_NEAR(manifold.Points[0].Separation, -0.1F, 1.0e-5F);
+    EXPECT_NEAR(manifold.Points[0].X, 0.95F, 1.0e-5F);
+
+    // Against the corner, from the other side
+    ASSERT_TRUE(Astrelis::Collide(
+        circle, RigidTransform2D {1.3F, 1.3F}, box, RigidTransform2D {}, 0.0F, manifold));
+    EXPECT_NEAR(manifold.NormalX, -0.707107F, 1.0e-5F);
+    EXPECT_NEAR(manifold.NormalY, -0.707107F, 1.0e-5F);
+    EXPECT_NEAR(manifold.Points[0].Separation, 0.3F * 1.414214F - 0.5F, 1.0e-5F);
+    EXPECT_FALSE(Astrelis::Collide(
+        circle, RigidTransform2D {1.4F, 1.4F}, box, RigidTransform2D {}, 0.0F, manifold));
+
+    // The centre inside the polygon
+    ASSERT_TRUE(Astrelis::Collide(
+        box, RigidTransform2D {}, circle, RigidTransform2D {0.0F, -0.8F}, 0.0F, manifold));
+    EXPECT_NEAR(manifold.NormalY, -1.0F, 1.0e-6F);
+    EXPECT_NEAR(manifold.Points[0].Separation, -0.7F, 1.0e-5F);
+}
+
+TEST(Collision2DTest, ConvexHull)
+{
+    // The interior and the duplicate point are dropped, the hull is centred on its centroid
+    const std::vector<Astrelis::Vec2f> points {Astrelis::Vec2f(1.0F, 1.0F),
+        Astrelis::Vec2f(3.0F, 1.0F), Astrelis::Vec2f(2.0F, 2.0F), Astrelis::Vec2f(3.0F, 3.0F),
+        Astrelis::Vec2f(1.0F, 3.0F), Astrelis::Vec2f(3.0F, 3.0F)};
+    const auto hull = Shape2D::ConvexHull(points);
+    ASSERT_TRUE(hull.has_value());
+    EXPECT_EQ(hull->VertexCount, 4);
+    EXPECT_NEAR(hull->GetArea(), 4.0F, 1.0e-5F);
+    EXPECT_NEAR(hull->GetUnitInertia(), Shape2D::Box(1.0F, 1.0F).GetUnitInertia(), 1.0e-5F);
+    EXPECT_NEAR(hull->Radius, 1.414214F, 1.0e-5F);
+    for (std::uint32_t i = 0; i < hull->VertexCount; i++) {
+        EXPECT_NEAR(std::abs(hull->VertexX[i]), 1.0F, 1.0e-5F);
+        EXPECT_NEAR(std::abs(hull->VertexY[i]), 1.0F, 1.0e-5F);
+    }
+
+    const std::vector<Astrelis::Vec2f> line {
+        Astrelis::Vec2f(0.0F, 0.0F), Astrelis::Vec2f(1.0F, 1.0F), Astrelis::Vec2f(2.0F, 2.0F)};
+    EXPECT_FALSE(Shape2D::ConvexHull(line).has_value());
+}
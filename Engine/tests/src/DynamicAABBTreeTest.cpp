@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include "Astrelis/Scene/DynamicAABBTree.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+using Astrelis::DynamicAABBTree, Astrelis::Point2Df, Astrelis::Rect2Df;
+
+namespace {
+    bool Overlaps(const Rect2Df& lhs, const Rect2Df& rhs) {
+        return lhs.X() <= rhs.X() + rhs.Width() && rhs.X() <= lhs.X() + lhs.Width()
+            && lhs.Y() <= rhs.Y() + rhs.Height() && rhs.Y() <= lhs.Y() + lhs.Height();
+    }
+
+    std::vector<std::uint32_t> UserData(
+        const DynamicAABBTree& tree, std::span<const std::uint32_t> proxies) {
+        std::vector<std::uint32_t> userData;
+        for (std::uint32_t proxy : proxies) {
+            userData.push_back(tree.GetUserData(proxy));
+        }
+        std::sort(userData.begin(), userData.end());
+        return userData;
+    }
+} // namespace
+
+TEST(DynamicAABBTreeTest, QueriesMatchBruteForceWhileMoving)
+{
+    std::mt19937                          random(7);
+    std::uniform_real_distribution<float> coordinate(-100.0F, 100.0F);
+    // Sizes over three orders of magnitude
+    std::uniform_real_distribution<float> exponent(-1.0F, 2.0F);
+    const auto                            randomRect = [&]() {
+        return Rect2Df(coordinate(random), coordinate(random), std::pow(10.0F, exponent(random)),
+            std::pow(10.0F, exponent(random)));
+    };
+
+    DynamicAABBTree            tree;
+    std::vector<Rect2Df>       bounds;
+    std::vector<std::uint32_t> proxies;
+    for (std::uint32_t i = 0; i < 1'000; i++) {
+        bounds.push_back(randomRect());
+        proxies.push_back(tree.CreateProxy(bounds.back(), i));
+    }
+    EXPECT_EQ(tree.GetProxyCount(), 1'000);
+    // A balanced tree of 1000 leaves is about 10 levels deep
+    EXPECT_LT(tree.GetHeight(), 20);
+
+    std::vector<std::uint32_t> results;
+    for (int round = 0; round < 5; round++) {
+        for (std::size_t i = 0; i < bounds.size(); i += 3) {
+            bounds[i] = randomRect();
+            tree.MoveProxy(proxies[i], bounds[i]);
+        }
+
+        for (int query = 0; query < 20; query++) {
+            const Rect2Df              view = randomRect();
+            std::vector<std::uint32_t> expected;
+            for (std::uint32_t i = 0; i < bounds.size(); i++) {
+                if (Overlaps(view, bounds[i])) {
+                    expected.push_back(i);
+                }
+            }
+            EXPECT_EQ(UserData(tree, tree.QueryRect(view, results)), expected);
+        }
+    }
+    EXPECT_LT(tree.GetHeight(), 20);
+}
+
+TEST(DynamicAABBTreeTest, SmallMovesKeepTheFatBounds)
+{
+    DynamicAABBTree     tree(0.5F);
+    const std::uint32_t proxy = tree.CreateProxy(Rect2Df(0.0F, 0.0F, 1.0F, 1.0F), 3);
+    EXPECT_FALSE(tree.MoveProxy(proxy, Rect2Df(0.25F, 0.0F, 1.0F, 1.0F)));
+    EXPECT_TRUE(tree.MoveProxy(
+        proxy, Rect2Df(2.0F, 0.0F, 1.0F, 1.0F), Astrelis::Vec2f(1.75F, 0.0F)));
+
+    // The fat bounds are extended ahead of the motion
+    const Rect2Df fat = tree.GetFatBounds(proxy);
+    EXPECT_FLOAT_EQ(fat.X(), 1.5F);
+    EXPECT_FLOAT_EQ(fat.X() + fat.Width(), 3.5F + 3.5F);
+
+    // Queries still use the exact bounds
+    std::vector<std::uint32_t> results;
+    EXPECT_TRUE(tree.QueryPoint(Point2Df(1.75F, 0.5F), results).empty());
+    EXPECT_EQ(UserData(tree, tree.QueryPoint(Point2Df(2.5F, 0.5F), results)),
+        (std::vector<std::uint32_t> {3}));
+}
+
+TEST(DynamicAABBTreeTest, RayCastFindsClosest)
+{
+    DynamicAABBTree     tree;
+    const std::uint32_t far    = tree.CreateProxy(Rect2Df(8.0F, -1.0F, 1.0F, 2.0F), 0);
+    const std::uint32_t near   = tree.CreateProxy(Rect2Df(4.0F, -1.0F, 1.0F, 2.0F), 1);
+    const std::uint32_t beside = tree.CreateProxy(Rect2Df(2.0F, 5.0F, 1.0F, 1.0F), 2);
+
+    const auto hit = tree.RayCast(Point2Df(0.0F, 0.0F), Point2Df(10.0F, 0.0F));
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_EQ(hit->Proxy, near);
+    EXPECT_FLOAT_EQ(hit->Fraction, 0.4F);
+
+    tree.DestroyProxy(near);
+    EXPECT_EQ(tree.RayCast(Point2Df(0.0F, 0.0F), Point2Df(10.0F, 0.0F))->Proxy, far);
+    // Too short to reach anything
+    EXPECT_FALSE(tree.RayCast(Point2Df(0.0F, 0.0F), Point2Df(3.0F, 0.0F)).has_value());
+    EXPECT_EQ(tree.RayCast(Point2Df(2.5F, 0.0F), Point2Df(2.5F, 10.0F))->Proxy, beside);
+
+    tree.Clear();
+    EXPECT_EQ(tree.GetProxyCount(), 0);
+    EXPECT_FALSE(tree.RayCast(Point2Df(0.0F, 0.0F), Point2Df(10.0F, 0.0F)).has_value());
+}
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include "Astrelis/Events/EventLog.hpp"
+#include "Astrelis/Events/KeyEvent.hpp"
+#include "Astrelis/Events/MouseEvent.hpp"
+#include "Astrelis/Events/WindowEvent.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using Astrelis::EventLog, Astrelis::EventRecord, Astrelis::EventType, Astrelis::Milliseconds;
+
+namespace {
+    Milliseconds Millis(double value) {
+        return Milliseconds(std::chrono::duration<double, std::milli>(value));
+    }
+
+    std::vector<std::string> ReplayFrame(const EventLog& log, std::size_t frame) {
+        std::vector<std::string> events;
+        for (const EventRecord& record : log.GetEvents(frame)) {
+            record.Dispatch(
+                [&events](Astrelis::Event& event) { events.push_back(event.ToString()); });
+        }
+        return events;
+    }
+} // namespace
+
+TEST(EventLogTest, RecordAndReplay)
+{
+    EventLog log;
+    EXPECT_FALSE(log.Record(EventRecord::Create(EventType::WindowClosed)));
+
+    log.BeginFrame(Millis(16.0));
+    EXPECT_TRUE(log.Record(EventRecord::Create(
+        EventType::KeyPressed, static_cast<std::uint32_t>(Astrelis::KeyCode::W), 1)));
+    EXPECT_TRUE(log.Record(EventRecord::CreateFloat(EventType::MouseMoved, 12.5F, -3.25F)));
+    EXPECT_FALSE(log.Record(EventRecord::Create(EventType::AppRender)));
+    log.BeginFrame(Millis(17.5));
+    log.BeginFrame(Millis(15.0));
+    EXPECT_TRUE(log.Record(EventRecord::Create(EventType::ViewportResized, 800, 600)));
+    EXPECT_TRUE(log.Record(EventRecord::Create(EventType::MouseButtonReleased,
+        static_cast<std::uint32_t>(Astrelis::MouseCode::ButtonRight))));
+
+    ASSERT_EQ(log.GetFrameCount(), 3);
+    EXPECT_EQ(log.GetEventCount(), 4);
+    EXPECT_DOUBLE_EQ(static_cast<double>(log.GetDeltaTime(1)), 17.5);
+
+    EXPECT_EQ(ReplayFrame(log, 0),
+        (std::vector<std::string> {
+            Astrelis::KeyPressedEvent(Astrelis::KeyCode::W, true).ToString(),
+            Astrelis::MouseMovedEvent(12.5F, -3.25F).ToString(),
+        }));
+    EXPECT_TRUE(ReplayFrame(log, 1).empty());
+    EXPECT_EQ(ReplayFrame(log, 2),
+        (std::vector<std::string> {
+            Astrelis::ViewportResizedEvent(800, 600).ToString(),
+            Astrelis::MouseButtonReleasedEvent(Astrelis::MouseCode::ButtonRight).ToString(),
+        }));
+}
+
+TEST(EventLogTest, SaveAndLoad)
+{
+    EventLog log;
+    log.BeginFrame(Millis(16.0));
+    log.Record(EventRecord::Create(
+        EventType::KeyTyped, static_cast<std::uint32_t>(Astrelis::KeyCode::A)));
+    log.BeginFrame(Millis(33.0));
+    log.Record(EventRecord::CreateFloat(EventType::MouseScrolled, 0.0F, 1.0F));
+    log.Record(EventRecord::Create(EventType::WindowClosed));
+
+    auto path = std::filesystem::temp_directory_path() / "astrelis_event_log.bin";
+    ASSERT_FALSE(log.Save(path).IsErr());
+    // Header, two 16 byte frames and three 12 byte events
+    EXPECT_EQ(std::filesystem::file_size(path), 16 + 2 * 16 + 3 * 12);
+
+    auto res = EventLog::Load(path);
+    ASSERT_FALSE(res.IsErr());
+    auto loaded = std::move(res.Unwrap());
+    ASSERT_EQ(loaded.GetFrameCount(), 2);
+    EXPECT_DOUBLE_EQ(static_cast<double>(loaded.GetDeltaTime(1)), 33.0);
+    EXPECT_TRUE(std::ranges::equal(loaded.GetEvents(0), log.GetEvents(0)));
+    EXPECT_TRUE(std::ranges::equal(loaded.GetEvents(1), log.GetEvents(1)));
+
+    std::filesystem::resize_file(path, 40);
+    EXPECT_TRUE(EventLog::Load(path).IsErr());
+    std::filesystem::remove(path);
+    EXPECT_TRUE(EventLog::Load(path).IsErr());
+}
+
+TEST(EventLogTest, LoadRejectsCorruptFiles)
+{
+    EventLog log;
+    log.BeginFrame(Millis(16.0));
+    log.Record(EventRecord::Create(EventType::WindowClosed));
+    log.BeginFrame(Millis(16.0));
+    log.Record(EventRecord::Create(EventType::ViewportResized, 800, 600));
+
+    auto path = std::filesystem::temp_directory_path() / "astrelis_corrupt_event_log.bin";
+    // Overwrites a 32 bit field of the saved log, the header is 16 bytes and each frame is 16 bytes
+    const auto loadPatched = [&log, &path](std::streamoff offset, std::uint32_t value) {
+        EXPECT_FALSE(log.Save(path).IsErr());
+        {
+            std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+            file.seekp(offset);
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+        return EventLog::Load(path);
+    };
+
+    EXPECT_FALSE(loadPatched(8, 2).IsErr());
+    // A frame count that the file is far too small for
+    EXPECT_TRUE(loadPatched(8, 0xFFFF'FFFF).IsErr());
+    EXPECT_TRUE(loadPatched(12, 3).IsErr());
+    // The first event of the second frame points past the events
+    EXPECT_TRUE(loadPatched(16 + 16 + 8, 2).IsErr());
+    EXPECT_TRUE(loadPatched(16 + 16 + 12, 0xFFFF'FFFF).IsErr());
+    // The type of the first event
+    EXPECT_TRUE(loadPatched(16 + 2 * 16, 0xFFFF).IsErr());
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include "Astrelis/Events/EventQueue.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using Astrelis::EventQueue, Astrelis::EventRecord, Astrelis::EventType;
+
+TEST(EventQueueTest, DrainInPostingOrder)
+{
+    auto queue = std::make_unique<EventQueue>();
+    EXPECT_TRUE(queue->Post(EventRecord::Create(EventType::KeyPressed, 65)));
+    EXPECT_TRUE(queue->Post(EventRecord::CreateFloat(EventType::MouseMoved, 1.5F, 2.0F)));
+    EXPECT_TRUE(queue->Post(EventRecord::Create(EventType::WindowClosed)));
+
+    std::vector<EventRecord> drained;
+    EXPECT_EQ(queue->Drain([&drained](const EventRecord& record) { drained.push_back(record); }),
+        3);
+    ASSERT_EQ(drained.size(), 3);
+    EXPECT_EQ(drained[0], EventRecord::Create(EventType::KeyPressed, 65));
+    EXPECT_FLOAT_EQ(drained[1].GetFloat0(), 1.5F);
+    EXPECT_FLOAT_EQ(drained[1].GetFloat1(), 2.0F);
+    EXPECT_EQ(drained[2].Type, EventType::WindowClosed);
+    EXPECT_EQ(queue->Drain([](const EventRecord&) {}), 0);
+}
+
+TEST(EventQueueTest, PostWhileDraining)
+{
+    auto        queue = std::make_unique<EventQueue>();
+    std::size_t count = 0;
+    queue->Post(EventRecord::Create(EventType::WindowRefresh));
+    queue->Drain([&queue, &count](const EventRecord&) {
+        queue->Post(EventRecord::Create(EventType::WindowRefresh));
+        count++;
+    });
+
+    // The record posted by the handler is left for the next drain
+    EXPECT_EQ(count, 1);
+    EXPECT_EQ(queue->Drain([](const EventRecord&) {}), 1);
+}
+
+TEST(EventQueueTest, FullQueueDrops)
+{
+    auto queue = std::make_unique<EventQueue>();
+    for (std::size_t i = 0; i < EventQueue::CAPACITY; i++) {
+        ASSERT_TRUE(queue->Post(EventRecord::Create(EventType::KeyTyped)));
+    }
+    EXPECT_FALSE(queue->Post(EventRecord::Create(EventType::KeyTyped)));
+    EXPECT_EQ(queue->GetDroppedCount(), 1);
+
+    // Slots are reused after draining
+    EXPECT_EQ(queue->Drain([](const EventRecord&) {}), EventQueue::CAPACITY);
+    for (std::size_t i = 0; i < EventQueue::CAPACITY; i++) {
+        ASSERT_TRUE(queue->Post(EventRecord::Create(EventType::KeyTyped)));
+    }
+    EXPECT_EQ(queue->Drain([](const EventRecord&) {}), EventQueue::CAPACITY);
+}
+
+TEST(EventQueueTest, MultipleProducers)
+{
+    constexpr std::uint32_t PRODUCER_COUNT = 4;
+    constexpr std::uint32_t RECORD_COUNT   = 10'000;
+
+    auto                       queue = std::make_unique<EventQueue>();
+    std::vector<std::thread>   producers;
+    std::vector<std::uint32_t> nextRecord(PRODUCER_COUNT, 0);
+    for (std::uint32_t producer = 0; producer < PRODUCER_COUNT; producer++) {
+        producers.emplace_back([&queue, producer]() {
+            for (std::uint32_t i = 0; i < RECORD_COUNT; i++) {
+                while (!queue->Post(EventRecord::Create(EventType::KeyTyped, producer, i))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::uint32_t received = 0;
+    bool          ordered  = true;
+    while (received < PRODUCER_COUNT * RECORD_COUNT) {
+        received += static_cast<std::uint32_t>(
+            queue->Drain([&nextRecord, &ordered](const EventRecord& record) {
+                // Records of a single producer arrive in the order they were posted
+                ordered = ordered && record.Data1 == nextRecord[record.Data0];
+                nextRecord[record.Data0]++;
+            }));
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    EXPECT_TRUE(ordered);
+    for (std::uint32_t count : nextRecord) {
+        EXPECT_EQ(count, RECORD_COUNT);
+    }
+}
+
+TEST(EventRecordTest, DispatchTableMatchesEventClasses)
+{
+    for (std::size_t i = 0; i < Astrelis::EVENT_TYPE_COUNT; i++) {
+        const auto record = EventRecord::Create(static_cast<EventType>(i), 1, 2);
+        if (!record.IsValid()) {
+            continue;
+        }
+
+        bool dispatched = false;
+        record.Dispatch([&record, &dispatched](Astrelis::Event& event) {
+            EXPECT_EQ(event.GetEventType(), record.Type);
+            EXPECT_EQ(event.GetCategoryFlags(), record.GetCategoryFlags());
+            dispatched = true;
+        });
+        EXPECT_TRUE(dispatched);
+    }
+
+    EXPECT_FALSE(EventRecord::Create(EventType::None).IsValid());
+    EXPECT_FALSE(EventRecord::Create(static_cast<EventType>(Astrelis::EVENT_TYPE_COUNT)).IsValid());
+}
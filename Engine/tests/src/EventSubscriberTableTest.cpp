@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include "Astrelis/Core/EventSubscriberTable.hpp"
+#include "Astrelis/Events/KeyEvent.hpp"
+#include "Astrelis/Events/MouseEvent.hpp"
+#include "Astrelis/Events/WindowEvent.hpp"
+
+#include <string>
+#include <vector>
+
+using Astrelis::Event, Astrelis::EventCategory, Astrelis::EventSubscriberTable, Astrelis::EventType,
+    Astrelis::Layer, Astrelis::OwnedPtr;
+
+namespace {
+    class RecordingLayer : public Layer {
+    public:
+        RecordingLayer(std::string name, std::vector<std::string>* received, bool handles = false)
+            : Layer(std::move(name)), m_Received(received), m_Handles(handles) {
+        }
+
+        void OnEvent(Event& event) override {
+            m_Received->push_back(GetName());
+            event.Handled = m_Handles;
+        }
+
+        using Layer::SubscribeEvent;
+        using Layer::SubscribeEvents;
+        using Layer::UnsubscribeEvents;
+    private:
+        std::vector<std::string>* m_Received;
+        bool                      m_Handles;
+    };
+
+    struct TestLayers {
+        std::vector<OwnedPtr<Layer*>> Layers;
+
+        ~TestLayers() {
+            for (auto& layer : Layers) {
+                layer.Reset();
+            }
+        }
+
+        RecordingLayer* Push(RecordingLayer* layer) {
+            Layers.emplace_back(layer);
+            return layer;
+        }
+    };
+} // namespace
+
+TEST(EventSubscriberTableTest, OnlySubscribersReceiveEvents)
+{
+    std::vector<std::string> received;
+    TestLayers               layers;
+    layers.Push(new RecordingLayer("Everything", &received));
+    layers.Push(new RecordingLayer("Keyboard", &received))
+        ->SubscribeEvents(EventCategory::Keyboard);
+    layers.Push(new RecordingLayer("Click", &received))
+        ->SubscribeEvent(EventType::MouseButtonPressed);
+    layers.Push(new RecordingLayer("Nothing", &received))->UnsubscribeEvents();
+
+    EventSubscriberTable table;
+    table.Build(layers.Layers);
+    EXPECT_EQ(table.GetSubscribers(EventType::KeyPressed).size(), 2);
+    EXPECT_EQ(table.GetSubscribers(EventType::MouseMoved).size(), 1);
+
+    Astrelis::KeyPressedEvent key(Astrelis::KeyCode::A);
+    table.Dispatch(key);
+    // The top of the stack receives events first
+    EXPECT_EQ(received, (std::vector<std::string> {"Keyboard", "Everything"}));
+
+    received.clear();
+    Astrelis::MouseButtonPressedEvent click(Astrelis::MouseCode::ButtonLeft);
+    table.Dispatch(click);
+    EXPECT_EQ(received, (std::vector<std::string> {"Click", "Everything"}));
+
+    received.clear();
+    Astrelis::MouseMovedEvent moved(1.0F, 2.0F);
+    table.Dispatch(moved);
+    EXPECT_EQ(received, (std::vector<std::string> {"Everything"}));
+}
+
+TEST(EventSubscriberTableTest, SubscriptionsCombine)
+{
+    std::vector<std::string> received;
+    TestLayers               layers;
+    RecordingLayer*          layer = layers.Push(new RecordingLayer("Layer", &received));
+    layer->SubscribeEvents(EventCategory::Keyboard | EventCategory::MouseButton);
+    layer->SubscribeEvent(EventType::WindowClosed);
+
+    EXPECT_TRUE(layer->IsSubscribedTo(EventType::KeyTyped));
+    EXPECT_TRUE(layer->IsSubscribedTo(EventType::MouseButtonReleased));
+    EXPECT_TRUE(layer->IsSubscribedTo(EventType::WindowClosed));
+    EXPECT_FALSE(layer->IsSubscribedTo(EventType::MouseScrolled));
+    EXPECT_FALSE(layer->IsSubscribedTo(EventType::WindowResized));
+    EXPECT_FALSE(layer->IsSubscribedTo(static_cast<EventType>(Astrelis::EVENT_TYPE_COUNT)));
+}
+
+TEST(EventSubscriberTableTest, HandledEventsStop)
+{
+    std::vector<std::string> received;
+    TestLayers               layers;
+    layers.Push(new RecordingLayer("Bottom", &received));
+    layers.Push(new RecordingLayer("Top", &received, true));
+
+    EventSubscriberTable table;
+    table.Build(layers.Layers);
+    Astrelis::WindowCloseEvent close;
+    table.Dispatch(close);
+    EXPECT_EQ(received, (std::vector<std::string> {"Top"}));
+    EXPECT_TRUE(close.Handled);
+
+    // Rebuilding drops the layers that are no longer in the stack
+    layers.Layers.back().Reset();
+    layers.Layers.pop_back();
+    table.Build(layers.Layers);
+    EXPECT_EQ(table.GetSubscribers(EventType::WindowClosed).size(), 1);
+}
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include "Astrelis/Core/FrameArena.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+using Astrelis::ArenaAllocator, Astrelis::ArenaVector, Astrelis::FrameArena, Astrelis::LinearArena;
+
+TEST(LinearArenaTest, AlignsAllocations)
+{
+    LinearArena arena(256);
+    auto*       byte = arena.Allocate<char>();
+    auto*       wide = arena.Allocate(16, 64);
+    EXPECT_NE(byte, nullptr);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(wide) % 64, 0);
+    EXPECT_GE(arena.GetUsedBytes(), 17);
+}
+
+TEST(LinearArenaTest, ReusesBlocksAfterReset)
+{
+    LinearArena arena(128);
+    for (int i = 0; i < 10; i++) {
+        ASSERT_NE(arena.Allocate(100), nullptr);
+    }
+    // Larger than a block gets a block of its own
+    ASSERT_NE(arena.Allocate(1000), nullptr);
+    const std::size_t blocks = arena.GetBlockCount();
+    EXPECT_EQ(blocks, 11);
+
+    arena.Reset();
+    EXPECT_EQ(arena.GetUsedBytes(), 0);
+    for (int i = 0; i < 10; i++) {
+        ASSERT_NE(arena.Allocate(100), nullptr);
+    }
+    ASSERT_NE(arena.Allocate(1000), nullptr);
+    EXPECT_EQ(arena.GetBlockCount(), blocks);
+}
+
+TEST(LinearArenaTest, AllocatorWorksWithContainers)
+{
+    LinearArena      arena(64);
+    ArenaVector<int> values {ArenaAllocator<int>(arena)};
+    for (int i = 0; i < 1000; i++) {
+        values.push_back(i);
+    }
+    EXPECT_EQ(values.size(), 1000);
+    EXPECT_EQ(values[999], 999);
+    EXPECT_EQ(values.get_allocator().GetArena(), &arena);
+}
+
+TEST(FrameArenaTest, MemoryLivesForFrameCount)
+{
+    FrameArena frames;
+    frames.Init(2, 1024);
+
+    LinearArena& first = frames.GetThreadArena();
+    EXPECT_NE(first.Allocate(100), nullptr);
+    frames.BeginFrame();
+    LinearArena& second = frames.GetThreadArena();
+    EXPECT_NE(&first, &second);
+    // The arena of the previous frame is still in use
+    EXPECT_EQ(first.GetUsedBytes(), 100);
+
+    frames.BeginFrame();
+    EXPECT_EQ(&frames.GetThreadArena(), &first);
+    EXPECT_EQ(first.GetUsedBytes(), 0);
+}
+
+TEST(FrameArenaTest, ThreadsGetTheirOwnArena)
+{
+    FrameArena frames;
+    frames.Init(3);
+
+    LinearArena* mainArena  = &frames.GetThreadArena();
+    LinearArena* otherArena = nullptr;
+    std::thread  thread([&frames, &otherArena]() {
+        otherArena = &frames.GetThreadArena();
+        EXPECT_NE(otherArena->Allocate(64), nullptr);
+    });
+    thread.join();
+
+    EXPECT_NE(mainArena, otherArena);
+    EXPECT_EQ(mainArena->GetUsedBytes(), 0);
+    EXPECT_EQ(otherArena->GetUsedBytes(), 64);
+}
+
+TEST(FrameArenaTest, SwitchingArenasKeepsTheThreadArena)
+{
+    FrameArena first;
+    FrameArena second;
+    first.Init(2);
+    second.Init(2);
+
+    LinearArena* firstArena  = &first.GetThreadArena();
+    LinearArena* secondArena = &second.GetThreadArena();
+    EXPECT_NE(firstArena, secondArena);
+    for (int i = 0; i < 100; i++) {
+        ASSERT_EQ(&first.GetThreadArena(), firstArena);
+        ASSERT_EQ(&second.GetThreadArena(), secondArena);
+    }
+    EXPECT_EQ(first.GetThreadCount(), 1);
+    EXPECT_EQ(second.GetThreadCount(), 1);
+}
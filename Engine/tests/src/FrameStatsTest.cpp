@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include "Astrelis/Core/FrameStats.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using Astrelis::FramePhase, Astrelis::FrameSample, Astrelis::FrameStats, Astrelis::Milliseconds;
+
+namespace {
+    Milliseconds Millis(double value) {
+        return Milliseconds(std::chrono::duration<double, std::milli>(value));
+    }
+} // namespace
+
+TEST(FrameStatsTest, Percentiles)
+{
+    FrameStats stats;
+    EXPECT_EQ(stats.GetSummary().SampleCount, 0);
+
+    for (int i = 1; i <= 100; i++) {
+        stats.EndFrame(Millis(i));
+    }
+
+    auto summary = stats.GetSummary();
+    EXPECT_EQ(summary.SampleCount, 100);
+    EXPECT_FLOAT_EQ(summary.P50, 50.0F);
+    EXPECT_FLOAT_EQ(summary.P95, 95.0F);
+    EXPECT_FLOAT_EQ(summary.P99, 99.0F);
+    EXPECT_FLOAT_EQ(summary.Max, 100.0F);
+    EXPECT_FLOAT_EQ(summary.Average, 50.5F);
+    EXPECT_EQ(stats.GetHistogram()[FrameStats::HISTOGRAM_BUCKET_COUNT - 1], 2);
+}
+
+TEST(FrameStatsTest, RollingHistory)
+{
+    FrameStats stats;
+    for (std::size_t i = 0; i < FrameStats::HISTORY_SIZE; i++) {
+        stats.EndFrame(Millis(50.0));
+    }
+    for (std::size_t i = 0; i < FrameStats::HISTORY_SIZE; i++) {
+        stats.EndFrame(Millis(2.5));
+    }
+
+    // The slow frames have been evicted from the history and the histogram
+    EXPECT_FLOAT_EQ(stats.GetSummary().Max, 2.5F);
+    EXPECT_EQ(stats.GetHistogram()[2], FrameStats::HISTORY_SIZE);
+    EXPECT_EQ(stats.GetHistogram()[50], 0);
+    EXPECT_EQ(stats.GetFrameCount(), FrameStats::HISTORY_SIZE * 2);
+
+    auto samples = stats.GetSamples();
+    ASSERT_EQ(samples.size(), FrameStats::HISTORY_SIZE);
+    EXPECT_EQ(samples.front().FrameIndex, FrameStats::HISTORY_SIZE);
+    EXPECT_EQ(samples.back().FrameIndex, FrameStats::HISTORY_SIZE * 2 - 1);
+}
+
+TEST(FrameStatsTest, PhasesAndHitches)
+{
+    FrameStats  stats;
+    int         hitches = 0;
+    FrameSample hitch;
+    stats.SetHitchThreshold(Millis(30.0));
+    stats.SetHitchCallback([&](const FrameSample& sample) {
+        hitches++;
+        hitch = sample;
+    });
+
+    stats.AddPhaseTime(FramePhase::Update, Millis(4.0));
+    stats.AddPhaseTime(FramePhase::Update, Millis(2.0));
+    stats.AddPhaseTime(FramePhase::Present, Millis(1.0));
+    stats.EndFrame(Millis(10.0));
+    stats.AddPhaseTime(FramePhase::FenceWait, Millis(25.0));
+    stats.EndFrame(Millis(40.0));
+
+    EXPECT_EQ(hitches, 1);
+    EXPECT_EQ(hitch.FrameIndex, 1);
+    EXPECT_FLOAT_EQ(hitch.PhaseTimesMs[static_cast<std::size_t>(FramePhase::FenceWait)], 25.0F);
+    EXPECT_FLOAT_EQ(hitch.PhaseTimesMs[static_cast<std::size_t>(FramePhase::Update)], 0.0F);
+    EXPECT_FLOAT_EQ(stats.GetPhaseSummary(FramePhase::Update).Max, 6.0F);
+    EXPECT_FLOAT_EQ(stats.GetPhaseSummary(FramePhase::Present).Max, 1.0F);
+}
+
+TEST(FrameStatsTest, WriteCSV)
+{
+    FrameStats stats;
+    stats.AddPhaseTime(FramePhase::UI, Millis(1.5));
+    stats.EndFrame(Millis(16.0));
+    stats.EndFrame(Millis(17.0));
+
+    auto path = std::filesystem::temp_directory_path() / "astrelis_frame_stats.csv";
+    ASSERT_FALSE(stats.WriteCSV(path).IsErr());
+
+    std::ifstream file(path);
+    std::string   line;
+    std::getline(file, line);
+    EXPECT_EQ(line, "Frame,FrameTimeMs,UpdateMs,UIMs,RecordMs,FenceWaitMs,PresentMs");
+    std::getline(file, line);
+    EXPECT_EQ(line, "0,16,0,1.5,0,0,0");
+    std::getline(file, line);
+    EXPECT_EQ(line, "1,17,0,0,0,0,0");
+    file.close();
+    std::filesystem::remove(path);
+}
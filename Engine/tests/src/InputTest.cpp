@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include "Astrelis/Core/Input.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using Astrelis::EventRecord, Astrelis::EventType, Astrelis::InputState, Astrelis::KeyCode,
+    Astrelis::MouseCode;
+
+namespace {
+    EventRecord Key(EventType type, KeyCode key, bool repeat = false) {
+        return EventRecord::Create(type, static_cast<std::uint32_t>(key), repeat ? 1 : 0);
+    }
+
+    EventRecord Button(EventType type, MouseCode button) {
+        return EventRecord::Create(type, static_cast<std::uint32_t>(button));
+    }
+} // namespace
+
+TEST(InputTest, KeyEdgesArePerFrame)
+{
+    InputState input;
+    EXPECT_TRUE(input.Consume(Key(EventType::KeyPressed, KeyCode::W)));
+    EXPECT_TRUE(input.Consume(Key(EventType::KeyPressed, KeyCode::W, true)));
+    EXPECT_TRUE(input.Consume(Button(EventType::MouseButtonPressed, MouseCode::ButtonLeft)));
+
+    // The snapshot being built is not visible until the frame ends
+    EXPECT_FALSE(input.GetSnapshot().IsKeyDown(KeyCode::W));
+    input.EndFrame();
+    EXPECT_TRUE(input.GetSnapshot().IsKeyDown(KeyCode::W));
+    EXPECT_TRUE(input.GetSnapshot().IsKeyPressed(KeyCode::W));
+    EXPECT_TRUE(input.GetSnapshot().IsMouseButtonDown(MouseCode::ButtonLeft));
+
+    input.EndFrame();
+    EXPECT_TRUE(input.GetSnapshot().IsKeyDown(KeyCode::W));
+    EXPECT_FALSE(input.GetSnapshot().IsKeyPressed(KeyCode::W));
+
+    input.Consume(Key(EventType::KeyReleased, KeyCode::W));
+    input.Consume(Key(EventType::KeyPressed, KeyCode::A));
+    input.Consume(Key(EventType::KeyReleased, KeyCode::A));
+    input.EndFrame();
+    EXPECT_FALSE(input.GetSnapshot().IsKeyDown(KeyCode::W));
+    EXPECT_TRUE(input.GetSnapshot().IsKeyReleased(KeyCode::W));
+    // Tapped within a single frame
+    EXPECT_FALSE(input.GetSnapshot().IsKeyDown(KeyCode::A));
+    EXPECT_TRUE(input.GetSnapshot().IsKeyPressed(KeyCode::A));
+    EXPECT_TRUE(input.GetSnapshot().IsKeyReleased(KeyCode::A));
+}
+
+TEST(InputTest, CoalescesMotionAndScrolling)
+{
+    InputState input;
+    EXPECT_FALSE(input.Consume(EventRecord::CreateFloat(EventType::MouseMoved, 10.0F, 10.0F)));
+    EXPECT_FALSE(input.Consume(EventRecord::CreateFloat(EventType::MouseMoved, 12.0F, 9.0F)));
+    EXPECT_FALSE(input.Consume(EventRecord::CreateFloat(EventType::MouseMoved, 15.0F, 7.0F)));
+    EXPECT_FALSE(input.Consume(EventRecord::CreateFloat(EventType::MouseScrolled, 0.0F, 1.0F)));
+    EXPECT_FALSE(input.Consume(EventRecord::CreateFloat(EventType::MouseScrolled, 0.0F, 2.0F)));
+
+    std::vector<std::string> dispatched;
+    input.DispatchCoalesced(
+        [&dispatched](Astrelis::Event& event) { dispatched.push_back(event.ToString()); });
+    EXPECT_EQ(dispatched,
+        (std::vector<std::string> {Astrelis::MouseMovedEvent(15.0F, 7.0F).ToString(),
+            Astrelis::MouseScrolledEvent(0.0F, 3.0F).ToString()}));
+
+    input.EndFrame();
+    const auto& snapshot = input.GetSnapshot();
+    // The first position has no previous position to move from
+    EXPECT_FLOAT_EQ(snapshot.MouseDelta[0], 5.0F);
+    EXPECT_FLOAT_EQ(snapshot.MouseDelta[1], -3.0F);
+    EXPECT_FLOAT_EQ(snapshot.MousePosition[0], 15.0F);
+    EXPECT_FLOAT_EQ(snapshot.ScrollDelta[1], 3.0F);
+
+    dispatched.clear();
+    input.DispatchCoalesced(
+        [&dispatched](Astrelis::Event& event) { dispatched.push_back(event.ToString()); });
+    EXPECT_TRUE(dispatched.empty());
+
+    input.EndFrame();
+    EXPECT_FLOAT_EQ(input.GetSnapshot().MouseDelta[0], 0.0F);
+    EXPECT_FLOAT_EQ(input.GetSnapshot().ScrollDelta[1], 0.0F);
+    EXPECT_FLOAT_EQ(input.GetSnapshot().MousePosition[0], 15.0F);
+}
+
+TEST(InputTest, LostFocusReleasesEverything)
+{
+    InputState input;
+    input.Consume(Key(EventType::KeyPressed, KeyCode::LeftShift));
+    input.Consume(Button(EventType::MouseButtonPressed, MouseCode::ButtonRight));
+    input.EndFrame();
+
+    EXPECT_TRUE(input.Consume(EventRecord::Create(EventType::WindowLostFocus)));
+    input.EndFrame();
+    EXPECT_FALSE(input.GetSnapshot().IsKeyDown(KeyCode::LeftShift));
+    EXPECT_TRUE(input.GetSnapshot().IsKeyReleased(KeyCode::LeftShift));
+    EXPECT_FALSE(input.GetSnapshot().IsMouseButtonDown(MouseCode::ButtonRight));
+}
+
+TEST(InputTest, UnknownKeysAreIgnored)
+{
+    InputState input;
+    EXPECT_TRUE(input.Consume(EventRecord::Create(EventType::KeyPressed, 0xFFFFFFFF)));
+    input.EndFrame();
+    EXPECT_TRUE(input.GetSnapshot().KeysDown.none());
+    EXPECT_FALSE(input.GetSnapshot().IsKeyDown(static_cast<KeyCode>(0xFFFF)));
+}
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include "Astrelis/Core/Jobs/JobSystem.hpp"
+#include "Astrelis/Core/Jobs/WorkStealingQueue.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using Astrelis::JobCounter, Astrelis::JobSystem, Astrelis::WorkStealingQueue;
+
+TEST(JobSystemTest, WorkStealingQueueOrder)
+{
+    WorkStealingQueue<int, 4> queue;
+    EXPECT_TRUE(queue.IsEmpty());
+    EXPECT_TRUE(queue.Push(1));
+    EXPECT_TRUE(queue.Push(2));
+    EXPECT_TRUE(queue.Push(3));
+    EXPECT_TRUE(queue.Push(4));
+    EXPECT_FALSE(queue.Push(5));
+    EXPECT_EQ(queue.Size(), 4);
+
+    // Owner pops LIFO, thieves steal FIFO
+    EXPECT_EQ(queue.Pop(), 4);
+    EXPECT_EQ(queue.Steal(), 1);
+    EXPECT_EQ(queue.Pop(), 3);
+    EXPECT_EQ(queue.Steal(), 2);
+    EXPECT_FALSE(queue.Pop().has_value());
+    EXPECT_FALSE(queue.Steal().has_value());
+}
+
+TEST(JobSystemTest, ScheduleAndWait)
+{
+    JobSystem jobSystem;
+    ASSERT_TRUE(jobSystem.Init(4));
+    EXPECT_EQ(jobSystem.GetWorkerCount(), 4);
+    EXPECT_EQ(jobSystem.GetCurrentWorkerIndex(), 0);
+
+    std::atomic<int> value = 0;
+    JobCounter       counter;
+    for (int i = 0; i < 1000; i++) {
+        jobSystem.Schedule([&value]() { value.fetch_add(1); }, &counter);
+    }
+    jobSystem.Wait(counter);
+
+    EXPECT_TRUE(counter.IsDone());
+    EXPECT_EQ(value.load(), 1000);
+    jobSystem.Shutdown();
+    EXPECT_FALSE(jobSystem.IsInitialized());
+}
+
+TEST(JobSystemTest, Dependencies)
+{
+    JobSystem jobSystem;
+    ASSERT_TRUE(jobSystem.Init(4));
+
+    std::atomic<int> first = 0;
+    bool             orderedCorrectly = true;
+    JobCounter       firstCounter;
+    JobCounter       secondCounter;
+    for (int i = 0; i < 64; i++) {
+        jobSystem.Schedule([&first]() { first.fetch_add(1); }, &firstCounter);
+    }
+    jobSystem.ScheduleAfter(
+        firstCounter, [&]() { orderedCorrectly = first.load() == 64; }, &secondCounter);
+    jobSystem.Wait(secondCounter);
+
+    EXPECT_TRUE(orderedCorrectly);
+}
+
+TEST(JobSystemTest, ParallelFor)
+{
+    JobSystem jobSystem;
+    ASSERT_TRUE(jobSystem.Init());
+
+    std::vector<int> values(100'000, 1);
+    jobSystem.ParallelFor(values.size(), 0, [&values](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            values[i] *= 2;
+        }
+    });
+
+    EXPECT_EQ(std::accumulate(values.begin(), values.end(), 0), 200'000);
+}
+
+TEST(JobSystemTest, FullPoolRunsInline)
+{
+    // Without other workers nothing runs until the wait, so the pool of the main thread fills up
+    JobSystem jobSystem;
+    ASSERT_TRUE(jobSystem.Init(1));
+
+    constexpr int    JOB_COUNT = static_cast<int>(JobSystem::MAX_JOBS_PER_WORKER) + 1000;
+    std::vector<int> runs(JOB_COUNT, 0);
+    JobCounter       counter;
+    for (int i = 0; i < JOB_COUNT; i++) {
+        jobSystem.Schedule([&runs, i]() { runs[i]++; }, &counter);
+    }
+    EXPECT_EQ(counter.GetValue(), JobSystem::MAX_JOBS_PER_WORKER);
+    jobSystem.Wait(counter);
+
+    EXPECT_EQ(std::accumulate(runs.begin(), runs.end(), 0), JOB_COUNT);
+    EXPECT_EQ(*std::min_element(runs.begin(), runs.end()), 1);
+
+    // The slots are free again once their jobs finished
+    jobSystem.Schedule([&runs]() { runs[0]++; }, &counter);
+    EXPECT_EQ(counter.GetValue(), 1);
+    jobSystem.Wait(counter);
+    EXPECT_EQ(runs[0], 2);
+}
+
+TEST(JobSystemTest, ParallelForWithMoreBatchesThanThePool)
+{
+    JobSystem jobSystem;
+    ASSERT_TRUE(jobSystem.Init(4));
+
+    // Slow batches keep their slots in use while the main thread is still scheduling
+    std::atomic<int> value = 0;
+    jobSystem.ParallelFor(5'000, 1, [&value](std::size_t begin, std::size_t end) {
+        std::this_thread::sleep_for(std::chrono::microseconds(10));
+        value.fetch_add(static_cast<int>(end - begin));
+    });
+    EXPECT_EQ(value.load(), 5'000);
+}
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include "Astrelis/Core/Jobs/JobSystem.hpp"
+#include "Astrelis/Core/LayerScheduler.hpp"
+
+#include <atomic>
+#include <initializer_list>
+#include <string_view>
+#include <vector>
+
+using Astrelis::JobSystem, Astrelis::Layer, Astrelis::LayerScheduler, Astrelis::OwnedPtr;
+
+namespace {
+    class AccessLayer : public Layer {
+    public:
+        AccessLayer(std::initializer_list<std::string_view> reads,
+            std::initializer_list<std::string_view> writes, std::atomic<int>* updates = nullptr)
+            : m_Updates(updates) {
+            for (std::string_view name : reads) {
+                ReadsResource(name);
+            }
+            for (std::string_view name : writes) {
+                WritesResource(name);
+            }
+        }
+
+        void OnUpdate() override {
+            if (m_Updates != nullptr) {
+                m_Updates->fetch_add(1);
+            }
+        }
+    private:
+        std::atomic<int>* m_Updates;
+    };
+
+    class IndependentLayer : public Layer {
+    public:
+        explicit IndependentLayer(std::atomic<int>* updates) : m_Updates(updates) {
+            SetParallelSafe();
+        }
+
+        void OnUpdate() override {
+            m_Updates->fetch_add(1);
+        }
+    private:
+        std::atomic<int>* m_Updates;
+    };
+
+    struct TestLayers {
+        std::vector<OwnedPtr<Layer*>> Layers;
+
+        ~TestLayers() {
+            for (auto& layer : Layers) {
+                layer.Reset();
+            }
+        }
+
+        Layer* Push(Layer* layer) {
+            Layers.emplace_back(layer);
+            return layer;
+        }
+    };
+} // namespace
+
+TEST(LayerSchedulerTest, ConflictingLayersKeepOrder)
+{
+    TestLayers layers;
+    Layer*     writer  = layers.Push(new AccessLayer({}, {"World"}));
+    Layer*     reader1 = layers.Push(new AccessLayer({"World"}, {"Audio"}));
+    Layer*     reader2 = layers.Push(new AccessLayer({"World"}, {"Analytics"}));
+    Layer*     audio   = layers.Push(new AccessLayer({"Audio"}, {}));
+
+    LayerScheduler scheduler;
+    scheduler.Build(layers.Layers);
+    ASSERT_EQ(scheduler.GetStageCount(), 3);
+    ASSERT_EQ(scheduler.GetStage(0).size(), 1);
+    EXPECT_EQ(scheduler.GetStage(0)[0], writer);
+    // Both only read the world, and write different resources
+    ASSERT_EQ(scheduler.GetStage(1).size(), 2);
+    EXPECT_EQ(scheduler.GetStage(1)[0], reader1);
+    EXPECT_EQ(scheduler.GetStage(1)[1], reader2);
+    ASSERT_EQ(scheduler.GetStage(2).size(), 1);
+    EXPECT_EQ(scheduler.GetStage(2)[0], audio);
+}
+
+TEST(LayerSchedulerTest, UndeclaredLayerIsBarrier)
+{
+    std::atomic<int> updates = 0;
+    TestLayers       layers;
+    layers.Push(new IndependentLayer(&updates));
+    layers.Push(new IndependentLayer(&updates));
+    Layer* barrier = layers.Push(new Layer("Undeclared"));
+    layers.Push(new IndependentLayer(&updates));
+
+    LayerScheduler scheduler;
+    scheduler.Build(layers.Layers);
+    ASSERT_EQ(scheduler.GetStageCount(), 3);
+    EXPECT_EQ(scheduler.GetStage(0).size(), 2);
+    ASSERT_EQ(scheduler.GetStage(1).size(), 1);
+    EXPECT_EQ(scheduler.GetStage(1)[0], barrier);
+    EXPECT_EQ(scheduler.GetStage(2).size(), 1);
+}
+
+TEST(LayerSchedulerTest, UpdatesEveryLayerOnce)
+{
+    JobSystem jobSystem;
+    ASSERT_TRUE(jobSystem.Init(4));
+
+    std::atomic<int> updates = 0;
+    TestLayers       layers;
+    for (int i = 0; i < 32; i++) {
+        layers.Push(new IndependentLayer(&updates));
+    }
+    layers.Push(new AccessLayer({"A"}, {"B"}, &updates));
+    layers.Push(new AccessLayer({"B"}, {"A"}, &updates));
+
+    LayerScheduler scheduler;
+    for (int frame = 0; frame < 10; frame++) {
+        scheduler.Build(layers.Layers);
+        scheduler.Update(jobSystem);
+    }
+    EXPECT_EQ(scheduler.GetStageCount(), 2);
+    EXPECT_EQ(updates.load(), 34 * 10);
+
+    jobSystem.Shutdown();
+}
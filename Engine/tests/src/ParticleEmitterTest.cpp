@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+
+#include "Astrelis/Scene/ParticleEmitter.hpp"
+
+#include <cstddef>
+#include <vector>
+
+using Astrelis::InstanceData, Astrelis::ParticleEmitter, Astrelis::ParticleEmitterProps,
+    Astrelis::Vec2f, Astrelis::Vec3f;
+
+namespace {
+    // A power of two, so the emission rates below emit exact particle counts
+    constexpr float STEP = 1.0F / 64.0F;
+} // namespace
+
+TEST(ParticleEmitterTest, UpdateMovesParticles)
+{
+    ParticleEmitterProps props;
+    props.EmissionRate = 0.0F;
+    props.MinVelocity  = Vec2f(2.0F, 1.0F);
+    props.MaxVelocity  = Vec2f(2.0F, 1.0F);
+    props.Acceleration = Vec2f(0.0F, -10.0F);
+    props.Drag         = 0.5F;
+    props.MinLifetime  = 10.0F;
+    props.MaxLifetime  = 10.0F;
+
+    // Not a multiple of four, so the scalar tail runs as well
+    ParticleEmitter emitter(props);
+    emitter.Emit(7);
+    ASSERT_EQ(emitter.GetParticleCount(), 7);
+
+    float positionX = 0.0F;
+    float positionY = 0.0F;
+    float velocityX = 2.0F;
+    float velocityY = 1.0F;
+    for (int step = 0; step < 32; step++) {
+        emitter.Update(STEP);
+        velocityX = velocityX / (1.0F + props.Drag * STEP);
+        velocityY = (velocityY - 10.0F * STEP) / (1.0F + props.Drag * STEP);
+        positionX += velocityX * STEP;
+        positionY += velocityY * STEP;
+    }
+
+    for (std::size_t i = 0; i < emitter.GetParticleCount(); i++) {
+        EXPECT_NEAR(emitter.GetParticlePosition(i)[0], positionX, 1.0e-5F);
+        EXPECT_NEAR(emitter.GetParticlePosition(i)[1], positionY, 1.0e-5F);
+        EXPECT_NEAR(emitter.GetParticleVelocity(i)[1], velocityY, 1.0e-5F);
+        EXPECT_NEAR(emitter.GetParticleAge(i), 0.05F, 1.0e-5F);
+    }
+}
+
+TEST(ParticleEmitterTest, DeadParticlesAreRemoved)
+{
+    ParticleEmitterProps props;
+    props.EmissionRate = 0.0F;
+    props.MinLifetime  = 0.5F;
+    props.MaxLifetime  = 1.5F;
+
+    ParticleEmitter emitter(props);
+    emitter.Emit(1'001);
+    for (int step = 0; step < 64; step++) {
+        emitter.Update(STEP);
+    }
+
+    // About half of the lifetimes are below one second
+    EXPECT_GT(emitter.GetParticleCount(), 400);
+    EXPECT_LT(emitter.GetParticleCount(), 600);
+    for (std::size_t i = 0; i < emitter.GetParticleCount(); i++) {
+        EXPECT_LT(emitter.GetParticleAge(i), 1.0F);
+        EXPECT_GT(emitter.GetParticleAge(i), 0.66F);
+    }
+
+    for (int step = 0; step < 64; step++) {
+        emitter.Update(STEP);
+    }
+    EXPECT_EQ(emitter.GetParticleCount(), 0);
+}
+
+TEST(ParticleEmitterTest, EmissionRateIsCapped)
+{
+    ParticleEmitterProps props;
+    props.EmissionRate = 96.0F;
+    props.MaxParticles = 25;
+    props.MinLifetime  = 10.0F;
+    props.MaxLifetime  = 10.0F;
+
+    // One and a half particles per step
+    ParticleEmitter emitter(props);
+    for (int step = 0; step < 10; step++) {
+        emitter.Update(STEP);
+    }
+    EXPECT_EQ(emitter.GetParticleCount(), 15);
+    for (int step = 0; step < 10; step++) {
+        emitter.Update(STEP);
+    }
+    EXPECT_EQ(emitter.GetParticleCount(), 25);
+
+    emitter.Clear();
+    emitter.SetEmitting(false);
+    emitter.Update(STEP);
+    EXPECT_EQ(emitter.GetParticleCount(), 0);
+}
+
+TEST(ParticleEmitterTest, WriteInstances)
+{
+    ParticleEmitterProps props;
+    props.EmissionRate = 0.0F;
+    props.Position     = Vec2f(3.0F, 4.0F);
+    props.MinVelocity  = Vec2f(0.0F);
+    props.MaxVelocity  = Vec2f(0.0F);
+    props.Acceleration = Vec2f(0.0F);
+    props.MinLifetime  = 1.0F;
+    props.MaxLifetime  = 1.0F;
+    props.StartSize    = 1.0F;
+    props.EndSize      = 0.0F;
+    props.StartColor   = Vec3f(1.0F, 0.0F, 0.0F);
+    props.EndColor     = Vec3f(0.0F, 0.0F, 1.0F);
+    props.Depth        = 0.5F;
+
+    ParticleEmitter emitter(props);
+    emitter.Emit(5);
+    for (int step = 0; step < 16; step++) {
+        emitter.Update(STEP);
+    }
+
+    std::vector<InstanceData> instances(5);
+    ASSERT_EQ(emitter.WriteInstances(instances), 5);
+    for (const InstanceData& instance : instances) {
+        const auto& matrix = instance.Transform.GetGLMMatrix();
+        EXPECT_FLOAT_EQ(matrix[0][0], 0.75F);
+        EXPECT_FLOAT_EQ(matrix[1][1], 0.75F);
+        EXPECT_FLOAT_EQ(matrix[2][2], 1.0F);
+        EXPECT_FLOAT_EQ(matrix[3][0], 3.0F);
+        EXPECT_FLOAT_EQ(matrix[3][1], 4.0F);
+        EXPECT_FLOAT_EQ(matrix[3][2], 0.5F);
+        EXPECT_FLOAT_EQ(instance.Color[0], 0.75F);
+        EXPECT_FLOAT_EQ(instance.Color[2], 0.25F);
+    }
+
+    // Only as many as fit
+    std::vector<InstanceData> fewer(3);
+    EXPECT_EQ(emitter.WriteInstances(fewer), 3);
+}
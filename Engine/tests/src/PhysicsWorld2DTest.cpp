@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+
+#include "Astrelis/Core/Jobs/JobSystem.hpp"
+#include "Astrelis/Physics2D/PhysicsWorld2D.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using Astrelis::BodyId2D, Astrelis::BodyProps2D, Astrelis::BodyType2D, Astrelis::PhysicsWorld2D,
+    Astrelis::Shape2D, Astrelis::Vec2f;
+
+namespace {
+    constexpr float STEP = 1.0F / 60.0F;
+
+    BodyId2D CreateGround(PhysicsWorld2D& world, float halfWidth) {
+        BodyProps2D props;
+        props.Type     = BodyType2D::Static;
+        props.Position = Vec2f(0.0F, -0.5F);
+        return world.CreateBody(props, Shape2D::Box(halfWidth, 0.5F));
+    }
+
+    /// A pile of boxes and circles dropped into a pit, with walls on both sides
+    std::vector<BodyId2D> CreatePile(PhysicsWorld2D& world) {
+        CreateGround(world, 10.0F);
+        BodyProps2D wall;
+        wall.Type = BodyType2D::Static;
+        for (float side : {-10.5F, 10.5F}) {
+            wall.Position = Vec2f(side, 10.0F);
+            world.CreateBody(wall, Shape2D::Box(0.5F, 10.0F));
+        }
+
+        std::vector<BodyId2D> bodies;
+        BodyProps2D           props;
+        for (std::uint32_t i = 0; i < 200; i++) {
+            props.Position = Vec2f(-8.0F + static_cast<float>(i % 16),
+                1.0F + 1.1F * static_cast<float>(i / 16));
+            props.Angle = 0.1F * static_cast<float>(i % 5);
+            bodies.push_back(world.CreateBody(
+                props, i % 3 == 0 ? Shape2D::Circle(0.45F) : Shape2D::Box(0.45F, 0.4F)));
+        }
+        return bodies;
+    }
+} // namespace
+
+TEST(PhysicsWorld2DTest, StackSettlesAndSleeps)
+{
+    PhysicsWorld2D world;
+    CreateGround(world, 5.0F);
+
+    std::vector<BodyId2D> boxes;
+    BodyProps2D           props;
+    for (int i = 0; i < 8; i++) {
+        props.Position = Vec2f(0.0F, 0.5F + static_cast<float>(i) * 1.05F);
+        boxes.push_back(world.CreateBody(props, Shape2D::Box(0.5F, 0.5F)));
+    }
+    EXPECT_EQ(world.GetBodyCount(), 9);
+
+    world.Step(STEP);
+    EXPECT_EQ(world.GetIslandCount(), 8);
+
+    for (int step = 0; step < 5 * 60; step++) {
+        world.Step(STEP);
+    }
+
+    EXPECT_EQ(world.GetIslandCount(), 0);
+    for (std::size_t i = 0; i < boxes.size(); i++) {
+        EXPECT_FALSE(world.IsAwake(boxes[i]));
+        EXPECT_NEAR(world.GetPosition(boxes[i])[0], 0.0F, 0.05F);
+        EXPECT_NEAR(world.GetPosition(boxes[i])[1], 0.5F + static_cast<float>(i), 0.05F);
+        EXPECT_NEAR(world.GetAngle(boxes[i]), 0.0F, 0.02F);
+    }
+
+    // Sleeping bodies are still found by queries, and a push wakes the whole stack up
+    std::vector<BodyId2D> results;
+    EXPECT_EQ(world.QueryRect(Astrelis::Rect2Df(-0.1F, 3.2F, 0.2F, 0.2F), results).size(), 1);
+    const float before = world.GetPosition(boxes.back())[0];
+    world.ApplyLinearImpulse(boxes.back(), Vec2f(0.5F, 0.0F));
+    EXPECT_TRUE(world.IsAwake(boxes.back()));
+    world.Step(STEP);
+    EXPECT_EQ(world.GetIslandCount(), 1);
+    EXPECT_TRUE(world.IsAwake(boxes.front()));
+    EXPECT_GT(world.GetPosition(boxes.back())[0], before);
+}
+
+TEST(PhysicsWorld2DTest, DestroyingWakesTouchingBodies)
+{
+    PhysicsWorld2D world;
+    CreateGround(world, 5.0F);
+
+    BodyProps2D props;
+    props.Position       = Vec2f(0.0F, 0.5F);
+    const BodyId2D lower = world.CreateBody(props, Shape2D::Box(0.5F, 0.5F));
+    props.Position       = Vec2f(0.0F, 1.5F);
+    const BodyId2D upper = world.CreateBody(props, Shape2D::Circle(0.5F));
+    for (int step = 0; step < 3 * 60; step++) {
+        world.Step(STEP);
+    }
+    // Contacts are kept while the bodies sleep
+    ASSERT_FALSE(world.IsAwake(upper));
+    EXPECT_EQ(world.GetIslandCount(), 0);
+    EXPECT_EQ(world.GetContactCount(), 2);
+
+    world.DestroyBody(lower);
+    EXPECT_EQ(world.GetBodyCount(), 2);
+    EXPECT_TRUE(world.IsAwake(upper));
+    for (int step = 0; step < 60; step++) {
+        world.Step(STEP);
+    }
+    EXPECT_NEAR(world.GetPosition(upper)[1], 0.5F, 0.05F);
+
+    // The id is reused
+    EXPECT_EQ(world.CreateBody(props, Shape2D::Circle(0.5F)), lower);
+}
+
+TEST(PhysicsWorld2DTest, MovingStaticBodiesWakesTouchingBodies)
+{
+    PhysicsWorld2D world;
+    const BodyId2D ground = CreateGround(world, 5.0F);
+    const BodyId2D floor  = CreateGround(world, 5.0F);
+    world.SetTransform(floor, Vec2f(0.0F, -2.5F), 0.0F);
+
+    BodyProps2D props;
+    props.Position    = Vec2f(0.0F, 0.5F);
+    const BodyId2D box = world.CreateBody(props, Shape2D::Box(0.5F, 0.5F));
+    for (int step = 0; step < 3 * 60; step++) {
+        world.Step(STEP);
+    }
+    ASSERT_FALSE(world.IsAwake(box));
+
+    // The box falls onto the lower floor once the ground is moved away
+    world.SetTransform(ground, Vec2f(20.0F, -0.5F), 0.0F);
+    EXPECT_TRUE(world.IsAwake(box));
+    for (int step = 0; step < 60; step++) {
+        world.Step(STEP);
+    }
+    EXPECT_NEAR(world.GetPosition(box)[1], -1.5F, 0.05F);
+
+    // And wakes up again when the ground is moved back into it
+    for (int step = 0; step < 3 * 60; step++) {
+        world.Step(STEP);
+    }
+    ASSERT_FALSE(world.IsAwake(box));
+    world.SetTransform(ground, Vec2f(0.0F, -1.5F), 0.0F);
+    EXPECT_TRUE(world.IsAwake(box));
+}
+
+TEST(PhysicsWorld2DTest, ParallelStepMatchesSerial)
+{
+    Astrelis::JobSystem jobSystem;
+    ASSERT_TRUE(jobSystem.Init(4));
+
+    PhysicsWorld2D              serial;
+    PhysicsWorld2D              parallel;
+    const std::vector<BodyId2D> bodies = CreatePile(serial);
+    CreatePile(parallel);
+    for (int step = 0; step < 120; step++) {
+        serial.Step(STEP);
+        parallel.Step(STEP, jobSystem);
+    }
+
+    EXPECT_EQ(serial.GetContactCount(), parallel.GetContactCount());
+    EXPECT_EQ(serial.GetIslandCount(), parallel.GetIslandCount());
+    for (BodyId2D body : bodies) {
+        ASSERT_EQ(serial.GetPosition(body)[0], parallel.GetPosition(body)[0]);
+        ASSERT_EQ(serial.GetPosition(body)[1], parallel.GetPosition(body)[1]);
+        ASSERT_EQ(serial.GetAngle(body), parallel.GetAngle(body));
+        // Nothing fell through the ground or out of the pit
+        EXPECT_GT(serial.GetPosition(body)[1], 0.0F);
+        EXPECT_LT(std::abs(serial.GetPosition(body)[0]), 10.0F);
+    }
+
+    jobSystem.Shutdown();
+}
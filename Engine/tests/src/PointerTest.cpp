@@ -2,6 +2,9 @@
 
 #include "Astrelis/Core/Pointer.hpp"
 
+#include <thread>
+#include <vector>
+
 using Astrelis::RefPtr, Astrelis::ScopedPtr, Astrelis::OwnedPtr, Astrelis::RawRef;
 
 TEST(PointerTest, PointerAssignmentCreation)
@@ -108,3 +111,187 @@ TEST(PointerTest, OwnedPtrReference)
     rawPtr1 = nullptr;
     EXPECT_EQ(rawPtr1, nullptr);
 }
+
+namespace {
+    struct Tracked {
+        explicit Tracked(int* destroyed) : Destroyed(destroyed) {
+        }
+
+        virtual ~Tracked() {
+            (*Destroyed)++;
+        }
+
+        Tracked(const Tracked&)            = delete;
+        Tracked& operator=(const Tracked&) = delete;
+        Tracked(Tracked&&)                 = delete;
+        Tracked& operator=(Tracked&&)      = delete;
+
+        int* Destroyed;
+    };
+
+    struct DerivedTracked : Tracked {
+        using Tracked::Tracked;
+    };
+
+    class IntrusiveTracked : public Astrelis::RefCounted {
+    public:
+        explicit IntrusiveTracked(int* destroyed) : m_Destroyed(destroyed) {
+        }
+
+        ~IntrusiveTracked() override {
+            (*m_Destroyed)++;
+        }
+
+        IntrusiveTracked(const IntrusiveTracked&)            = delete;
+        IntrusiveTracked& operator=(const IntrusiveTracked&) = delete;
+        IntrusiveTracked(IntrusiveTracked&&)                 = delete;
+        IntrusiveTracked& operator=(IntrusiveTracked&&)      = delete;
+
+        RefPtr<IntrusiveTracked> GetRef() {
+            return RefPtr<IntrusiveTracked>(this);
+        }
+    private:
+        int* m_Destroyed;
+    };
+} // namespace
+
+TEST(PointerTest, RefPtrDestroysOnce)
+{
+    int destroyed = 0;
+    {
+        auto created = RefPtr<DerivedTracked>::Create(&destroyed);
+        auto base    = static_cast<RefPtr<Tracked>>(created);
+        EXPECT_EQ(created.GetRefCount(), 2);
+        created.Reset();
+        EXPECT_EQ(destroyed, 0);
+
+        // Wrapping an existing pointer allocates the count separately
+        RefPtr<Tracked> wrapped(new Tracked(&destroyed));
+        auto            copy = wrapped;
+        EXPECT_EQ(copy.GetRefCount(), 2);
+    }
+    EXPECT_EQ(destroyed, 2);
+}
+
+TEST(PointerTest, RefCountedIsIntrusive)
+{
+    int destroyed = 0;
+    {
+        auto object = RefPtr<IntrusiveTracked>::Create(&destroyed);
+        EXPECT_EQ(object->GetRefCount(), 1);
+
+        // The count lives in the object, so references can be recreated from it
+        auto fromThis = object->GetRef();
+        EXPECT_EQ(object.GetRefCount(), 2);
+        EXPECT_EQ(fromThis, object);
+
+        auto base = static_cast<RefPtr<Astrelis::RefCounted>>(object);
+        object.Reset();
+        fromThis.Reset();
+        EXPECT_EQ(destroyed, 0);
+        EXPECT_EQ(base.GetRefCount(), 1);
+    }
+    EXPECT_EQ(destroyed, 1);
+}
+
+TEST(PointerTest, RefPtrAssignFromOwnedObject)
+{
+    struct Node {
+        RefPtr<Node> Next;
+    };
+
+    auto head = RefPtr<Node>::Create();
+    head->Next = RefPtr<Node>::Create();
+    // The old head is only kept alive by this reference, and owns the assigned pointer
+    head = head->Next;
+    EXPECT_EQ(head.GetRefCount(), 1);
+    EXPECT_EQ(head->Next, nullptr);
+
+    head->Next = RefPtr<Node>::Create();
+    head       = std::move(head->Next);
+    EXPECT_EQ(head.GetRefCount(), 1);
+}
+
+TEST(PointerTest, WeakRefExpires)
+{
+    int destroyed = 0;
+
+    auto            fused = RefPtr<Tracked>::Create(&destroyed);
+    RefPtr<Tracked> wrapped(new Tracked(&destroyed));
+    auto            intrusive = RefPtr<IntrusiveTracked>::Create(&destroyed);
+
+    Astrelis::WeakRef<Tracked>          weakFused   = fused;
+    Astrelis::WeakRef<Tracked>          weakWrapped = wrapped;
+    Astrelis::WeakRef<IntrusiveTracked> weakIntrusive(intrusive);
+    auto                                weakCopy = weakIntrusive;
+
+    // Weak references do not keep the objects alive
+    EXPECT_EQ(fused.GetRefCount(), 1);
+    {
+        auto locked = weakFused.Lock();
+        EXPECT_EQ(locked, fused);
+        EXPECT_EQ(fused.GetRefCount(), 2);
+    }
+
+    fused.Reset();
+    wrapped.Reset();
+    intrusive.Reset();
+    EXPECT_EQ(destroyed, 3);
+    EXPECT_TRUE(weakFused.IsExpired());
+    EXPECT_TRUE(weakWrapped.IsExpired());
+    EXPECT_TRUE(weakCopy.IsExpired());
+    EXPECT_EQ(weakIntrusive.Lock(), nullptr);
+    EXPECT_TRUE(Astrelis::WeakRef<int>().IsExpired());
+}
+
+TEST(PointerTest, AtomicRefPtrAcrossThreads)
+{
+    constexpr int THREAD_COUNT = 4;
+    constexpr int COPY_COUNT   = 10'000;
+
+    int destroyed = 0;
+    {
+        auto shared = Astrelis::AtomicRefPtr<Tracked>::Create(&destroyed);
+        Astrelis::WeakRef<Tracked, Astrelis::RefCountPolicy::Atomic> weak = shared;
+
+        std::vector<std::thread> threads;
+        for (int i = 0; i < THREAD_COUNT; i++) {
+            threads.emplace_back([shared, weak]() {
+                for (int copy = 0; copy < COPY_COUNT; copy++) {
+                    auto local  = shared;
+                    auto locked = weak.Lock();
+                    EXPECT_NE(locked, nullptr);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        EXPECT_EQ(shared.GetRefCount(), 1);
+    }
+    EXPECT_EQ(destroyed, 1);
+}
+
+TEST(PointerTest, AtomicWeakRefRacesRelease)
+{
+    for (int i = 0; i < 100; i++) {
+        int  destroyed = 0;
+        auto shared    = Astrelis::AtomicRefPtr<Tracked>::Create(&destroyed);
+        Astrelis::WeakRef<Tracked, Astrelis::RefCountPolicy::Atomic> weak = shared;
+
+        std::thread locker([&weak]() {
+            bool alive = true;
+            while (alive) {
+                auto locked = weak.Lock();
+                alive       = locked != nullptr;
+                if (alive) {
+                    EXPECT_EQ(*locked->Destroyed, 0);
+                }
+            }
+        });
+        shared.Reset();
+        locker.join();
+        EXPECT_EQ(destroyed, 1);
+        EXPECT_TRUE(weak.IsExpired());
+    }
+}
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include "Astrelis/Scene/Scene.hpp"
+#include "Astrelis/Scene/SpriteRenderSystem.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <vector>
+
+using Astrelis::Scene, Astrelis::SpriteRenderer, Astrelis::Transform2D;
+
+TEST(SceneTest, EntitiesHaveDefaultComponents)
+{
+    Scene scene;
+    auto  entity = scene.CreateEntity("Player");
+    EXPECT_TRUE(entity.IsValid());
+    EXPECT_EQ(entity.GetComponent<Astrelis::Tag>().Name, "Player");
+    EXPECT_TRUE(entity.HasComponent<Transform2D>());
+    EXPECT_FALSE(entity.HasComponent<SpriteRenderer>());
+
+    entity.AddComponent<SpriteRenderer>();
+    EXPECT_TRUE(entity.HasComponent<SpriteRenderer>());
+    entity.RemoveComponent<SpriteRenderer>();
+    EXPECT_FALSE(entity.HasComponent<SpriteRenderer>());
+
+    EXPECT_EQ(scene.GetEntityCount(), 1);
+    scene.DestroyEntity(entity);
+    EXPECT_FALSE(entity.IsValid());
+    EXPECT_EQ(scene.GetEntityCount(), 0);
+    EXPECT_FALSE(Astrelis::Entity().IsValid());
+}
+
+TEST(SceneTest, TransformMatrix)
+{
+    Transform2D transform;
+    transform.Position = Astrelis::Vec2f(3.0F, 4.0F);
+    transform.Rotation = std::numbers::pi_v<float> / 2.0F;
+    transform.Scale    = Astrelis::Vec2f(2.0F, 1.0F);
+    transform.Depth    = 0.5F;
+
+    const Astrelis::Mat4f transformMatrix = transform.GetTransform();
+    const auto&           matrix          = transformMatrix.GetGLMMatrix();
+    // The X axis is scaled by 2 and rotated onto Y
+    EXPECT_NEAR(matrix[0][0], 0.0F, 1e-6F);
+    EXPECT_NEAR(matrix[0][1], 2.0F, 1e-6F);
+    EXPECT_NEAR(matrix[1][0], -1.0F, 1e-6F);
+    EXPECT_NEAR(matrix[1][1], 0.0F, 1e-6F);
+    EXPECT_FLOAT_EQ(matrix[3][0], 3.0F);
+    EXPECT_FLOAT_EQ(matrix[3][1], 4.0F);
+    EXPECT_FLOAT_EQ(matrix[3][2], 0.5F);
+    EXPECT_FLOAT_EQ(matrix[3][3], 1.0F);
+}
+
+TEST(SceneTest, SpriteBatchOnlyHasSprites)
+{
+    constexpr std::size_t SPRITE_COUNT = 100'000;
+
+    Scene scene;
+    for (std::size_t i = 0; i < SPRITE_COUNT; i++) {
+        auto entity = scene.CreateEntity();
+        entity.GetComponent<Transform2D>().Position =
+            Astrelis::Vec2f(static_cast<float>(i), 0.0F);
+        entity.AddComponent<SpriteRenderer>(Astrelis::Vec3f(1.0F, 0.0F, 0.0F));
+    }
+    // Entities without a sprite are not drawn
+    scene.CreateEntity("Camera");
+
+    Astrelis::SpriteRenderSystem system;
+    auto                         batch = system.Collect(scene);
+    ASSERT_EQ(batch.size(), SPRITE_COUNT);
+    EXPECT_FLOAT_EQ(batch[0].Color[0], 1.0F);
+    EXPECT_FLOAT_EQ(batch[0].Color[1], 0.0F);
+
+    double positionSum = 0.0;
+    for (const auto& instance : batch) {
+        positionSum += instance.Transform.GetGLMMatrix()[3][0];
+    }
+    EXPECT_DOUBLE_EQ(positionSum, static_cast<double>(SPRITE_COUNT * (SPRITE_COUNT - 1) / 2));
+
+    // Collecting again rebuilds the batch instead of appending
+    EXPECT_EQ(system.Collect(scene).size(), SPRITE_COUNT);
+}
+
+TEST(SceneTest, SpatialGridFollowsTransforms)
+{
+    Scene scene;
+    auto  near    = scene.CreateEntity("Near");
+    auto  far     = scene.CreateEntity("Far");
+    auto  removed = scene.CreateEntity("Removed");
+
+    far.GetComponent<Transform2D>().Position = Astrelis::Vec2f(50.0F, 50.0F);
+    scene.UpdateSpatialGrid();
+    EXPECT_EQ(scene.GetSpatialGrid().GetObjectCount(), 3);
+
+    std::vector<std::uint32_t> results;
+    auto found = scene.GetSpatialGrid().QueryRadius(Astrelis::Point2Df(0.0F, 0.0F), 1.0F, results);
+    EXPECT_EQ(found.size(), 2);
+
+    // Moved entities are found at their new position, destroyed ones are gone
+    far.GetComponent<Transform2D>().Position  = Astrelis::Vec2f(0.5F, 0.0F);
+    near.GetComponent<Transform2D>().Position = Astrelis::Vec2f(-50.0F, 0.0F);
+    scene.DestroyEntity(removed);
+    scene.UpdateSpatialGrid();
+    found = scene.GetSpatialGrid().QueryRadius(Astrelis::Point2Df(0.0F, 0.0F), 1.0F, results);
+    ASSERT_EQ(found.size(), 1);
+    EXPECT_EQ(scene.GetSpatialEntity(found[0]), far);
+
+    // Entities that lose their transform or are destroyed through the registry leave on the next update
+    far.RemoveComponent<Transform2D>();
+    scene.GetRegistry().destroy(near.GetHandle());
+    scene.UpdateSpatialGrid();
+    EXPECT_EQ(scene.GetSpatialGrid().GetObjectCount(), 0);
+
+    auto created = scene.CreateEntity();
+    scene.UpdateSpatialGrid();
+    found = scene.GetSpatialGrid().QueryRadius(Astrelis::Point2Df(0.0F, 0.0F), 1.0F, results);
+    ASSERT_EQ(found.size(), 1);
+    EXPECT_EQ(scene.GetSpatialEntity(found[0]), created);
+
+    scene.Clear();
+    EXPECT_EQ(scene.GetSpatialGrid().GetObjectCount(), 0);
+}
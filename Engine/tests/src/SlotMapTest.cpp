@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include "Astrelis/Core/SlotMap.hpp"
+
+#include <memory>
+#include <string>
+#include <unordered_set>
+
+using Astrelis::SlotMap;
+
+TEST(SlotMapTest, InsertAndLookup)
+{
+    SlotMap<std::string> map;
+    auto                 first  = map.Insert("first");
+    auto                 second = map.Emplace(3, 'x');
+    EXPECT_TRUE(first.IsValid());
+    EXPECT_NE(first, second);
+    ASSERT_NE(map.Get(first), nullptr);
+    EXPECT_EQ(*map.Get(first), "first");
+    EXPECT_EQ(*map.Get(second), "xxx");
+    EXPECT_EQ(map.GetSize(), 2);
+
+    // A default handle never refers to anything
+    EXPECT_FALSE(map.Contains({}));
+    EXPECT_EQ(map.Get({}), nullptr);
+}
+
+TEST(SlotMapTest, StaleHandlesAfterRemoval)
+{
+    SlotMap<int> map;
+    auto         first = map.Insert(1);
+    EXPECT_TRUE(map.Remove(first));
+    EXPECT_FALSE(map.Remove(first));
+    EXPECT_EQ(map.Get(first), nullptr);
+
+    // The slot is reused with a new generation
+    auto second = map.Insert(2);
+    EXPECT_EQ(second.Index, first.Index);
+    EXPECT_NE(second.Generation, first.Generation);
+    EXPECT_EQ(map.Get(first), nullptr);
+    EXPECT_EQ(*map.Get(second), 2);
+}
+
+TEST(SlotMapTest, RemovalKeepsStorageDense)
+{
+    SlotMap<std::unique_ptr<int>> map;
+    auto                          a = map.Insert(std::make_unique<int>(1));
+    auto                          b = map.Insert(std::make_unique<int>(2));
+    auto                          c = map.Insert(std::make_unique<int>(3));
+
+    // The last object is moved into the hole, handles to it stay valid
+    EXPECT_TRUE(map.Remove(a));
+    EXPECT_EQ(map.GetSize(), 2);
+    EXPECT_EQ(**map.Get(b), 2);
+    EXPECT_EQ(**map.Get(c), 3);
+    EXPECT_EQ(map.GetHandle(0), c);
+
+    int sum = 0;
+    for (const auto& value : map) {
+        sum += *value;
+    }
+    EXPECT_EQ(sum, 5);
+
+    map.Clear();
+    EXPECT_TRUE(map.IsEmpty());
+    EXPECT_FALSE(map.Contains(b));
+    EXPECT_FALSE(map.Contains(c));
+}
+
+TEST(SlotMapTest, TypedByInterface)
+{
+    struct Interface {};
+    struct Implementation : Interface {
+        int Value = 7;
+    };
+
+    SlotMap<Implementation, Interface> map;
+    Astrelis::Handle<Interface>        handle = map.Emplace();
+    EXPECT_EQ(map.Get(handle)->Value, 7);
+
+    std::unordered_set<Astrelis::Handle<Interface>> handles {handle};
+    EXPECT_TRUE(handles.contains(handle));
+}
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include "Astrelis/Core/Jobs/JobSystem.hpp"
+#include "Astrelis/Scene/SpatialHashGrid.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <vector>
+
+using Astrelis::Point2Df, Astrelis::Rect2Df, Astrelis::SpatialHashGrid;
+
+namespace {
+    std::vector<std::uint32_t> BruteForceRadius(
+        const std::vector<Point2Df>& positions, Point2Df center, float radius) {
+        std::vector<std::uint32_t> result;
+        for (std::size_t id = 0; id < positions.size(); id++) {
+            const float x = positions[id].X - center.X;
+            const float y = positions[id].Y - center.Y;
+            if (x * x + y * y <= radius * radius) {
+                result.push_back(static_cast<std::uint32_t>(id));
+            }
+        }
+        return result;
+    }
+
+    std::vector<std::uint32_t> Sorted(std::span<const std::uint32_t> ids) {
+        std::vector<std::uint32_t> sorted(ids.begin(), ids.end());
+        std::sort(sorted.begin(), sorted.end());
+        return sorted;
+    }
+} // namespace
+
+TEST(SpatialHashGridTest, QueriesMatchBruteForce)
+{
+    std::mt19937                          random(42);
+    std::uniform_real_distribution<float> coordinate(-50.0F, 50.0F);
+
+    // Few buckets, so that many cells share a bucket
+    SpatialHashGrid       grid(2.0F, 64);
+    std::vector<Point2Df> positions;
+    for (std::uint32_t id = 0; id < 2'000; id++) {
+        positions.emplace_back(coordinate(random), coordinate(random));
+        grid.Insert(id, positions.back());
+    }
+
+    std::vector<std::uint32_t> results;
+    for (int query = 0; query < 50; query++) {
+        const Point2Df center(coordinate(random), coordinate(random));
+        EXPECT_EQ(Sorted(grid.QueryRadius(center, 5.0F, results)),
+            BruteForceRadius(positions, center, 5.0F));
+    }
+
+    // A query that covers more cells than there are buckets
+    EXPECT_EQ(Sorted(grid.QueryRadius(Point2Df(0.0F, 0.0F), 40.0F, results)),
+        BruteForceRadius(positions, Point2Df(0.0F, 0.0F), 40.0F));
+
+    std::vector<std::uint32_t> expected;
+    for (std::uint32_t id = 0; id < positions.size(); id++) {
+        if (positions[id].X >= -10.0F && positions[id].X <= 5.0F && positions[id].Y >= 0.0F
+            && positions[id].Y <= 20.0F) {
+            expected.push_back(id);
+        }
+    }
+    EXPECT_EQ(Sorted(grid.QueryRect(Rect2Df(-10.0F, 0.0F, 15.0F, 20.0F), results)), expected);
+}
+
+TEST(SpatialHashGridTest, MoveAndRemove)
+{
+    SpatialHashGrid grid(1.0F);
+    grid.Insert(0, Point2Df(0.5F, 0.5F));
+    grid.Insert(1, Point2Df(0.6F, 0.5F));
+    grid.Insert(7, Point2Df(10.0F, 10.0F));
+    EXPECT_EQ(grid.GetObjectCount(), 3);
+    EXPECT_FALSE(grid.Contains(3));
+
+    std::vector<std::uint32_t> results;
+    EXPECT_EQ(grid.QueryRadius(Point2Df(0.0F, 0.0F), 1.0F, results).size(), 2);
+
+    // Within the same cell, then into another one
+    grid.Move(0, Point2Df(0.7F, 0.7F));
+    grid.Move(1, Point2Df(10.5F, 10.0F));
+    EXPECT_EQ(Sorted(grid.QueryRadius(Point2Df(10.0F, 10.0F), 1.0F, results)),
+        (std::vector<std::uint32_t> {1, 7}));
+    EXPECT_EQ(Sorted(grid.QueryRadius(Point2Df(0.0F, 0.0F), 1.0F, results)),
+        (std::vector<std::uint32_t> {0}));
+
+    grid.Remove(7);
+    grid.Remove(7);
+    EXPECT_FALSE(grid.Contains(7));
+    EXPECT_EQ(grid.GetObjectCount(), 2);
+    EXPECT_EQ(Sorted(grid.QueryRadius(Point2Df(10.0F, 10.0F), 1.0F, results)),
+        (std::vector<std::uint32_t> {1}));
+
+    grid.Clear();
+    EXPECT_EQ(grid.GetObjectCount(), 0);
+    EXPECT_TRUE(grid.QueryRadius(Point2Df(0.0F, 0.0F), 100.0F, results).empty());
+}
+
+TEST(SpatialHashGridTest, ExtremeCoordinates)
+{
+    constexpr float infinity = std::numeric_limits<float>::infinity();
+    constexpr float nan      = std::numeric_limits<float>::quiet_NaN();
+
+    SpatialHashGrid grid(1.0F);
+    grid.Insert(0, Point2Df(0.0F, 0.0F));
+    grid.Insert(1, Point2Df(1.0e30F, -1.0e30F));
+    grid.Insert(2, Point2Df(infinity, -infinity));
+    grid.Insert(3, Point2Df(nan, 0.0F));
+    grid.Move(0, Point2Df(-1.0e20F, 1.0e20F));
+
+    std::vector<std::uint32_t> results;
+    EXPECT_EQ(Sorted(grid.QueryRadius(Point2Df(1.0e30F, -1.0e30F), 1.0F, results)),
+        (std::vector<std::uint32_t> {1}));
+    EXPECT_EQ(Sorted(grid.QueryRadius(Point2Df(0.0F, 0.0F), infinity, results)),
+        (std::vector<std::uint32_t> {0, 1, 2}));
+    EXPECT_EQ(Sorted(grid.QueryRect(Rect2Df(-2.0e30F, -2.0e30F, 4.0e30F, 4.0e30F), results)),
+        (std::vector<std::uint32_t> {0, 1}));
+    EXPECT_TRUE(grid.QueryRadius(Point2Df(0.0F, 0.0F), nan, results).empty());
+}
+
+TEST(SpatialHashGridTest, BatchQueriesInParallel)
+{
+    Astrelis::JobSystem jobSystem;
+    ASSERT_TRUE(jobSystem.Init(4));
+
+    SpatialHashGrid       grid(1.0F);
+    std::vector<Point2Df> positions;
+    for (std::uint32_t y = 0; y < 50; y++) {
+        for (std::uint32_t x = 0; x < 50; x++) {
+            positions.emplace_back(static_cast<float>(x), static_cast<float>(y));
+            grid.Insert(y * 50 + x, positions.back());
+        }
+    }
+
+    Astrelis::SpatialQueryBatch batch;
+    for (int frame = 0; frame < 2; frame++) {
+        grid.QueryRadiusBatch(positions, 1.0F, batch, jobSystem);
+        ASSERT_EQ(batch.GetQueryCount(), positions.size());
+        for (std::size_t i = 0; i < positions.size(); i++) {
+            ASSERT_EQ(Sorted(batch.Get(i)), BruteForceRadius(positions, positions[i], 1.0F));
+        }
+    }
+
+    jobSystem.Shutdown();
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include "Astrelis/Scene/Scene.hpp"
+#include "Astrelis/Scene/SpriteAnimationSystem.hpp"
+#include "Astrelis/Scene/SpriteRenderSystem.hpp"
+
+#include <cstddef>
+#include <vector>
+
+using Astrelis::Scene, Astrelis::SpriteAnimationClip, Astrelis::SpriteAnimationSystem,
+    Astrelis::SpriteAnimator, Astrelis::SpriteRenderer, Astrelis::SpriteSheet, Astrelis::Vec4f;
+
+namespace {
+    void ExpectFrame(const Vec4f& frame, float offsetX, float offsetY, float scaleX, float scaleY) {
+        EXPECT_FLOAT_EQ(frame[0], offsetX);
+        EXPECT_FLOAT_EQ(frame[1], offsetY);
+        EXPECT_FLOAT_EQ(frame[2], scaleX);
+        EXPECT_FLOAT_EQ(frame[3], scaleY);
+    }
+} // namespace
+
+TEST(SpriteAnimationSystemTest, SheetFrames)
+{
+    const SpriteSheet sheet(Astrelis::Dimension2Du(256, 128));
+    ExpectFrame(sheet.GetFrame(Astrelis::Rect2Du(64, 32, 32, 64)), 0.25F, 0.25F, 0.125F, 0.5F);
+
+    // Four cells per row, the third frame wraps to the second row
+    const std::vector<Vec4f> frames = sheet.GetGridFrames(Astrelis::Dimension2Du(64, 64), 3, 3);
+    ASSERT_EQ(frames.size(), 3);
+    ExpectFrame(frames[0], 0.75F, 0.0F, 0.25F, 0.5F);
+    ExpectFrame(frames[1], 0.0F, 0.5F, 0.25F, 0.5F);
+    ExpectFrame(frames[2], 0.25F, 0.5F, 0.25F, 0.5F);
+}
+
+TEST(SpriteAnimationSystemTest, AnimatorsAdvanceTogether)
+{
+    const SpriteSheet            sheet(Astrelis::Dimension2Du(64, 16));
+    const Astrelis::Dimension2Du cell(16, 16);
+    SpriteAnimationSystem        system;
+    const auto walk = system.AddClip(SpriteAnimationClip {sheet.GetGridFrames(cell, 0, 4), 0.25F});
+    const auto jump =
+        system.AddClip(SpriteAnimationClip {sheet.GetGridFrames(cell, 2, 2), 0.5F, false});
+    EXPECT_EQ(system.GetClipCount(), 2);
+
+    Scene scene;
+    auto  walker = scene.CreateEntity("Walker");
+    walker.AddComponent<SpriteRenderer>();
+    walker.AddComponent<SpriteAnimator>(walk);
+    auto reverse = scene.CreateEntity("Reverse");
+    reverse.AddComponent<SpriteRenderer>();
+    reverse.AddComponent<SpriteAnimator>(walk, 0.0F, -1.0F);
+    auto jumper = scene.CreateEntity("Jumper");
+    jumper.AddComponent<SpriteRenderer>();
+    jumper.AddComponent<SpriteAnimator>(jump);
+    // Without a renderer there is nothing to animate
+    scene.CreateEntity("Hidden").AddComponent<SpriteAnimator>(walk);
+
+    system.Update(scene, 0.3F);
+    ExpectFrame(walker.GetComponent<SpriteRenderer>().TexCoords, 0.25F, 0.0F, 0.25F, 1.0F);
+    ExpectFrame(reverse.GetComponent<SpriteRenderer>().TexCoords, 0.5F, 0.0F, 0.25F, 1.0F);
+    ExpectFrame(jumper.GetComponent<SpriteRenderer>().TexCoords, 0.5F, 0.0F, 0.25F, 1.0F);
+
+    // The walk loops after a second, the jump stops on its last frame
+    system.Update(scene, 0.8F);
+    EXPECT_NEAR(walker.GetComponent<SpriteAnimator>().Time, 0.1F, 1.0e-5F);
+    ExpectFrame(walker.GetComponent<SpriteRenderer>().TexCoords, 0.0F, 0.0F, 0.25F, 1.0F);
+    ExpectFrame(reverse.GetComponent<SpriteRenderer>().TexCoords, 0.75F, 0.0F, 0.25F, 1.0F);
+    EXPECT_FALSE(jumper.GetComponent<SpriteAnimator>().Playing);
+    ExpectFrame(jumper.GetComponent<SpriteRenderer>().TexCoords, 0.75F, 0.0F, 0.25F, 1.0F);
+    ExpectFrame(system.GetFrame(walk, -0.1F), 0.75F, 0.0F, 0.25F, 1.0F);
+
+    // The frames end up in the instances, so all sprites still share one draw
+    Astrelis::SpriteRenderSystem renderSystem;
+    auto                         batch = renderSystem.Collect(scene);
+    ASSERT_EQ(batch.size(), 3);
+    std::size_t lastFrames = 0;
+    for (const auto& instance : batch) {
+        lastFrames += instance.TexCoords[0] == 0.75F ? 1 : 0;
+    }
+    EXPECT_EQ(lastFrames, 2);
+}
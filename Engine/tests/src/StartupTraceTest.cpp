@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include "Astrelis/Core/StartupTrace.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+using Astrelis::StartupTrace, Astrelis::TimePoint;
+
+TEST(StartupTraceTest, PhasesSortedByStart)
+{
+    StartupTrace trace;
+    TimePoint    first;
+    TimePoint    second;
+    trace.AddPhase("Second", second, TimePoint::Now());
+    trace.AddPhase("First", first, TimePoint::Now());
+
+    auto phases = trace.GetPhases();
+    ASSERT_EQ(phases.size(), 2);
+    EXPECT_EQ(phases[0].Name, "First");
+    EXPECT_EQ(phases[1].Name, "Second");
+    EXPECT_LE(static_cast<double>(phases[0].Start), static_cast<double>(phases[1].Start));
+}
+
+TEST(StartupTraceTest, ScopesFromWorkerThreads)
+{
+    StartupTrace trace;
+    std::thread  worker([&trace]() { StartupTrace::Scope phase(trace, "Worker"); });
+    {
+        StartupTrace::Scope phase(trace, "Main");
+    }
+    worker.join();
+
+    auto phases = trace.GetPhases();
+    ASSERT_EQ(phases.size(), 2);
+    for (const auto& phase : phases) {
+        if (phase.Name == "Main") {
+            EXPECT_EQ(phase.Thread, std::this_thread::get_id());
+        }
+        else {
+            EXPECT_NE(phase.Thread, std::this_thread::get_id());
+        }
+    }
+}
+
+TEST(StartupTraceTest, FinishIgnoresLaterPhases)
+{
+    StartupTrace trace;
+    {
+        StartupTrace::Scope phase(trace, "Before");
+    }
+    EXPECT_FALSE(trace.IsFinished());
+    trace.Finish();
+    EXPECT_TRUE(trace.IsFinished());
+
+    const double total = static_cast<double>(trace.GetTotalTime());
+    {
+        StartupTrace::Scope phase(trace, "After");
+    }
+    EXPECT_EQ(trace.GetPhases().size(), 1);
+    EXPECT_DOUBLE_EQ(static_cast<double>(trace.GetTotalTime()), total);
+}
+
+TEST(StartupTraceTest, WriteCSV)
+{
+    StartupTrace trace;
+    {
+        StartupTrace::Scope phase(trace, "Window");
+    }
+    trace.Finish();
+
+    auto path = std::filesystem::temp_directory_path() / "astrelis_startup_trace.csv";
+    ASSERT_FALSE(trace.WriteCSV(path).IsErr());
+
+    std::ifstream file(path);
+    std::string   line;
+    std::getline(file, line);
+    EXPECT_EQ(line, "Phase,StartMs,DurationMs,Thread");
+    std::getline(file, line);
+    EXPECT_EQ(line.rfind("Window,", 0), 0);
+    std::getline(file, line);
+    EXPECT_EQ(line.rfind("Total,0,", 0), 0);
+    file.close();
+    std::filesystem::remove(path);
+}
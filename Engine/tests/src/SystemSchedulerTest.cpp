@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include "Astrelis/Core/Jobs/JobSystem.hpp"
+#include "Astrelis/Scene/Scene.hpp"
+#include "Astrelis/Scene/SystemScheduler.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+using Astrelis::JobSystem, Astrelis::Scene, Astrelis::SystemAccess, Astrelis::SystemContext,
+    Astrelis::SystemScheduler, Astrelis::Transform2D;
+
+namespace {
+    struct Velocity {
+        float Speed = 1.0F;
+    };
+
+    struct Health {
+        int Value = 100;
+    };
+
+    void Noop(SystemContext& context) {
+        ASTRELIS_UNUSED(context);
+    }
+} // namespace
+
+TEST(SystemSchedulerTest, ConflictingSystemsKeepOrder)
+{
+    SystemScheduler scheduler;
+    scheduler.AddSystem("Movement", SystemAccess().Read<Velocity>().Write<Transform2D>(), Noop);
+    scheduler.AddSystem("Damage", SystemAccess().Write<Health>(), Noop);
+    scheduler.AddSystem("Camera", SystemAccess().Read<Transform2D>(), Noop);
+    scheduler.AddSystem("Regen", SystemAccess().Read<Velocity>().Write<Health>(), Noop);
+
+    // Movement and Damage touch different components, the others read what they write
+    ASSERT_EQ(scheduler.GetStageCount(), 2);
+    ASSERT_EQ(scheduler.GetStage(0).size(), 2);
+    EXPECT_EQ(scheduler.GetSystemName(scheduler.GetStage(0)[0]), "Movement");
+    EXPECT_EQ(scheduler.GetSystemName(scheduler.GetStage(0)[1]), "Damage");
+    ASSERT_EQ(scheduler.GetStage(1).size(), 2);
+    EXPECT_EQ(scheduler.GetSystemName(scheduler.GetStage(1)[0]), "Camera");
+    EXPECT_EQ(scheduler.GetSystemName(scheduler.GetStage(1)[1]), "Regen");
+}
+
+TEST(SystemSchedulerTest, UndeclaredSystemIsBarrier)
+{
+    SystemScheduler scheduler;
+    scheduler.AddSystem("A", SystemAccess().Read<Transform2D>(), Noop);
+    scheduler.AddSystem("B", SystemAccess().Read<Transform2D>(), Noop);
+    scheduler.AddSystem("Everything", SystemAccess(), Noop);
+    scheduler.AddSystem("C", SystemAccess().Read<Transform2D>(), Noop);
+
+    ASSERT_EQ(scheduler.GetStageCount(), 3);
+    EXPECT_EQ(scheduler.GetStage(0).size(), 2);
+    ASSERT_EQ(scheduler.GetStage(1).size(), 1);
+    EXPECT_EQ(scheduler.GetSystemName(scheduler.GetStage(1)[0]), "Everything");
+    EXPECT_EQ(scheduler.GetStage(2).size(), 1);
+}
+
+TEST(SystemSchedulerTest, ParallelEachVisitsEveryEntityOnce)
+{
+    constexpr std::size_t ENTITY_COUNT = 50'000;
+    constexpr int         FRAME_COUNT  = 4;
+
+    JobSystem jobSystem;
+    ASSERT_TRUE(jobSystem.Init(4));
+
+    Scene scene;
+    for (std::size_t i = 0; i < ENTITY_COUNT; i++) {
+        auto entity = scene.CreateEntity();
+        entity.AddComponent<Velocity>(static_cast<float>(i % 4));
+        entity.AddComponent<Health>();
+    }
+
+    std::atomic<std::uint32_t> healthVisits = 0;
+    SystemScheduler            scheduler;
+    scheduler.AddSystem("Movement", SystemAccess().Read<Velocity>().Write<Transform2D>(),
+        [](SystemContext& context) {
+            context.ParallelEach<const Velocity, Transform2D>(
+                [](const Velocity& velocity, Transform2D& transform) {
+                    transform.Position += Astrelis::Vec2f(velocity.Speed, 0.0F);
+                });
+        });
+    scheduler.AddSystem(
+        "Damage", SystemAccess().Write<Health>(), [&healthVisits](SystemContext& context) {
+            context.ParallelEach<Health>(
+                [&healthVisits](Health& health) {
+                    health.Value--;
+                    healthVisits.fetch_add(1, std::memory_order_relaxed);
+                },
+                256);
+        });
+    ASSERT_EQ(scheduler.GetStageCount(), 1);
+
+    for (int frame = 0; frame < FRAME_COUNT; frame++) {
+        scheduler.Run(scene, jobSystem);
+    }
+
+    EXPECT_EQ(healthVisits.load(), ENTITY_COUNT * FRAME_COUNT);
+    scene.View<const Velocity, const Transform2D, const Health>().each(
+        [](const Velocity& velocity, const Transform2D& transform, const Health& health) {
+            EXPECT_FLOAT_EQ(transform.Position[0], velocity.Speed * FRAME_COUNT);
+            EXPECT_EQ(health.Value, 100 - FRAME_COUNT);
+        });
+
+    jobSystem.Shutdown();
+}
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include "Astrelis/Core/TimerWheel.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using Astrelis::Milliseconds, Astrelis::TimerHandle, Astrelis::TimerWheel;
+
+namespace {
+    Milliseconds Millis(double value) {
+        return Milliseconds(std::chrono::duration<double, std::milli>(value));
+    }
+} // namespace
+
+TEST(TimerWheelTest, OneShotAndRepeating)
+{
+    TimerWheel  wheel;
+    int         oneShot   = 0;
+    int         repeating = 0;
+    TimerHandle once      = wheel.Schedule(Millis(10.0), [&oneShot]() { oneShot++; });
+    TimerHandle repeat = wheel.ScheduleRepeating(Millis(4.0), [&repeating]() { repeating++; });
+    EXPECT_EQ(wheel.GetActiveCount(), 2);
+
+    wheel.Advance(Millis(9.0));
+    EXPECT_EQ(oneShot, 0);
+    EXPECT_EQ(repeating, 2);
+
+    wheel.Advance(Millis(1.0));
+    EXPECT_EQ(oneShot, 1);
+    EXPECT_FALSE(wheel.IsActive(once));
+    EXPECT_FALSE(wheel.Cancel(once));
+
+    wheel.Advance(Millis(10.0));
+    EXPECT_EQ(oneShot, 1);
+    EXPECT_EQ(repeating, 5);
+
+    EXPECT_TRUE(wheel.Cancel(repeat));
+    wheel.Advance(Millis(100.0));
+    EXPECT_EQ(repeating, 5);
+    EXPECT_EQ(wheel.GetActiveCount(), 0);
+}
+
+TEST(TimerWheelTest, FractionalFrames)
+{
+    TimerWheel wheel;
+    int        fired = 0;
+    wheel.ScheduleRepeating(Millis(16.0), [&fired]() { fired++; });
+
+    // 60 frames of 1/60th of a second add up to a second, even though frames are not whole ticks
+    for (int frame = 0; frame < 60; frame++) {
+        wheel.Advance(Millis(1000.0 / 60.0));
+    }
+    EXPECT_EQ(fired, 62);
+}
+
+TEST(TimerWheelTest, CancelFromCallback)
+{
+    TimerWheel  wheel;
+    int         fired = 0;
+    TimerHandle self;
+    TimerHandle other = wheel.Schedule(Millis(5.0), [&fired]() { fired += 100; });
+    self              = wheel.ScheduleRepeating(Millis(5.0), [&]() {
+        fired++;
+        wheel.Cancel(self);
+        wheel.Cancel(other);
+    });
+
+    wheel.Advance(Millis(50.0));
+    // Both expire in the same tick, the other timer only fires if it happens to run first
+    EXPECT_TRUE(fired == 1 || fired == 101);
+    EXPECT_FALSE(wheel.IsActive(self));
+    EXPECT_EQ(wheel.GetActiveCount(), 0);
+}
+
+TEST(TimerWheelTest, MatchesReference)
+{
+    // Long delays cascade through every level of the wheel
+    TimerWheel                 wheel;
+    std::mt19937_64            random(1234);
+    std::vector<std::uint64_t> expected;
+    std::vector<std::uint64_t> firedAt;
+    std::vector<TimerHandle>   handles;
+
+    for (std::size_t i = 0; i < 2'000; i++) {
+        std::uint64_t delay = 1 + (random() % (i % 2 == 0 ? 300 : 200'000));
+        expected.push_back(delay);
+        firedAt.push_back(0);
+        handles.push_back(wheel.Schedule(Millis(static_cast<double>(delay)),
+            [&wheel, &firedAt, i]() { firedAt[i] = wheel.GetCurrentTick(); }));
+    }
+
+    // Cancel every third timer
+    for (std::size_t i = 0; i < handles.size(); i += 3) {
+        EXPECT_TRUE(wheel.Cancel(handles[i]));
+    }
+
+    std::uint64_t elapsed = 0;
+    while (elapsed < 250'000) {
+        std::uint64_t step = 1 + (random() % 40);
+        wheel.Advance(Millis(static_cast<double>(step)));
+        elapsed += step;
+    }
+
+    for (std::size_t i = 0; i < handles.size(); i++) {
+        EXPECT_EQ(firedAt[i], i % 3 == 0 ? 0 : expected[i]) << "Timer " << i;
+    }
+    EXPECT_EQ(wheel.GetActiveCount(), 0);
+}
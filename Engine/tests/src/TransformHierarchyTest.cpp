@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include "Astrelis/Scene/Components.hpp"
+#include "Astrelis/Scene/TransformHierarchy.hpp"
+
+#include <cstddef>
+#include <numbers>
+#include <utility>
+#include <vector>
+
+using Astrelis::InstanceData, Astrelis::Mat4f, Astrelis::TransformHierarchy,
+    Astrelis::TransformNodeId, Astrelis::Vec2f;
+
+namespace {
+    void ExpectMatrixNear(const Mat4f& actual, const Mat4f& expected) {
+        for (int column = 0; column < 4; column++) {
+            for (int row = 0; row < 4; row++) {
+                EXPECT_NEAR(actual.GetGLMMatrix()[column][row],
+                    expected.GetGLMMatrix()[column][row], 1e-5F)
+                    << "column " << column << " row " << row;
+            }
+        }
+    }
+
+    /// Multiplies two matrices of the form Transform2D::GetTransform builds, without glm
+    Mat4f Multiply(const Mat4f& lhs, const Mat4f& rhs) {
+        Mat4f result(0.0F);
+        for (int column = 0; column < 4; column++) {
+            for (int row = 0; row < 4; row++) {
+                float sum = 0.0F;
+                for (int k = 0; k < 4; k++) {
+                    sum += lhs.GetGLMMatrix()[k][row] * rhs.GetGLMMatrix()[column][k];
+                }
+                result.GetGLMMatrix()[column][row] = sum;
+            }
+        }
+        return result;
+    }
+} // namespace
+
+TEST(TransformHierarchyTest, WorldIsParentTimesLocal)
+{
+    TransformHierarchy hierarchy;
+    // Added before its parent is moved under the root, so the nodes have to be sorted
+    const TransformNodeId child = hierarchy.AddNode();
+    const TransformNodeId arm   = hierarchy.AddNode();
+    const TransformNodeId root  = hierarchy.AddNode();
+    ASSERT_TRUE(hierarchy.SetParent(arm, root));
+    ASSERT_TRUE(hierarchy.SetParent(child, arm));
+    EXPECT_EQ(hierarchy.GetParent(child), arm);
+
+    Astrelis::Transform2D rootLocal;
+    rootLocal.Position = Vec2f(10.0F, 5.0F);
+    rootLocal.Rotation = std::numbers::pi_v<float> / 2.0F;
+    rootLocal.Depth    = 0.5F;
+    Astrelis::Transform2D armLocal;
+    armLocal.Position = Vec2f(2.0F, 0.0F);
+    armLocal.Scale    = Vec2f(2.0F, 3.0F);
+    Astrelis::Transform2D childLocal;
+    childLocal.Position = Vec2f(1.0F, 1.0F);
+    childLocal.Rotation = 0.25F;
+    childLocal.Depth    = 0.25F;
+
+    const std::pair<TransformNodeId, const Astrelis::Transform2D*> locals[] = {
+        {root, &rootLocal}, {arm, &armLocal}, {child, &childLocal}};
+    for (const auto& [node, local] : locals) {
+        hierarchy.SetPosition(node, local->Position);
+        hierarchy.SetRotation(node, local->Rotation);
+        hierarchy.SetScale(node, local->Scale);
+        hierarchy.SetDepth(node, local->Depth);
+    }
+
+    std::vector<InstanceData> instances(hierarchy.GetNodeCount());
+    hierarchy.Update(instances);
+    EXPECT_EQ(hierarchy.GetUpdatedCount(), 3);
+
+    const Mat4f rootWorld  = rootLocal.GetTransform();
+    const Mat4f armWorld   = Multiply(rootWorld, armLocal.GetTransform());
+    const Mat4f childWorld = Multiply(armWorld, childLocal.GetTransform());
+    ExpectMatrixNear(hierarchy.GetWorldTransform(root), rootWorld);
+    ExpectMatrixNear(hierarchy.GetWorldTransform(arm), armWorld);
+    ExpectMatrixNear(hierarchy.GetWorldTransform(child), childWorld);
+    // The instances are indexed by node id, not by the sorted order
+    ExpectMatrixNear(instances[root].Transform, rootWorld);
+    ExpectMatrixNear(instances[child].Transform, childWorld);
+}
+
+TEST(TransformHierarchyTest, OnlyChangedSubtreesAreUpdated)
+{
+    constexpr std::size_t ROOT_COUNT  = 64;
+    constexpr std::size_t CHILD_COUNT = 16;
+
+    TransformHierarchy           hierarchy;
+    std::vector<TransformNodeId> roots;
+    for (std::size_t i = 0; i < ROOT_COUNT; i++) {
+        const TransformNodeId root = hierarchy.AddNode();
+        roots.push_back(root);
+        for (std::size_t j = 0; j < CHILD_COUNT; j++) {
+            hierarchy.SetPosition(hierarchy.AddNode(root), Vec2f(static_cast<float>(j), 0.0F));
+        }
+    }
+
+    std::vector<InstanceData> instances(hierarchy.GetNodeCount());
+    hierarchy.Update(instances);
+    EXPECT_EQ(hierarchy.GetUpdatedCount(), ROOT_COUNT * (CHILD_COUNT + 1));
+
+    hierarchy.Update(instances);
+    EXPECT_EQ(hierarchy.GetUpdatedCount(), 0);
+
+    // Nodes are updated in batches of four, so a changed subtree can update a few of its neighbours
+    hierarchy.SetPosition(roots[10], Vec2f(100.0F, 0.0F));
+    hierarchy.Update(instances);
+    EXPECT_GE(hierarchy.GetUpdatedCount(), CHILD_COUNT + 1);
+    EXPECT_LE(hierarchy.GetUpdatedCount(), CHILD_COUNT + 4);
+
+    const TransformNodeId lastChild = roots[10] + CHILD_COUNT;
+    EXPECT_FLOAT_EQ(instances[lastChild].Transform.GetGLMMatrix()[3][0],
+        100.0F + static_cast<float>(CHILD_COUNT - 1));
+    EXPECT_FLOAT_EQ(instances[lastChild + 1].Transform.GetGLMMatrix()[3][0], 0.0F);
+}
+
+TEST(TransformHierarchyTest, PartialUpdateKeepsTheBuffer)
+{
+    // Nodes are updated in batches of four, the nodes in between put the roots in separate batches
+    TransformHierarchy    hierarchy;
+    const TransformNodeId moved = hierarchy.AddNode();
+    for (int i = 0; i < 3; i++) {
+        hierarchy.AddNode();
+    }
+    const TransformNodeId still = hierarchy.AddNode();
+    const TransformNodeId child = hierarchy.AddNode(still);
+    hierarchy.SetPosition(still, Vec2f(5.0F, 0.0F));
+
+    std::vector<InstanceData> instances(hierarchy.GetNodeCount());
+    hierarchy.Update(instances);
+    hierarchy.SetPosition(moved, Vec2f(1.0F, 0.0F));
+    hierarchy.Update(instances);
+    EXPECT_FLOAT_EQ(instances[moved].Transform.GetGLMMatrix()[3][0], 1.0F);
+    EXPECT_FLOAT_EQ(instances[still].Transform.GetGLMMatrix()[3][0], 5.0F);
+    EXPECT_FLOAT_EQ(instances[child].Transform.GetGLMMatrix()[3][0], 5.0F);
+
+    // A different buffer only gets the changed nodes, until everything is marked dirty
+    std::vector<InstanceData> other(hierarchy.GetNodeCount());
+    hierarchy.SetPosition(moved, Vec2f(2.0F, 0.0F));
+    hierarchy.Update(other);
+    EXPECT_FLOAT_EQ(other[moved].Transform.GetGLMMatrix()[3][0], 2.0F);
+    EXPECT_FLOAT_EQ(other[still].Transform.GetGLMMatrix()[3][0], 0.0F);
+
+    hierarchy.MarkAllDirty();
+    hierarchy.Update(other);
+    EXPECT_FLOAT_EQ(other[still].Transform.GetGLMMatrix()[3][0], 5.0F);
+    EXPECT_FLOAT_EQ(other[child].Transform.GetGLMMatrix()[3][0], 5.0F);
+}
+
+TEST(TransformHierarchyTest, CyclesAreRejected)
+{
+    TransformHierarchy    hierarchy;
+    const TransformNodeId root  = hierarchy.AddNode();
+    const TransformNodeId child = hierarchy.AddNode(root);
+    EXPECT_FALSE(hierarchy.SetParent(root, child));
+    EXPECT_FALSE(hierarchy.SetParent(root, root));
+    EXPECT_EQ(hierarchy.GetParent(root), TransformHierarchy::NO_PARENT);
+
+    hierarchy.Clear();
+    EXPECT_EQ(hierarchy.GetNodeCount(), 0);
+    hierarchy.Update();
+    EXPECT_EQ(hierarchy.GetUpdatedCount(), 0);
+}
@@ -11,6 +11,7 @@ struct VertexIn
 
     row_major float4x4 transform : TEXCOORD1; // Transformation matrix (model matrix)
     float4 color : COLOR;           // Instance color input
+    float4 texRect : TEXCOORD5;     // Instance texture rect, offset in xy and scale in zw
 };
 
 struct VertexOut
@@ -30,8 +31,8 @@ VertexOut VS_Main(VertexIn vin)
     vout.position = mul(worldPosition, view);                              // World space to view space
     vout.position = mul(vout.position, proj);                              // View space to clip space
 
-    // Pass through texture coordinates and instance color
-    vout.texcoord = vin.texcoord;
+    // Map the texture coordinates into the instance's rect (e.g. a sprite sheet frame), pass through color
+    vout.texcoord = vin.texcoord * vin.texRect.zw + vin.texRect.xy;
     vout.color = vin.color;
 
     return vout;